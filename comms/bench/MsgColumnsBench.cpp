@@ -0,0 +1,231 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+
+// Comparison of decoding the frames of single message type into columns of
+// field values using comms::MsgColumns versus allocating and reading message
+// objects with comms::MsgFactory (via comms::protocol::MsgIdLayer) and copying
+// the field values into the columns afterwards.
+// Usage: comms_msg_columns_bench [frames_count]
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+
+#include "comms/comms.h"
+
+namespace
+{
+
+typedef std::chrono::high_resolution_clock Clock;
+
+const std::size_t SamplesCount = 8U;
+
+enum MsgId : std::uint8_t
+{
+    MsgId_Status,
+    MsgId_Sample,
+    MsgId_NumOfValues
+};
+
+typedef comms::Message<
+    comms::option::BigEndian,
+    comms::option::MsgIdType<MsgId>,
+    comms::option::ReadIterator<const std::uint8_t*>,
+    comms::option::WriteIterator<std::uint8_t*>
+> BenchMessage;
+
+typedef BenchMessage::Field FieldBase;
+
+typedef std::tuple<
+    comms::field::IntValue<FieldBase, std::uint8_t>
+> StatusFields;
+
+class StatusMsg : public
+        comms::MessageBase<
+            BenchMessage,
+            comms::option::StaticNumIdImpl<MsgId_Status>,
+            comms::option::FieldsImpl<StatusFields>,
+            comms::option::MsgType<StatusMsg>
+        >
+{
+};
+
+typedef std::tuple<
+    comms::field::IntValue<FieldBase, std::uint32_t>,
+    comms::field::IntValue<FieldBase, std::int16_t>,
+    comms::field::IntValue<FieldBase, std::int16_t>,
+    comms::field::ArrayList<
+        FieldBase,
+        comms::field::IntValue<FieldBase, std::uint16_t>,
+        comms::option::SequenceSizeFieldPrefix<comms::field::IntValue<FieldBase, std::uint8_t> >
+    >
+> SampleFields;
+
+class SampleMsg : public
+        comms::MessageBase<
+            BenchMessage,
+            comms::option::StaticNumIdImpl<MsgId_Sample>,
+            comms::option::FieldsImpl<SampleFields>,
+            comms::option::MsgType<SampleMsg>
+        >
+{
+public:
+    COMMS_MSG_FIELDS_ACCESS(timestamp, x, y, samples);
+};
+
+typedef std::tuple<
+    StatusMsg,
+    SampleMsg
+> AllMessages;
+
+typedef comms::protocol::MsgSizeLayer<
+    comms::field::IntValue<FieldBase, std::uint16_t>,
+    comms::protocol::MsgIdLayer<
+        comms::field::EnumValue<FieldBase, MsgId, comms::option::FixedLength<1> >,
+        BenchMessage,
+        AllMessages,
+        comms::protocol::MsgDataLayer<>
+    >
+> ProtocolStack;
+
+typedef ProtocolStack::NextLayer IdLayer;
+
+struct ManualColumns
+{
+    std::vector<std::uint32_t> timestamps;
+    std::vector<std::int16_t> xs;
+    std::vector<std::int16_t> ys;
+    comms::MsgSequenceColumn<std::uint16_t> samples;
+};
+
+std::vector<std::uint8_t> makeInput(std::size_t count)
+{
+    static const std::size_t PayloadSize = 4U + 2U + 2U + 1U + (SamplesCount * 2U);
+
+    std::vector<std::uint8_t> data;
+    data.reserve(count * (PayloadSize + 3));
+    for (auto idx = 0U; idx < count; ++idx) {
+        data.push_back(0);
+        data.push_back(static_cast<std::uint8_t>(PayloadSize + 1));
+        data.push_back(static_cast<std::uint8_t>(MsgId_Sample));
+        data.push_back(static_cast<std::uint8_t>(idx >> 24));
+        data.push_back(static_cast<std::uint8_t>(idx >> 16));
+        data.push_back(static_cast<std::uint8_t>(idx >> 8));
+        data.push_back(static_cast<std::uint8_t>(idx));
+        for (auto coord = 0U; coord < 4U; ++coord) {
+            data.push_back(static_cast<std::uint8_t>(idx + coord));
+        }
+        data.push_back(static_cast<std::uint8_t>(SamplesCount));
+        for (auto sample = 0U; sample < (SamplesCount * 2U); ++sample) {
+            data.push_back(static_cast<std::uint8_t>(sample));
+        }
+    }
+    return data;
+}
+
+void checkRead(comms::ErrorStatus es)
+{
+    if (es != comms::ErrorStatus::Success) {
+        std::cerr << "ERROR: Unexpected read failure" << std::endl;
+        std::exit(1);
+    }
+}
+
+void checkCount(std::size_t read, std::size_t count)
+{
+    if (read != count) {
+        std::cerr << "ERROR: Unexpected number of messages" << std::endl;
+        std::exit(1);
+    }
+}
+
+Clock::duration benchFactory(const std::vector<std::uint8_t>& data, std::size_t count)
+{
+    ProtocolStack stack;
+    ManualColumns columns;
+    auto start = Clock::now();
+    const std::uint8_t* iter = &data[0];
+    auto* end = iter + data.size();
+    while (iter < end) {
+        ProtocolStack::MsgPtr msg;
+        checkRead(stack.read(msg, iter, static_cast<std::size_t>(end - iter)));
+        auto* sampleMsg = static_cast<SampleMsg*>(msg.get());
+        columns.timestamps.push_back(sampleMsg->field_timestamp().value());
+        columns.xs.push_back(sampleMsg->field_x().value());
+        columns.ys.push_back(sampleMsg->field_y().value());
+        columns.samples.addRow();
+        for (auto& sample : sampleMsg->field_samples().value()) {
+            columns.samples.addValue(sample.value());
+        }
+    }
+    auto duration = Clock::now() - start;
+    checkCount(columns.timestamps.size(), count);
+    return duration;
+}
+
+Clock::duration benchColumns(const std::vector<std::uint8_t>& data, std::size_t count)
+{
+    ProtocolStack stack;
+    stack.nextLayer().setDefaultReadPolicy(IdLayer::ReadPolicy::Skip);
+    stack.nextLayer().setReadPolicy(MsgId_Sample, IdLayer::ReadPolicy::PassThrough);
+    comms::MsgColumns<SampleMsg> columns;
+    auto start = Clock::now();
+    const std::uint8_t* iter = &data[0];
+    auto* end = iter + data.size();
+    while (iter < end) {
+        ProtocolStack::MsgPtr msg;
+        checkRead(stack.read(msg, iter, static_cast<std::size_t>(end - iter)));
+        auto& frame = stack.nextLayer().passThroughFrame();
+        auto payloadIter = frame.payload;
+        checkRead(columns.read(payloadIter, frame.length));
+    }
+    auto duration = Clock::now() - start;
+    checkCount(columns.size(), count);
+    return duration;
+}
+
+void report(const char* name, std::size_t count, Clock::duration duration)
+{
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << name << ": " << count << " frames in "
+              << (ns / 1000) << " us, "
+              << (static_cast<double>(ns) / static_cast<double>(count)) << " ns/frame" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 1000000U;
+    if (1 < argc) {
+        count = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    if (count == 0U) {
+        std::cerr << "ERROR: Invalid frames count" << std::endl;
+        return 1;
+    }
+
+    auto data = makeInput(count);
+    report("message factory", count, benchFactory(data, count));
+    report("columns", count, benchColumns(data, count));
+    return 0;
+}
@@ -0,0 +1,197 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Comparison of reading messages sharing the same numeric ID with and
+// without discriminators (see comms::option::DiscriminatorField).
+// Every ID is shared by 8 variants, the frames are spread evenly among them.
+// Usage: comms_msg_id_layer_bench [frames_count]
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#include "comms/comms.h"
+
+namespace
+{
+
+typedef std::chrono::high_resolution_clock Clock;
+
+const unsigned VariantsCount = 8U;
+
+enum MsgId : std::uint8_t
+{
+    MsgId_First,
+    MsgId_Second,
+    MsgId_NumOfValues
+};
+
+typedef comms::Message<
+    comms::option::BigEndian,
+    comms::option::MsgIdType<MsgId>,
+    comms::option::ReadIterator<const std::uint8_t*>,
+    comms::option::WriteIterator<std::uint8_t*>
+> BenchMessage;
+
+typedef BenchMessage::Field FieldBase;
+
+template <std::uint8_t TKind>
+using KindField =
+    comms::field::IntValue<
+        FieldBase,
+        std::uint8_t,
+        comms::option::DefaultNumValue<TKind>,
+        comms::option::ValidNumValueRange<TKind, TKind>,
+        comms::option::FailOnInvalid<>
+    >;
+
+template <std::uint8_t TKind>
+using BenchFields =
+    std::tuple<
+        KindField<TKind>,
+        comms::field::IntValue<FieldBase, std::uint32_t>,
+        comms::field::IntValue<FieldBase, std::uint32_t>,
+        comms::field::String<FieldBase, comms::option::SequenceSizeFieldPrefix<comms::field::IntValue<FieldBase, std::uint8_t> > >
+    >;
+
+template <MsgId TId, std::uint8_t TKind>
+class PlainMessage : public
+        comms::MessageBase<
+            BenchMessage,
+            comms::option::StaticNumIdImpl<TId>,
+            comms::option::FieldsImpl<BenchFields<TKind> >,
+            comms::option::MsgType<PlainMessage<TId, TKind> >
+        >
+{
+};
+
+template <MsgId TId, std::uint8_t TKind>
+class DiscriminatedMessage : public
+        comms::MessageBase<
+            BenchMessage,
+            comms::option::StaticNumIdImpl<TId>,
+            comms::option::FieldsImpl<BenchFields<TKind> >,
+            comms::option::MsgType<DiscriminatedMessage<TId, TKind> >,
+            comms::option::DiscriminatorField<0, comms::field::IntValue<FieldBase, std::uint8_t>, TKind>
+        >
+{
+};
+
+template <template <MsgId, std::uint8_t> class TMsg, MsgId TId>
+using Variants =
+    std::tuple<
+        TMsg<TId, 0>, TMsg<TId, 1>, TMsg<TId, 2>, TMsg<TId, 3>,
+        TMsg<TId, 4>, TMsg<TId, 5>, TMsg<TId, 6>, TMsg<TId, 7>
+    >;
+
+template <template <MsgId, std::uint8_t> class TMsg>
+using AllMessages =
+    decltype(
+        std::tuple_cat(
+            std::declval<Variants<TMsg, MsgId_First> >(),
+            std::declval<Variants<TMsg, MsgId_Second> >()));
+
+template <template <MsgId, std::uint8_t> class TMsg>
+using ProtocolStack =
+    comms::protocol::MsgSizeLayer<
+        comms::field::IntValue<FieldBase, std::uint16_t>,
+        comms::protocol::MsgIdLayer<
+            comms::field::EnumValue<FieldBase, MsgId, comms::option::FixedLength<1> >,
+            BenchMessage,
+            AllMessages<TMsg>,
+            comms::protocol::MsgDataLayer<>
+        >
+    >;
+
+std::vector<std::uint8_t> makeInput(std::size_t count)
+{
+    static const std::uint8_t Payload[] = {
+        0x0, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x5, 'h', 'e', 'l', 'l', 'o'
+    };
+
+    static const std::size_t PayloadSize = std::extent<decltype(Payload)>::value;
+
+    std::vector<std::uint8_t> data;
+    data.reserve(count * (PayloadSize + 3));
+    for (auto idx = 0U; idx < count; ++idx) {
+        data.push_back(0);
+        data.push_back(static_cast<std::uint8_t>(PayloadSize + 1));
+        data.push_back(static_cast<std::uint8_t>(idx % MsgId_NumOfValues));
+        auto payloadStart = data.size();
+        data.insert(data.end(), std::begin(Payload), std::end(Payload));
+        data[payloadStart] = static_cast<std::uint8_t>((idx / MsgId_NumOfValues) % VariantsCount);
+    }
+    return data;
+}
+
+template <typename TStack>
+Clock::duration bench(const std::vector<std::uint8_t>& data, std::size_t count)
+{
+    TStack stack;
+    auto start = Clock::now();
+    const std::uint8_t* iter = &data[0];
+    auto* end = iter + data.size();
+    std::size_t read = 0U;
+    while (iter < end) {
+        typename TStack::MsgPtr msg;
+        auto es = stack.read(msg, iter, static_cast<std::size_t>(end - iter));
+        if (es != comms::ErrorStatus::Success) {
+            std::cerr << "ERROR: Unexpected read failure" << std::endl;
+            std::exit(1);
+        }
+        ++read;
+    }
+    auto duration = Clock::now() - start;
+    if (read != count) {
+        std::cerr << "ERROR: Unexpected number of messages" << std::endl;
+        std::exit(1);
+    }
+    return duration;
+}
+
+void report(const char* name, std::size_t count, Clock::duration duration)
+{
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << name << ": " << count << " frames in "
+              << (ns / 1000) << " us, "
+              << (static_cast<double>(ns) / static_cast<double>(count)) << " ns/frame" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 1000000U;
+    if (1 < argc) {
+        count = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    if (count == 0U) {
+        std::cerr << "ERROR: Invalid frames count" << std::endl;
+        return 1;
+    }
+
+    auto data = makeInput(count);
+    report("allocate and reparse", count, bench<ProtocolStack<PlainMessage> >(data, count));
+    report("discriminator", count, bench<ProtocolStack<DiscriminatedMessage> >(data, count));
+    return 0;
+}
@@ -0,0 +1,204 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+
+// Comparison of accessing the fields of fixed layout message payloads using
+// comms::MsgView (all the fields and a single one), reading them into reused
+// message object and copying the payloads with memcpy.
+// Usage: comms_msg_view_bench [payloads_count]
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "comms/comms.h"
+
+namespace
+{
+
+typedef std::chrono::high_resolution_clock Clock;
+
+typedef comms::Message<
+    comms::option::BigEndian,
+    comms::option::MsgIdType<std::uint8_t>,
+    comms::option::ReadIterator<const std::uint8_t*>,
+    comms::option::WriteIterator<std::uint8_t*>
+> BenchMessage;
+
+typedef BenchMessage::Field FieldBase;
+
+enum class Mode : std::uint8_t
+{
+    Idle,
+    Active,
+    NumOfValues
+};
+
+typedef std::tuple<
+    comms::field::IntValue<FieldBase, std::uint32_t>,
+    comms::field::IntValue<FieldBase, std::int32_t>,
+    comms::field::IntValue<FieldBase, std::int32_t>,
+    comms::field::IntValue<FieldBase, std::int16_t>,
+    comms::field::EnumValue<FieldBase, Mode>,
+    comms::field::BitmaskValue<FieldBase, comms::option::FixedLength<1> >,
+    comms::field::FloatValue<FieldBase, float>
+> PositionFields;
+
+class PositionMsg : public
+        comms::MessageBase<
+            BenchMessage,
+            comms::option::StaticNumIdImpl<1>,
+            comms::option::FieldsImpl<PositionFields>,
+            comms::option::MsgType<PositionMsg>
+        >
+{
+public:
+    COMMS_MSG_FIELDS_ACCESS(timestamp, latitude, longitude, altitude, mode, flags, speed);
+};
+
+typedef comms::MsgView<PositionMsg> PositionView;
+
+const std::size_t PayloadSize = PositionView::length();
+
+std::vector<std::uint8_t> makeInput(std::size_t count)
+{
+    std::vector<std::uint8_t> data(count * PayloadSize);
+    for (auto idx = 0U; idx < data.size(); ++idx) {
+        data[idx] = static_cast<std::uint8_t>(idx);
+    }
+    return data;
+}
+
+template <typename TFields>
+std::uint64_t accumulate(const TFields& fields)
+{
+    return
+        static_cast<std::uint64_t>(std::get<0>(fields)) +
+        static_cast<std::uint64_t>(std::get<1>(fields)) +
+        static_cast<std::uint64_t>(std::get<2>(fields)) +
+        static_cast<std::uint64_t>(std::get<3>(fields)) +
+        static_cast<std::uint64_t>(std::get<4>(fields)) +
+        static_cast<std::uint64_t>(std::get<5>(fields)) +
+        static_cast<std::uint64_t>(std::get<6>(fields));
+}
+
+Clock::duration benchMemcpy(const std::vector<std::uint8_t>& data, std::uint64_t& sum)
+{
+    std::uint8_t copy[PayloadSize];
+    auto start = Clock::now();
+    for (auto idx = 0U; idx < data.size(); idx += PayloadSize) {
+        std::memcpy(&copy[0], &data[idx], PayloadSize);
+        sum += copy[0] + copy[PayloadSize - 1];
+    }
+    return Clock::now() - start;
+}
+
+Clock::duration benchView(const std::vector<std::uint8_t>& data, std::uint64_t& sum)
+{
+    auto start = Clock::now();
+    const std::uint8_t* iter = &data[0];
+    auto* end = iter + data.size();
+    while (iter < end) {
+        PositionView view;
+        view.read(iter, static_cast<std::size_t>(end - iter));
+        sum += accumulate(
+            std::make_tuple(
+                view.value<PositionMsg::FieldIdx_timestamp>(),
+                view.value<PositionMsg::FieldIdx_latitude>(),
+                view.value<PositionMsg::FieldIdx_longitude>(),
+                view.value<PositionMsg::FieldIdx_altitude>(),
+                view.value<PositionMsg::FieldIdx_mode>(),
+                view.value<PositionMsg::FieldIdx_flags>(),
+                view.value<PositionMsg::FieldIdx_speed>()));
+    }
+    return Clock::now() - start;
+}
+
+Clock::duration benchViewSingle(const std::vector<std::uint8_t>& data, std::uint64_t& sum)
+{
+    auto start = Clock::now();
+    const std::uint8_t* iter = &data[0];
+    auto* end = iter + data.size();
+    while (iter < end) {
+        PositionView view;
+        view.read(iter, static_cast<std::size_t>(end - iter));
+        sum += view.value<PositionMsg::FieldIdx_altitude>();
+    }
+    return Clock::now() - start;
+}
+
+Clock::duration benchMessage(const std::vector<std::uint8_t>& data, std::uint64_t& sum)
+{
+    PositionMsg msg;
+    auto start = Clock::now();
+    const std::uint8_t* iter = &data[0];
+    auto* end = iter + data.size();
+    while (iter < end) {
+        auto es = msg.doRead(iter, static_cast<std::size_t>(end - iter));
+        if (es != comms::ErrorStatus::Success) {
+            std::cerr << "ERROR: Unexpected read failure" << std::endl;
+            std::exit(1);
+        }
+
+        sum += accumulate(
+            std::make_tuple(
+                msg.field_timestamp().value(),
+                msg.field_latitude().value(),
+                msg.field_longitude().value(),
+                msg.field_altitude().value(),
+                msg.field_mode().value(),
+                msg.field_flags().value(),
+                msg.field_speed().value()));
+    }
+    return Clock::now() - start;
+}
+
+void report(const char* name, std::size_t count, Clock::duration duration)
+{
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << name << ": " << count << " payloads in "
+              << (ns / 1000) << " us, "
+              << (static_cast<double>(ns) / static_cast<double>(count)) << " ns/payload" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 10000000U;
+    if (1 < argc) {
+        count = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    if (count == 0U) {
+        std::cerr << "ERROR: Invalid payloads count" << std::endl;
+        return 1;
+    }
+
+    auto data = makeInput(count);
+    std::uint64_t sum = 0U;
+    report("memcpy", count, benchMemcpy(data, sum));
+    report("view, all fields", count, benchView(data, sum));
+    report("view, single field", count, benchViewSingle(data, sum));
+    report("message", count, benchMessage(data, sum));
+    std::cout << "(checksum " << sum << ")" << std::endl;
+    return 0;
+}
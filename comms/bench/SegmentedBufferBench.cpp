@@ -0,0 +1,210 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Comparison of reading the frames received in a chain of separate chunks
+// directly using comms::util::SegmentedBuffer and after coalescing the chunks
+// into a single contiguous buffer.
+// Usage: comms_segmented_buffer_bench [frames_count] [chunk_size]
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <algorithm>
+
+#include "comms/comms.h"
+#include "comms/util/SegmentedBuffer.h"
+
+namespace
+{
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template <typename TReadIter>
+using BenchMessage =
+    comms::Message<
+        comms::option::BigEndian,
+        comms::option::MsgIdType<std::uint8_t>,
+        comms::option::ReadIterator<TReadIter>,
+        comms::option::WriteIterator<std::uint8_t*>,
+        comms::option::LengthInfoInterface
+    >;
+
+template <typename TMessage>
+using SampleFields =
+    std::tuple<
+        comms::field::IntValue<typename TMessage::Field, std::uint32_t>,
+        comms::field::IntValue<typename TMessage::Field, std::int16_t>,
+        comms::field::ArrayList<
+            typename TMessage::Field,
+            std::uint8_t,
+            comms::option::SequenceSizeFieldPrefix<
+                comms::field::IntValue<typename TMessage::Field, std::uint8_t>
+            >
+        >
+    >;
+
+template <typename TMessage>
+class SampleMsg : public
+        comms::MessageBase<
+            TMessage,
+            comms::option::StaticNumIdImpl<1>,
+            comms::option::FieldsImpl<SampleFields<TMessage> >,
+            comms::option::MsgType<SampleMsg<TMessage> >
+        >
+{
+public:
+    COMMS_MSG_FIELDS_ACCESS(timestamp, value, data);
+};
+
+template <typename TMessage>
+using Stack =
+    comms::protocol::SyncPrefixLayer<
+        comms::field::IntValue<
+            typename TMessage::Field,
+            std::uint16_t,
+            comms::option::DefaultNumValue<0xabcd>,
+            comms::option::ValidNumValueRange<0xabcd, 0xabcd>
+        >,
+        comms::protocol::ChecksumLayer<
+            comms::field::IntValue<typename TMessage::Field, std::uint16_t>,
+            comms::protocol::checksum::Crc_CCITT,
+            comms::protocol::MsgSizeLayer<
+                comms::field::IntValue<typename TMessage::Field, std::uint16_t>,
+                comms::protocol::MsgIdLayer<
+                    comms::field::IntValue<typename TMessage::Field, std::uint8_t>,
+                    TMessage,
+                    std::tuple<SampleMsg<TMessage> >,
+                    comms::protocol::MsgDataLayer<>
+                >
+            >
+        >
+    >;
+
+typedef BenchMessage<const std::uint8_t*> ContiguousMessage;
+typedef BenchMessage<comms::util::SegmentedBuffer::Iterator> SegmentedMessage;
+typedef Stack<ContiguousMessage> ContiguousStack;
+typedef Stack<SegmentedMessage> SegmentedStack;
+
+std::vector<std::uint8_t> makeInput(std::size_t count)
+{
+    SampleMsg<ContiguousMessage> msg;
+    ContiguousStack stack;
+    std::vector<std::uint8_t> data;
+    for (auto idx = 0U; idx < count; ++idx) {
+        msg.field_timestamp().value() = idx;
+        msg.field_value().value() = static_cast<std::int16_t>(idx);
+        msg.field_data().value().assign(32U + (idx % 64U), static_cast<std::uint8_t>(idx));
+
+        auto offset = data.size();
+        data.resize(offset + stack.length(msg));
+        std::uint8_t* iter = &data[offset];
+        auto es = stack.write(msg, iter, data.size() - offset);
+        if (es != comms::ErrorStatus::Success) {
+            std::cerr << "ERROR: Unexpected write failure" << std::endl;
+            std::exit(1);
+        }
+    }
+    return data;
+}
+
+template <typename TIter, typename TStack>
+void readAll(TStack& stack, TIter iter, std::size_t size, std::uint64_t& sum)
+{
+    auto begIter = iter;
+    while (0U < size) {
+        typename TStack::MsgPtr msgPtr;
+        auto es = stack.read(msgPtr, iter, size);
+        if (es != comms::ErrorStatus::Success) {
+            std::cerr << "ERROR: Unexpected read failure" << std::endl;
+            std::exit(1);
+        }
+
+        sum += msgPtr->length();
+        size -= static_cast<std::size_t>(std::distance(begIter, iter));
+        begIter = iter;
+    }
+}
+
+Clock::duration benchCoalesce(
+    const std::vector<std::uint8_t>& data,
+    std::size_t chunkSize,
+    std::uint64_t& sum)
+{
+    ContiguousStack stack;
+    std::vector<std::uint8_t> buf;
+    auto start = Clock::now();
+    for (auto offset = 0U; offset < data.size(); offset += chunkSize) {
+        auto len = std::min(chunkSize, data.size() - offset);
+        buf.insert(buf.end(), &data[offset], &data[offset] + len);
+    }
+    readAll(stack, static_cast<const std::uint8_t*>(&buf[0]), buf.size(), sum);
+    return Clock::now() - start;
+}
+
+Clock::duration benchSegmented(
+    const std::vector<std::uint8_t>& data,
+    std::size_t chunkSize,
+    std::uint64_t& sum)
+{
+    SegmentedStack stack;
+    comms::util::SegmentedBuffer buf;
+    auto start = Clock::now();
+    for (auto offset = 0U; offset < data.size(); offset += chunkSize) {
+        auto len = std::min(chunkSize, data.size() - offset);
+        buf.append(&data[offset], len);
+    }
+    readAll(stack, buf.begin(), buf.size(), sum);
+    return Clock::now() - start;
+}
+
+void report(const char* name, std::size_t count, Clock::duration duration)
+{
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << name << ": " << count << " frames in "
+              << (ns / 1000) << " us, "
+              << (static_cast<double>(ns) / static_cast<double>(count)) << " ns/frame" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t count = 1000000U;
+    if (1 < argc) {
+        count = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    std::size_t chunkSize = 1500U;
+    if (2 < argc) {
+        chunkSize = static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+
+    if ((count == 0U) || (chunkSize == 0U)) {
+        std::cerr << "ERROR: Invalid parameters" << std::endl;
+        return 1;
+    }
+
+    auto data = makeInput(count);
+    std::uint64_t sum = 0U;
+    report("coalesce and read", count, benchCoalesce(data, chunkSize, sum));
+    report("segmented read", count, benchSegmented(data, chunkSize, sum));
+    std::cout << "(checksum " << sum << ")" << std::endl;
+    return 0;
+}
@@ -108,6 +108,32 @@ public:
     /// @return Const reference to the fields of the message.
     const AllFields& fields() const;
 
+    /// @brief Decode the fields, which decoding was deferred by the
+    ///     last read operation.
+    /// @details The function exists only if comms::option::LazyFieldsFrom option
+    ///     was provided to comms::MessageBase. It is invoked automatically on
+    ///     any access to the fields, use it explicitly to get the status of
+    ///     the decoding.
+    ///     The status of the failed decoding is retained until the next
+    ///     read operation, the deferred fields may hold partially read values
+    ///     and @b doValid() reports @b false.
+    /// @return Status of the read operation of the deferred fields,
+    ///     comms::ErrorStatus::Success if there was nothing to decode.
+    ErrorStatus decodeLazyFields() const;
+
+    /// @brief Get an access to the fields of the message without decoding
+    ///     the deferred ones.
+    /// @details The function exists only if comms::option::LazyFieldsFrom option
+    ///     was provided to comms::MessageBase. Only the fields preceding the
+    ///     first deferred one are guaranteed to hold the last read values.
+    /// @return Const reference to the fields of the message.
+    const AllFields& eagerFields() const;
+
+    /// @brief Check whether there is deferred data waiting to be decoded.
+    /// @details The function exists only if comms::option::LazyFieldsFrom option
+    ///     was provided to comms::MessageBase.
+    bool lazyFieldsPending() const;
+
     /// @brief Default implementation of ID retrieval functionality.
     /// @details This function exists only if comms::option::StaticNumIdImpl option
     ///     was provided to comms::MessageBase. @n
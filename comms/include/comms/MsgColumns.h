@@ -0,0 +1,365 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// Contains definition of comms::MsgColumns class.
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "comms/ErrorStatus.h"
+#include "comms/util/Tuple.h"
+#include "details/MsgColumnSelector.h"
+
+namespace comms
+{
+
+/// @brief Column of the sequence (string or list) field values used by
+///     comms::MsgColumns.
+/// @details The values of all the rows are stored one after another in
+///     a single contiguous array, while the offsets array records
+///     the position of the first value of every row.
+/// @tparam TElem Type of the stored value. For the list of the numeric
+///     fields it is the value type of the element field, otherwise it is
+///     the element field type itself.
+/// @headerfile comms/MsgColumns.h
+template <typename TElem>
+class MsgSequenceColumn
+{
+public:
+    /// @brief Type of the stored value.
+    using ValueType = TElem;
+
+    /// @brief Number of the rows.
+    std::size_t size() const
+    {
+        return offsets_.size();
+    }
+
+    /// @brief Check the column has no rows.
+    bool empty() const
+    {
+        return offsets_.empty();
+    }
+
+    /// @brief Offset of the first value of the row in @ref values().
+    std::size_t rowOffset(std::size_t row) const
+    {
+        return offsets_[row];
+    }
+
+    /// @brief Number of the values in the row.
+    std::size_t rowLength(std::size_t row) const
+    {
+        auto end = (row + 1U) < offsets_.size() ? offsets_[row + 1U] : values_.size();
+        return end - offsets_[row];
+    }
+
+    /// @brief Pointer to the first value of the row.
+    const ValueType* rowData(std::size_t row) const
+    {
+        return values_.data() + offsets_[row];
+    }
+
+    /// @brief Offsets of all the rows.
+    const std::vector<std::size_t>& offsets() const
+    {
+        return offsets_;
+    }
+
+    /// @brief Values of all the rows.
+    const std::vector<ValueType>& values() const
+    {
+        return values_;
+    }
+
+    /// @brief Start a new empty row.
+    void addRow()
+    {
+        offsets_.push_back(values_.size());
+    }
+
+    /// @brief Add a new row containing the provided values.
+    template <typename TIter>
+    void addRow(TIter from, TIter to)
+    {
+        addRow();
+        values_.insert(values_.end(), from, to);
+    }
+
+    /// @brief Add value to the last row.
+    void addValue(const ValueType& value)
+    {
+        values_.push_back(value);
+    }
+
+    /// @brief Reserve space for rows and values.
+    void reserve(std::size_t rows, std::size_t values)
+    {
+        offsets_.reserve(rows);
+        values_.reserve(values);
+    }
+
+    /// @brief Remove all the rows.
+    void clear()
+    {
+        offsets_.clear();
+        values_.clear();
+    }
+
+    /// @brief Remove all the rows starting from the specified one.
+    void truncate(std::size_t rows)
+    {
+        if (offsets_.size() <= rows) {
+            return;
+        }
+
+        values_.resize(offsets_[rows]);
+        offsets_.resize(rows);
+    }
+
+private:
+    std::vector<std::size_t> offsets_;
+    std::vector<ValueType> values_;
+};
+
+/// @brief Batch decoder of the single message type into columns of
+///     field values.
+/// @details Every field listed in comms::option::FieldsImpl option of the
+///     message gets its own column:
+///     @li std::vector of the values for numeric fields (comms::field::IntValue,
+///         comms::field::EnumValue, comms::field::FloatValue,
+///         comms::field::BitmaskValue).
+///     @li comms::MsgSequenceColumn of the characters / bytes for
+///         comms::field::String and raw data comms::field::ArrayList.
+///     @li comms::MsgSequenceColumn of the element values (or element fields
+///         if they are not numeric) for comms::field::ArrayList of fields.
+///     @li std::vector of the field objects for all the other fields.
+///
+///     The fields are read from the payload one by one directly into their
+///     columns without any message object being involved. The numeric
+///     fields are read into the temporary field objects and their values
+///     are appended to the columns. The elements of the strings and lists,
+///     which are either prefixed with their number (see
+///     comms::option::SequenceSizeFieldPrefix) or occupy the rest of the
+///     payload, are appended to the column values as they are read. The
+///     sequences using other serialisation options are read as the whole
+///     field first. If the message defines its own @b doRead() member
+///     function (for example to set the mode of the optional fields), the
+///     payloads are read by the single message object owned by this class
+///     and the values of its fields are appended to the columns. @n
+///     The payloads are expected to be extracted from the frames by the
+///     protocol stack, which uses comms::protocol::MsgIdLayer::ReadPolicy::PassThrough
+///     policy for the message ID:
+///     @code
+///     stack.nextLayer().setDefaultReadPolicy(IdLayer::ReadPolicy::Skip);
+///     stack.nextLayer().setReadPolicy(MsgId_Position, IdLayer::ReadPolicy::PassThrough);
+///     comms::MsgColumns<PositionMsg> columns;
+///     while (iter < end) {
+///         ProtStack::MsgPtr msg;
+///         auto es = stack.read(msg, iter, end - iter);
+///         if (es == comms::ErrorStatus::Success) {
+///             auto& frame = stack.nextLayer().passThroughFrame();
+///             auto payloadIter = frame.payload;
+///             columns.read(payloadIter, frame.length);
+///         }
+///     }
+///     auto& latitudes = columns.column<PositionMsg::FieldIdx_latitude>();
+///     @endcode
+/// @tparam TMsg Type of the message, expected to extend comms::MessageBase
+///     and use comms::option::FieldsImpl option.
+/// @headerfile comms/MsgColumns.h
+template <typename TMsg>
+class MsgColumns
+{
+public:
+    /// @brief Type of the message.
+    using Message = TMsg;
+
+    /// @brief All the fields of the message bundled in std::tuple.
+    using AllFields = typename Message::AllFields;
+
+    /// @brief All the columns bundled in std::tuple.
+    using AllColumns = typename details::MsgColumnsTuple<AllFields>::Type;
+
+    /// @brief Type of the column for the field with specified index.
+    template <std::size_t TIdx>
+    using Column = typename std::tuple_element<TIdx, AllColumns>::type;
+
+    /// @brief Decode single payload and append the values of its fields
+    ///     as a new row.
+    /// @details If the read fails, nothing is appended.
+    /// @param[in, out] iter Iterator used for reading.
+    /// @param[in] size Size of the payload.
+    /// @return Status of the read operation.
+    template <typename TIter>
+    comms::ErrorStatus read(TIter& iter, std::size_t size)
+    {
+        using Tag =
+            typename std::conditional<
+                details::MsgColumnsHasCustomRead<Message, TIter>::Value,
+                MessageReadTag,
+                DirectReadTag
+            >::type;
+
+        auto es = readInternal(iter, size, Tag());
+        if (es != comms::ErrorStatus::Success) {
+            util::tupleForEachWithTemplateParamIdx(columns_, ColumnTruncator(rows_));
+            return es;
+        }
+
+        ++rows_;
+        return es;
+    }
+
+    /// @brief Number of the decoded rows.
+    std::size_t size() const
+    {
+        return rows_;
+    }
+
+    /// @brief Access the column of the field with specified index.
+    template <std::size_t TIdx>
+    const Column<TIdx>& column() const
+    {
+        return std::get<TIdx>(columns_);
+    }
+
+    /// @brief Access all the columns.
+    const AllColumns& columns() const
+    {
+        return columns_;
+    }
+
+    /// @brief Remove all the rows.
+    void clear()
+    {
+        util::tupleForEach(columns_, ColumnClearer());
+        rows_ = 0U;
+    }
+
+private:
+    struct MessageReadTag {};
+    struct DirectReadTag {};
+
+    template <typename TIter>
+    comms::ErrorStatus readInternal(TIter& iter, std::size_t size, MessageReadTag)
+    {
+        auto es = msg_.doRead(iter, size);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        const auto& fields = msg_.fields();
+        util::tupleForEachWithTemplateParamIdx(columns_, ColumnAppender(fields));
+        return es;
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus readInternal(TIter& iter, std::size_t size, DirectReadTag)
+    {
+        auto es = comms::ErrorStatus::Success;
+        util::tupleForEachWithTemplateParamIdx(columns_, ColumnReader<TIter>(iter, size, es));
+        return es;
+    }
+
+    template <typename TIter>
+    class ColumnReader
+    {
+    public:
+        ColumnReader(TIter& iter, std::size_t& size, comms::ErrorStatus& es)
+          : iter_(iter),
+            size_(size),
+            es_(es)
+        {
+        }
+
+        template <std::size_t TIdx, typename TColumn>
+        void operator()(TColumn& column)
+        {
+            if (es_ != comms::ErrorStatus::Success) {
+                return;
+            }
+
+            using FieldType = typename std::tuple_element<TIdx, AllFields>::type;
+            es_ = details::MsgColumnSelector<FieldType>::read(column, iter_, size_);
+        }
+
+    private:
+        TIter& iter_;
+        std::size_t& size_;
+        comms::ErrorStatus& es_;
+    };
+
+    class ColumnTruncator
+    {
+    public:
+        explicit ColumnTruncator(std::size_t rows)
+          : rows_(rows)
+        {
+        }
+
+        template <std::size_t TIdx, typename TColumn>
+        void operator()(TColumn& column) const
+        {
+            using FieldType = typename std::tuple_element<TIdx, AllFields>::type;
+            details::MsgColumnSelector<FieldType>::truncate(column, rows_);
+        }
+
+    private:
+        std::size_t rows_;
+    };
+
+    class ColumnAppender
+    {
+    public:
+        explicit ColumnAppender(const AllFields& fields)
+          : fields_(fields)
+        {
+        }
+
+        template <std::size_t TIdx, typename TColumn>
+        void operator()(TColumn& column) const
+        {
+            using FieldType = typename std::tuple_element<TIdx, AllFields>::type;
+            details::MsgColumnSelector<FieldType>::append(column, std::get<TIdx>(fields_));
+        }
+
+    private:
+        const AllFields& fields_;
+    };
+
+    struct ColumnClearer
+    {
+        template <typename TColumn>
+        void operator()(TColumn& column) const
+        {
+            column.clear();
+        }
+    };
+
+    Message msg_;
+    AllColumns columns_;
+    std::size_t rows_ = 0U;
+};
+
+}  // namespace comms
+
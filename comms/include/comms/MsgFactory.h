@@ -65,6 +65,12 @@ namespace comms
 ///         If comms::option::InPlaceAllocation option is NOT used, than the
 ///         requested message objects are allocated using dynamic memory and
 ///         returned wrapped in std::unique_ptr without custom deleter.
+///     @li comms::option::RecycleAllocation - Option to specify that
+///         released message objects are kept by the factory and reused by the
+///         following allocations of the same message type, retaining the
+///         capacity of their list and string fields. The returned smart
+///         pointer contains custom deleter, which returns the object to the
+///         factory. Cannot be used together with comms::option::InPlaceAllocation.
 ///     @li comms::option::SupportGenericMessage - Option used to allow
 ///         allocation of @ref comms::GenericMessage. If such option is
 ///         provided, the createGenericMsg() member function will be able
@@ -0,0 +1,207 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// Contains definition of comms::MsgView class.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <iterator>
+
+#include "comms/Assert.h"
+#include "comms/ErrorStatus.h"
+#include "comms/util/Tuple.h"
+#include "comms/field/tag.h"
+
+namespace comms
+{
+
+namespace details
+{
+
+struct MsgViewFieldChecker
+{
+    template <typename TField>
+    constexpr bool operator()(bool soFar) const
+    {
+        return
+            soFar &&
+            (TField::minLength() == TField::maxLength()) &&
+            (std::is_same<typename TField::Tag, comms::field::tag::Int>::value ||
+             std::is_same<typename TField::Tag, comms::field::tag::Enum>::value ||
+             std::is_same<typename TField::Tag, comms::field::tag::Bitmask>::value ||
+             std::is_same<typename TField::Tag, comms::field::tag::Float>::value);
+    }
+};
+
+}  // namespace details
+
+/// @brief Read-only view over the serialised payload of the fixed layout message.
+/// @details Applicable to the messages, which fields (listed with
+///     comms::option::FieldsImpl option) are all fixed length
+///     comms::field::IntValue, comms::field::EnumValue,
+///     comms::field::BitmaskValue or comms::field::FloatValue. The view
+///     only references the payload bytes, the field value is deserialised
+///     (including endian conversion) on every access to it. The offsets of
+///     the fields are known at compile time. @n
+///     The fields are referenced by their indices, the ones generated for
+///     the message by the COMMS_MSG_FIELDS_ACCESS() macro can be used:
+///     @code
+///     comms::MsgView<PositionMsg> view;
+///     auto es = view.read(iter, len);
+///     if (es == comms::ErrorStatus::Success) {
+///         auto latitude = view.value<PositionMsg::FieldIdx_latitude>();
+///     }
+///     @endcode
+///     The payload can be extracted from the frame without allocating the
+///     message object by the protocol stack, which uses
+///     comms::protocol::MsgIdLayer::ReadPolicy::PassThrough policy for the
+///     message ID (see comms::protocol::MsgIdLayer::passThroughFrame()).
+/// @tparam TMsg Type of the message, expected to extend comms::MessageBase
+///     and use comms::option::FieldsImpl option.
+/// @headerfile comms/MsgView.h
+template <typename TMsg>
+class MsgView
+{
+public:
+    /// @brief Type of the message.
+    using Message = TMsg;
+
+    /// @brief All the fields of the message bundled in std::tuple.
+    using AllFields = typename Message::AllFields;
+
+    /// @brief Type of the field with specified index.
+    template <std::size_t TIdx>
+    using Field = typename std::tuple_element<TIdx, AllFields>::type;
+
+    static_assert(
+        util::tupleTypeAccumulate<AllFields>(true, details::MsgViewFieldChecker()),
+        "All the message fields are expected to be fixed length numeric ones");
+
+    /// @brief Default constructor, creates view not referencing any data.
+    MsgView() = default;
+
+    /// @brief Construct view over the payload.
+    /// @pre The payload is at least @ref length() bytes long.
+    explicit MsgView(const std::uint8_t* data)
+      : data_(data)
+    {
+    }
+
+    /// @brief Serialisation length of the message payload.
+    static constexpr std::size_t length()
+    {
+        return Message::doMinLength();
+    }
+
+    /// @brief Make the view reference the payload.
+    /// @details The payload is not copied, it must outlive the view.
+    /// @tparam TIter Type of the iterator, expected to be pointer to single
+    ///     byte characters.
+    /// @param[in, out] iter Iterator to the payload, advanced by @ref length()
+    ///     on success.
+    /// @param[in] size Size of the available data.
+    /// @return comms::ErrorStatus::NotEnoughData if the size is smaller than
+    ///     @ref length(), comms::ErrorStatus::Success otherwise.
+    template <typename TIter>
+    comms::ErrorStatus read(TIter& iter, std::size_t size)
+    {
+        using IterType = typename std::decay<decltype(iter)>::type;
+        static_assert(
+            std::is_pointer<IterType>::value &&
+                (sizeof(typename std::iterator_traits<IterType>::value_type) == 1U),
+            "The iterator is expected to be pointer to single byte characters");
+
+        if (size < length()) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        data_ = reinterpret_cast<const std::uint8_t*>(iter);
+        std::advance(iter, length());
+        return comms::ErrorStatus::Success;
+    }
+
+    /// @brief Pointer to the referenced payload, nullptr if none.
+    const std::uint8_t* data() const
+    {
+        return data_;
+    }
+
+    /// @brief Deserialise the field with specified index.
+    template <std::size_t TIdx>
+    Field<TIdx> field() const
+    {
+        GASSERT(data_ != nullptr);
+        Field<TIdx> result;
+        auto iter = data_ + Message::template doMinLengthUntil<TIdx>();
+        result.readNoStatus(iter);
+        return result;
+    }
+
+    /// @brief Deserialise the value of the field with specified index.
+    template <std::size_t TIdx>
+    typename Field<TIdx>::ValueType value() const
+    {
+        return field<TIdx>().value();
+    }
+
+    /// @brief Check validity of all the field values.
+    bool valid() const
+    {
+        GASSERT(data_ != nullptr);
+        bool result = true;
+        util::tupleForEachType<AllFields>(ValidityChecker(data_, result));
+        return result;
+    }
+
+private:
+    class ValidityChecker
+    {
+    public:
+        ValidityChecker(const std::uint8_t* data, bool& result)
+          : iter_(data),
+            result_(result)
+        {
+        }
+
+        template <typename TField>
+        void operator()()
+        {
+            if (!result_) {
+                return;
+            }
+
+            TField field;
+            field.readNoStatus(iter_);
+            result_ = field.valid();
+        }
+
+    private:
+        const std::uint8_t* iter_;
+        bool& result_;
+    };
+
+    const std::uint8_t* data_ = nullptr;
+};
+
+}  // namespace comms
+
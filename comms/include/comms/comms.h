@@ -31,4 +31,6 @@
 #include "MessageBase.h"
 #include "MsgFactory.h"
 #include "GenericMessage.h"
+#include "MsgColumns.h"
+#include "MsgView.h"
 
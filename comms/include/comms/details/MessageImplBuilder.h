@@ -20,7 +20,11 @@
 
 #include <type_traits>
 #include <cstddef>
+#include <cstdint>
 #include <tuple>
+#include <vector>
+#include <algorithm>
+#include <iterator>
 
 #include "comms/Assert.h"
 #include "comms/util/access.h"
@@ -736,6 +740,150 @@ template <typename TBase, typename TOpt>
 using MessageImplFieldsBaseT =
     typename MessageImplProcessFieldsBase<TOpt::HasFieldsImpl>::template Type<TBase, TOpt>;
 
+template <typename TBase, std::size_t TIdx>
+class MessageImplLazyFieldsBase : public TBase
+{
+    using BaseImpl = TBase;
+public:
+    using AllFields = typename BaseImpl::AllFields;
+
+    static_assert(TIdx < std::tuple_size<AllFields>::value,
+        "Index of the first lazy field exceeds number of fields");
+
+    AllFields& fields()
+    {
+        decodeLazyFields();
+        return BaseImpl::fields();
+    }
+
+    const AllFields& fields() const
+    {
+        decodeLazyFields();
+        return BaseImpl::fields();
+    }
+
+    const AllFields& eagerFields() const
+    {
+        return BaseImpl::fields();
+    }
+
+    bool lazyFieldsPending() const
+    {
+        return lazyPending_;
+    }
+
+    comms::ErrorStatus decodeLazyFields() const
+    {
+        if (!lazyPending_) {
+            return lazyStatus_;
+        }
+
+        lazyPending_ = false;
+        auto* thisPtr = const_cast<MessageImplLazyFieldsBase<TBase, TIdx>*>(this);
+        const std::uint8_t* iter = lazyData_.data();
+        std::size_t size = lazyData_.size();
+        lazyStatus_ = thisPtr->template doReadFieldsFrom<TIdx>(iter, size);
+        lazyData_.clear();
+        return lazyStatus_;
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus doRead(TIter& iter, std::size_t size)
+    {
+        lazyPending_ = false;
+        lazyStatus_ = comms::ErrorStatus::Success;
+        lazyData_.clear();
+        auto es = BaseImpl::template doReadFieldsUntil<TIdx>(iter, size);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        if (size < BaseImpl::template doMinLengthFrom<TIdx>()) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        auto len = std::min(size, BaseImpl::template doMaxLengthFrom<TIdx>());
+        lazyData_.reserve(len);
+        std::copy_n(iter, len, std::back_inserter(lazyData_));
+        std::advance(iter, len);
+        lazyPending_ = true;
+        return comms::ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus doWrite(
+        TIter& iter,
+        std::size_t size) const
+    {
+        if (!lazyPending_) {
+            return BaseImpl::doWrite(iter, size);
+        }
+
+        if (size < doLength()) {
+            return comms::ErrorStatus::BufferOverflow;
+        }
+
+        BaseImpl::template doWriteFieldsNoStatusUntil<TIdx>(iter);
+        iter = std::copy(lazyData_.begin(), lazyData_.end(), iter);
+        return comms::ErrorStatus::Success;
+    }
+
+    bool doValid() const
+    {
+        if (decodeLazyFields() != comms::ErrorStatus::Success) {
+            return false;
+        }
+
+        return BaseImpl::doValid();
+    }
+
+    std::size_t doLength() const
+    {
+        if (!lazyPending_) {
+            return BaseImpl::doLength();
+        }
+
+        return BaseImpl::template doLengthUntil<TIdx>() + lazyData_.size();
+    }
+
+    bool doRefresh() const
+    {
+        decodeLazyFields();
+        return BaseImpl::doRefresh();
+    }
+
+protected:
+    ~MessageImplLazyFieldsBase() noexcept = default;
+
+private:
+    mutable std::vector<std::uint8_t> lazyData_;
+    mutable bool lazyPending_ = false;
+    mutable comms::ErrorStatus lazyStatus_ = comms::ErrorStatus::Success;
+};
+
+template <bool THasLazyFields>
+struct MessageImplProcessLazyFieldsBase;
+
+template <>
+struct MessageImplProcessLazyFieldsBase<true>
+{
+    template <typename TBase, typename TOpt>
+    using Type = MessageImplLazyFieldsBase<TBase, TOpt::LazyFieldsFromIdx>;
+};
+
+template <>
+struct MessageImplProcessLazyFieldsBase<false>
+{
+    template <typename TBase, typename TOpt>
+    using Type = TBase;
+};
+
+template <typename TBase, typename TOpt>
+using MessageImplLazyFieldsBaseT =
+    typename MessageImplProcessLazyFieldsBase<
+        TOpt::HasFieldsImpl && TOpt::HasLazyFieldsFrom
+    >::template Type<TBase, TOpt>;
+
 template <typename TBase, typename TActual = void>
 class MessageImplFieldsReadImplBase : public TBase
 {
@@ -1106,7 +1254,8 @@ class MessageImplBuilder
     using InterfaceOptions = typename TMessage::InterfaceOptions;
 
     using FieldsBase = MessageImplFieldsBaseT<TMessage, ParsedOptions>;
-    using StaticNumIdBase = MessageImplStaticNumIdBaseT<FieldsBase, ParsedOptions>;
+    using LazyFieldsBase = MessageImplLazyFieldsBaseT<FieldsBase, ParsedOptions>;
+    using StaticNumIdBase = MessageImplStaticNumIdBaseT<LazyFieldsBase, ParsedOptions>;
     using PolymorphicStaticNumIdBase = MessageImplPolymorhpicStaticNumIdBaseT<StaticNumIdBase, ParsedOptions>;
     using NoIdBase = MessageImplNoIdBaseT<PolymorphicStaticNumIdBase, ParsedOptions>;
     using FieldsReadImplBase = MessageImplFieldsReadImplBaseT<NoIdBase, ParsedOptions>;
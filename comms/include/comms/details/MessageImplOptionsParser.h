@@ -44,6 +44,9 @@ public:
     static const bool HasNoValidImpl = false;
     static const bool HasDoRefresh = false;
     static const bool HasDoGetId = false;
+    static const bool HasDiscriminatorField = false;
+    static const bool HasDiscriminatorLengthRange = false;
+    static const bool HasLazyFieldsFrom = false;
 };
 
 template <std::intmax_t TId,
@@ -156,6 +159,57 @@ public:
     static const bool HasDoGetId = true;
 };
 
+template <std::size_t TOffset,
+          typename TField,
+          std::intmax_t TValue,
+          typename... TOptions>
+class MessageImplOptionsParser<
+    comms::option::DiscriminatorField<TOffset, TField, TValue>,
+    TOptions...> : public MessageImplOptionsParser<TOptions...>
+{
+    using BaseImpl = MessageImplOptionsParser<TOptions...>;
+
+    static_assert(!BaseImpl::HasDiscriminatorField,
+        "comms::option::DiscriminatorField option is used more than once");
+public:
+    static const bool HasDiscriminatorField = true;
+    static const std::size_t DiscriminatorOffset = TOffset;
+    using DiscriminatorField = TField;
+    static const std::intmax_t DiscriminatorValue = TValue;
+};
+
+template <std::size_t TMin,
+          std::size_t TMax,
+          typename... TOptions>
+class MessageImplOptionsParser<
+    comms::option::DiscriminatorLengthRange<TMin, TMax>,
+    TOptions...> : public MessageImplOptionsParser<TOptions...>
+{
+    using BaseImpl = MessageImplOptionsParser<TOptions...>;
+
+    static_assert(!BaseImpl::HasDiscriminatorLengthRange,
+        "comms::option::DiscriminatorLengthRange option is used more than once");
+public:
+    static const bool HasDiscriminatorLengthRange = true;
+    static const std::size_t DiscriminatorMinLength = TMin;
+    static const std::size_t DiscriminatorMaxLength = TMax;
+};
+
+template <std::size_t TIdx,
+          typename... TOptions>
+class MessageImplOptionsParser<
+    comms::option::LazyFieldsFrom<TIdx>,
+    TOptions...> : public MessageImplOptionsParser<TOptions...>
+{
+    using BaseImpl = MessageImplOptionsParser<TOptions...>;
+
+    static_assert(!BaseImpl::HasLazyFieldsFrom,
+        "comms::option::LazyFieldsFrom option is used more than once");
+public:
+    static const bool HasLazyFieldsFrom = true;
+    static const std::size_t LazyFieldsFromIdx = TIdx;
+};
+
 template <typename TMsgType,
           typename... TOptions>
 class MessageImplOptionsParser<
@@ -0,0 +1,437 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <tuple>
+#include <vector>
+#include <iterator>
+
+#include "comms/Assert.h"
+#include "comms/ErrorStatus.h"
+#include "comms/field/tag.h"
+
+namespace comms
+{
+
+template <typename TElem>
+class MsgSequenceColumn;
+
+namespace details
+{
+
+template <typename TTag>
+struct MsgColumnIsScalarTag
+{
+    static const bool Value =
+        std::is_same<TTag, comms::field::tag::Int>::value ||
+        std::is_same<TTag, comms::field::tag::Enum>::value ||
+        std::is_same<TTag, comms::field::tag::Float>::value ||
+        std::is_same<TTag, comms::field::tag::Bitmask>::value;
+};
+
+template <typename TField>
+constexpr bool msgColumnIsScalar()
+{
+    return MsgColumnIsScalarTag<typename TField::Tag>::Value;
+}
+
+// The sequence, which serialisation is either the elements until the end of
+// the data or the elements prefixed with their number, can be read directly
+// into the column.
+template <typename TField>
+struct MsgColumnIsDirectSequence
+{
+    using Opts = typename TField::ParsedOptions;
+    static const bool Value =
+        (!Opts::HasCustomValueReader) &&
+        (!Opts::HasSerOffset) &&
+        (!Opts::HasFixedLengthLimit) &&
+        (!Opts::HasVarLengthLimits) &&
+        (!Opts::HasSequenceElemLengthForcing) &&
+        (!Opts::HasSequenceSizeForcing) &&
+        (!Opts::HasSequenceFixedSize) &&
+        (!Opts::HasSequenceSerLengthFieldPrefix) &&
+        (!Opts::HasSequenceTrailingFieldSuffix) &&
+        (!Opts::HasSequenceTerminationFieldSuffix) &&
+        (!Opts::HasFailOnInvalid) &&
+        (!Opts::HasIgnoreInvalid) &&
+        (!Opts::HasEmptySerialization);
+};
+
+template <typename TField>
+struct MsgColumnSequenceCount
+{
+    struct PrefixTag {};
+    struct NoPrefixTag {};
+
+    using Tag =
+        typename std::conditional<
+            TField::ParsedOptions::HasSequenceSizeFieldPrefix,
+            PrefixTag,
+            NoPrefixTag
+        >::type;
+
+    // Reads the number of elements prefix if such exists, the count is
+    // left unchanged otherwise.
+    template <typename TIter>
+    static comms::ErrorStatus read(std::size_t& count, TIter& iter, std::size_t& len)
+    {
+        return read(count, iter, len, Tag());
+    }
+
+private:
+    template <typename TIter>
+    static comms::ErrorStatus read(std::size_t&, TIter&, std::size_t&, NoPrefixTag)
+    {
+        return comms::ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus read(std::size_t& count, TIter& iter, std::size_t& len, PrefixTag)
+    {
+        using SizeField = typename TField::ParsedOptions::SequenceSizeFieldPrefix;
+        SizeField sizeField;
+        auto es = sizeField.read(iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        count = static_cast<std::size_t>(sizeField.value());
+        len -= sizeField.length();
+        return es;
+    }
+};
+
+template <typename TField, typename TTag = typename TField::Tag, typename = void>
+struct MsgColumnSelector;
+
+// Reads the field as a whole and appends its value to the column.
+template <typename TField, typename TColumn>
+struct MsgColumnFieldReader
+{
+    template <typename TIter>
+    static comms::ErrorStatus read(TColumn& column, TIter& iter, std::size_t& len)
+    {
+        TField field;
+        auto es = field.read(iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        GASSERT(field.length() <= len);
+        len -= field.length();
+        MsgColumnSelector<TField>::append(column, field);
+        return es;
+    }
+};
+
+template <typename TField, typename TTag, typename>
+struct MsgColumnSelector
+{
+    using Type = std::vector<TField>;
+
+    static void append(Type& column, const TField& field)
+    {
+        column.push_back(field);
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus read(Type& column, TIter& iter, std::size_t& len)
+    {
+        column.emplace_back();
+        auto& field = column.back();
+        auto es = field.read(iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            column.pop_back();
+            return es;
+        }
+
+        GASSERT(field.length() <= len);
+        len -= field.length();
+        return es;
+    }
+
+    static void truncate(Type& column, std::size_t rows)
+    {
+        column.erase(column.begin() + static_cast<std::ptrdiff_t>(rows), column.end());
+    }
+};
+
+template <typename TField, typename TTag>
+struct MsgColumnSelector<TField, TTag, typename std::enable_if<MsgColumnIsScalarTag<TTag>::Value>::type>
+{
+    using Type = std::vector<typename TField::ValueType>;
+
+    static void append(Type& column, const TField& field)
+    {
+        column.push_back(field.value());
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus read(Type& column, TIter& iter, std::size_t& len)
+    {
+        return MsgColumnFieldReader<TField, Type>::read(column, iter, len);
+    }
+
+    static void truncate(Type& column, std::size_t rows)
+    {
+        column.resize(rows);
+    }
+};
+
+template <typename TField, typename TTag>
+struct MsgColumnSelector<
+    TField,
+    TTag,
+    typename std::enable_if<
+        std::is_same<TTag, comms::field::tag::String>::value ||
+        std::is_same<TTag, comms::field::tag::RawArrayList>::value
+    >::type>
+{
+    using ElemType =
+        typename std::decay<decltype(*std::declval<const typename TField::ValueType&>().cbegin())>::type;
+    using Type = comms::MsgSequenceColumn<ElemType>;
+
+    static void append(Type& column, const TField& field)
+    {
+        auto& value = field.value();
+        column.addRow(value.cbegin(), value.cend());
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus read(Type& column, TIter& iter, std::size_t& len)
+    {
+        using Tag =
+            typename std::conditional<
+                MsgColumnIsDirectSequence<TField>::Value,
+                DirectTag,
+                FieldTag
+            >::type;
+        return read(column, iter, len, Tag());
+    }
+
+    static void truncate(Type& column, std::size_t rows)
+    {
+        column.truncate(rows);
+    }
+
+private:
+    struct DirectTag {};
+    struct FieldTag {};
+
+    template <typename TIter>
+    static comms::ErrorStatus read(Type& column, TIter& iter, std::size_t& len, FieldTag)
+    {
+        return MsgColumnFieldReader<TField, Type>::read(column, iter, len);
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus read(Type& column, TIter& iter, std::size_t& len, DirectTag)
+    {
+        auto count = len;
+        auto es = MsgColumnSequenceCount<TField>::read(count, iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        if (len < count) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        auto from = iter;
+        std::advance(iter, count);
+        column.addRow(from, iter);
+        len -= count;
+        return es;
+    }
+};
+
+template <typename TField>
+struct MsgColumnSelector<TField, comms::field::tag::ArrayList, void>
+{
+    using ElemField =
+        typename std::decay<decltype(*std::declval<const typename TField::ValueType&>().cbegin())>::type;
+
+    struct ScalarTag {};
+    struct FieldTag {};
+
+    using Tag =
+        typename std::conditional<
+            msgColumnIsScalar<ElemField>(),
+            ScalarTag,
+            FieldTag
+        >::type;
+
+    template <typename TElemField, typename TTag>
+    struct ElemTypeHelper
+    {
+        using Type = TElemField;
+    };
+
+    template <typename TElemField>
+    struct ElemTypeHelper<TElemField, ScalarTag>
+    {
+        using Type = typename TElemField::ValueType;
+    };
+
+    using Type = comms::MsgSequenceColumn<typename ElemTypeHelper<ElemField, Tag>::Type>;
+
+    static void append(Type& column, const TField& field)
+    {
+        column.addRow();
+        for (auto& elem : field.value()) {
+            addElem(column, elem, Tag());
+        }
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus read(Type& column, TIter& iter, std::size_t& len)
+    {
+        using ReadTag =
+            typename std::conditional<
+                MsgColumnIsDirectSequence<TField>::Value,
+                DirectReadTag,
+                FieldReadTag
+            >::type;
+        return read(column, iter, len, ReadTag());
+    }
+
+    static void truncate(Type& column, std::size_t rows)
+    {
+        column.truncate(rows);
+    }
+
+private:
+    struct DirectReadTag {};
+    struct FieldReadTag {};
+    struct CountedTag {};
+    struct UntilEndTag {};
+
+    static void addElem(Type& column, const ElemField& elem, ScalarTag)
+    {
+        column.addValue(elem.value());
+    }
+
+    static void addElem(Type& column, const ElemField& elem, FieldTag)
+    {
+        column.addValue(elem);
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus read(Type& column, TIter& iter, std::size_t& len, FieldReadTag)
+    {
+        return MsgColumnFieldReader<TField, Type>::read(column, iter, len);
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus read(Type& column, TIter& iter, std::size_t& len, DirectReadTag)
+    {
+        using CountTag =
+            typename std::conditional<
+                TField::ParsedOptions::HasSequenceSizeFieldPrefix,
+                CountedTag,
+                UntilEndTag
+            >::type;
+
+        std::size_t count = 0U;
+        auto es = MsgColumnSequenceCount<TField>::read(count, iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        column.addRow();
+        return readElems(column, count, iter, len, CountTag());
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus readElems(Type& column, std::size_t count, TIter& iter, std::size_t& len, CountedTag)
+    {
+        for (auto idx = 0U; idx < count; ++idx) {
+            auto es = readElem(column, iter, len);
+            if (es != comms::ErrorStatus::Success) {
+                return es;
+            }
+        }
+        return comms::ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus readElems(Type& column, std::size_t, TIter& iter, std::size_t& len, UntilEndTag)
+    {
+        while (0U < len) {
+            auto es = readElem(column, iter, len);
+            if (es != comms::ErrorStatus::Success) {
+                return es;
+            }
+        }
+        return comms::ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus readElem(Type& column, TIter& iter, std::size_t& len)
+    {
+        ElemField elem;
+        auto es = elem.read(iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        GASSERT(elem.length() <= len);
+        len -= elem.length();
+        addElem(column, elem, Tag());
+        return es;
+    }
+};
+
+// Detects doRead() member function declared by the message class itself
+// rather than inherited from comms::MessageBase.
+template <typename TMsg, typename TIter>
+class MsgColumnsHasCustomRead
+{
+protected:
+  typedef char Yes;
+  typedef unsigned No;
+
+  template <typename U, U>
+  struct ReallyHas;
+
+  template <typename C>
+  static Yes test(ReallyHas<comms::ErrorStatus (C::*)(TIter&, std::size_t), &C::template doRead<TIter> >*);
+  template <typename>
+  static No test(...);
+
+public:
+    static const bool Value = (sizeof(test<TMsg>(nullptr)) == sizeof(Yes));
+};
+
+template <typename TFields>
+struct MsgColumnsTuple;
+
+template <typename... TFields>
+struct MsgColumnsTuple<std::tuple<TFields...> >
+{
+    using Type = std::tuple<typename MsgColumnSelector<TFields>::Type...>;
+};
+
+}  // namespace details
+
+}  // namespace comms
+
@@ -73,7 +73,17 @@ struct AllMessagesRetrieveHelper<false>
 
 template <typename TAll, typename TOpt>
 using AllMessagesBundle =
-    typename AllMessagesRetrieveHelper<TOpt::HasInPlaceAllocation && TOpt::HasSupportGenericMessage>::template Type<TAll, TOpt>;
+    typename AllMessagesRetrieveHelper<
+        (TOpt::HasInPlaceAllocation || TOpt::HasRecycleAllocation) && TOpt::HasSupportGenericMessage
+    >::template Type<TAll, TOpt>;
+
+template <typename TMsgBase, typename TAll, typename TOpt>
+using MsgFactoryDynAlloc =
+    typename std::conditional<
+        TOpt::HasRecycleAllocation,
+        util::alloc::DynMemoryRecycle<TMsgBase, TAll, TOpt::MaxCachedMessages>,
+        util::alloc::DynMemory<TMsgBase>
+    >::type;
 
 template <typename TMsgBase, typename TAllMessages, typename... TOptions>
 class MsgFactoryBase
@@ -88,7 +98,7 @@ class MsgFactoryBase
         typename std::conditional<
             ParsedOptionsInternal::HasInPlaceAllocation,
             util::alloc::InPlaceSingle<TMsgBase, AllMessagesInternal>,
-            util::alloc::DynMemory<TMsgBase>
+            MsgFactoryDynAlloc<TMsgBase, AllMessagesInternal, ParsedOptionsInternal>
         >::type;
 public:
     using ParsedOptions = ParsedOptionsInternal;
@@ -196,7 +206,7 @@ protected:
             "TObj is not a proper message type");
 
         static_assert(
-            (!ParsedOptionsInternal::HasInPlaceAllocation) ||
+            ((!ParsedOptionsInternal::HasInPlaceAllocation) && (!ParsedOptionsInternal::HasRecycleAllocation)) ||
                     comms::util::IsInTuple<TObj, AllMessagesInternal>::Value,
             "TObj must be in provided tuple of supported messages");
 
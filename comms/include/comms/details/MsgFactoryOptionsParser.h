@@ -34,16 +34,35 @@ class MsgFactoryOptionsParser<>
 public:
     static const bool HasInPlaceAllocation = false;
     static const bool HasSupportGenericMessage = false;
+    static const bool HasRecycleAllocation = false;
+    static const std::size_t MaxCachedMessages = 0U;
 };
 
 template <typename... TOptions>
 class MsgFactoryOptionsParser<comms::option::InPlaceAllocation, TOptions...> :
         public MsgFactoryOptionsParser<TOptions...>
 {
+    using BaseImpl = MsgFactoryOptionsParser<TOptions...>;
+
+    static_assert(!BaseImpl::HasRecycleAllocation,
+        "comms::option::InPlaceAllocation and comms::option::RecycleAllocation options cannot be used together");
 public:
     static const bool HasInPlaceAllocation = true;
 };
 
+template <std::size_t TMaxCached, typename... TOptions>
+class MsgFactoryOptionsParser<comms::option::RecycleAllocation<TMaxCached>, TOptions...> :
+        public MsgFactoryOptionsParser<TOptions...>
+{
+    using BaseImpl = MsgFactoryOptionsParser<TOptions...>;
+
+    static_assert(!BaseImpl::HasInPlaceAllocation,
+        "comms::option::InPlaceAllocation and comms::option::RecycleAllocation options cannot be used together");
+public:
+    static const bool HasRecycleAllocation = true;
+    static const std::size_t MaxCachedMessages = TMaxCached;
+};
+
 template <typename TMsg, typename... TOptions>
 class MsgFactoryOptionsParser<comms::option::SupportGenericMessage<TMsg>, TOptions...> :
         public MsgFactoryOptionsParser<TOptions...>
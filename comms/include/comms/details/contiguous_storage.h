@@ -0,0 +1,87 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <string>
+#include <type_traits>
+
+#include "comms/util/StaticVector.h"
+#include "comms/util/StaticString.h"
+#include "comms/util/ArrayView.h"
+#include "comms/util/StringView.h"
+
+namespace comms
+{
+
+namespace details
+{
+
+template <typename T>
+struct IsContiguousStorage
+{
+    static const bool Value = false;
+};
+
+template <typename T, typename TAlloc>
+struct IsContiguousStorage<std::vector<T, TAlloc> >
+{
+    static const bool Value = true;
+};
+
+template <typename TChar, typename TTraits, typename TAlloc>
+struct IsContiguousStorage<std::basic_string<TChar, TTraits, TAlloc> >
+{
+    static const bool Value = true;
+};
+
+template <typename T, std::size_t TSize>
+struct IsContiguousStorage<comms::util::StaticVector<T, TSize> >
+{
+    static const bool Value = true;
+};
+
+template <std::size_t TSize, typename TChar>
+struct IsContiguousStorage<comms::util::StaticString<TSize, TChar> >
+{
+    static const bool Value = true;
+};
+
+template <typename T>
+struct IsContiguousStorage<comms::util::ArrayView<T> >
+{
+    static const bool Value = true;
+};
+
+template <>
+struct IsContiguousStorage<comms::util::StringView>
+{
+    static const bool Value = true;
+};
+
+template <typename T>
+constexpr bool isContiguousStorage()
+{
+    return IsContiguousStorage<typename std::decay<T>::type>::Value;
+}
+
+} // namespace details
+
+} // namespace comms
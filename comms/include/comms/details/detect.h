@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
@@ -156,6 +158,65 @@ constexpr bool hasRemoveSuffixFunc()
     return HasRemoveSuffixFunc<T>::Value;
 }
 
+template <typename T>
+class HasWriteRefFunc
+{
+protected:
+  typedef char Yes;
+  typedef unsigned No;
+
+  template <typename U, U>
+  struct ReallyHas;
+
+  template <typename C>
+  static Yes test(ReallyHas<void (C::*)(const std::uint8_t*, std::size_t), &C::writeRef>*);
+  template <typename>
+  static No test(...);
+
+public:
+    static const bool Value = (sizeof(test<T>(nullptr)) == sizeof(Yes));
+};
+
+/// Write iterators providing writeRef() member function (such as
+/// comms::util::GatherBuffer::WriteIterator) accept the raw data
+/// sequences by reference.
+template <typename T>
+constexpr bool hasWriteRefFunc()
+{
+    return HasWriteRefFunc<typename std::decay<T>::type>::Value;
+}
+
+template <typename T>
+class HasRunDataFunc
+{
+protected:
+  typedef char Yes;
+  typedef unsigned No;
+
+  template <typename U, U>
+  struct ReallyHas;
+
+  template <typename C>
+  static Yes test(
+      ReallyHas<const std::uint8_t* (C::*)() const, &C::runData>*,
+      ReallyHas<std::size_t (C::*)() const, &C::runLength>*);
+  template <typename>
+  static No test(...);
+
+public:
+    static const bool Value = (sizeof(test<T>(nullptr, nullptr)) == sizeof(Yes));
+};
+
+/// Read iterators over a chain of data chunks (such as
+/// comms::util::SegmentedBuffer::Iterator) providing runData() and
+/// runLength() member functions expose the contiguous run of bytes
+/// starting at the current position.
+template <typename T>
+constexpr bool hasRunDataFunc()
+{
+    return HasRunDataFunc<typename std::decay<T>::type>::Value;
+}
+
 } // namespace details
 
 } // namespace comms
@@ -0,0 +1,198 @@
+//
+// Copyright    2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include "comms/ErrorStatus.h"
+#include "comms/field/OptionalMode.h"
+
+namespace comms
+{
+
+namespace field
+{
+
+namespace adapter
+{
+
+template <typename TBase>
+class CachedLength : public TBase
+{
+    using BaseImpl = TBase;
+public:
+
+    using ValueType = typename BaseImpl::ValueType;
+
+    CachedLength() = default;
+
+    explicit CachedLength(const ValueType& val)
+      : BaseImpl(val)
+    {
+    }
+
+    explicit CachedLength(ValueType&& val)
+      : BaseImpl(std::move(val))
+    {
+    }
+
+    CachedLength(const CachedLength&) = default;
+    CachedLength(CachedLength&&) = default;
+    CachedLength& operator=(const CachedLength&) = default;
+    CachedLength& operator=(CachedLength&&) = default;
+
+    ValueType& value()
+    {
+        invalidateLength();
+        return BaseImpl::value();
+    }
+
+    const ValueType& value() const
+    {
+        return BaseImpl::value();
+    }
+
+    std::size_t length() const
+    {
+        if (cachedLength_ == NoLength) {
+            cachedLength_ = BaseImpl::length();
+        }
+        return cachedLength_;
+    }
+
+    bool refresh()
+    {
+        invalidateLength();
+        return BaseImpl::refresh();
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus read(TIter& iter, std::size_t len)
+    {
+        invalidateLength();
+        return BaseImpl::read(iter, len);
+    }
+
+    template <typename TIter>
+    void readNoStatus(TIter& iter)
+    {
+        invalidateLength();
+        BaseImpl::readNoStatus(iter);
+    }
+
+    template <typename TIter>
+    comms::ErrorStatus readN(std::size_t count, TIter& iter, std::size_t& len)
+    {
+        invalidateLength();
+        return BaseImpl::readN(count, iter, len);
+    }
+
+    template <typename TIter>
+    void readNoStatusN(std::size_t count, TIter& iter)
+    {
+        invalidateLength();
+        BaseImpl::readNoStatusN(count, iter);
+    }
+
+    template <typename TBaseImpl = BaseImpl>
+    auto field() -> decltype(std::declval<TBaseImpl&>().field())
+    {
+        invalidateLength();
+        return BaseImpl::field();
+    }
+
+    template <typename TBaseImpl = BaseImpl>
+    auto field() const -> decltype(std::declval<const TBaseImpl&>().field())
+    {
+        return BaseImpl::field();
+    }
+
+    void setMode(comms::field::OptionalMode val)
+    {
+        invalidateLength();
+        BaseImpl::setMode(val);
+    }
+
+    void selectField(std::size_t idx)
+    {
+        invalidateLength();
+        BaseImpl::selectField(idx);
+    }
+
+    template <typename TFunc>
+    void currentFieldExec(TFunc&& func)
+    {
+        invalidateLength();
+        BaseImpl::currentFieldExec(std::forward<TFunc>(func));
+    }
+
+    template <typename TFunc>
+    void currentFieldExec(TFunc&& func) const
+    {
+        BaseImpl::currentFieldExec(std::forward<TFunc>(func));
+    }
+
+    template <std::size_t TIdx, typename... TArgs>
+    auto initField(TArgs&&... args) ->
+        decltype(std::declval<BaseImpl&>().template initField<TIdx>(std::forward<TArgs>(args)...))
+    {
+        invalidateLength();
+        return BaseImpl::template initField<TIdx>(std::forward<TArgs>(args)...);
+    }
+
+    template <std::size_t TIdx>
+    auto accessField() -> decltype(std::declval<BaseImpl&>().template accessField<TIdx>())
+    {
+        invalidateLength();
+        return BaseImpl::template accessField<TIdx>();
+    }
+
+    template <std::size_t TIdx>
+    auto accessField() const -> decltype(std::declval<const BaseImpl&>().template accessField<TIdx>())
+    {
+        return BaseImpl::template accessField<TIdx>();
+    }
+
+    void reset()
+    {
+        invalidateLength();
+        BaseImpl::reset();
+    }
+
+private:
+    static const std::size_t NoLength = std::numeric_limits<std::size_t>::max();
+
+    void invalidateLength()
+    {
+        cachedLength_ = NoLength;
+    }
+
+    mutable std::size_t cachedLength_ = NoLength;
+};
+
+}  // namespace adapter
+
+}  // namespace field
+
+}  // namespace comms
+
+
@@ -18,8 +18,14 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <iterator>
+
 #include "comms/Assert.h"
 #include "comms/ErrorStatus.h"
+#include "comms/field/tag.h"
 
 namespace comms
 {
@@ -148,11 +154,54 @@ private:
     template <typename TIter>
     comms::ErrorStatus readInternal(TIter& iter, std::size_t len, RawDataTag)
     {
-        TermField termField;
+        using SearchTag =
+            typename std::conditional<
+                isMemSearchable<TIter>(),
+                MemSearchTag,
+                StepSearchTag
+            >::type;
+
         std::size_t consumed = 0;
+        auto es = findTermination(iter, len, consumed, SearchTag());
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        es = BaseImpl::read(iter, consumed);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        std::advance(iter, TermField().length());
+        return comms::ErrorStatus::Success;
+    }
+
+    struct MemSearchTag {};
+    struct StepSearchTag {};
+
+    template <typename TIter>
+    static constexpr bool isMemSearchable()
+    {
+        return
+            std::is_pointer<TIter>::value &&
+            (sizeof(typename std::remove_pointer<TIter>::type) == sizeof(std::uint8_t)) &&
+            (std::is_same<typename TermField::Tag, comms::field::tag::Int>::value ||
+             std::is_same<typename TermField::Tag, comms::field::tag::Enum>::value) &&
+            (TermField::minLength() == TermField::maxLength());
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus findTermination(
+        TIter iter,
+        std::size_t len,
+        std::size_t& consumed,
+        StepSearchTag)
+    {
+        TermField termField;
+        consumed = 0;
         while (consumed < len) {
             auto iterCpy = iter + consumed;
-            auto es = termField.read(iterCpy, len);
+            auto es = termField.read(iterCpy, len - consumed);
             if ((es == comms::ErrorStatus::Success) &&
                 (termField == TermField())){
                 break;
@@ -165,13 +214,50 @@ private:
             return comms::ErrorStatus::NotEnoughData;
         }
 
-        auto es = BaseImpl::read(iter, consumed);
-        if (es != comms::ErrorStatus::Success) {
-            return es;
+        return comms::ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    static comms::ErrorStatus findTermination(
+        TIter iter,
+        std::size_t len,
+        std::size_t& consumed,
+        MemSearchTag)
+    {
+        static const std::size_t TermLen = TermField::minLength();
+        std::uint8_t pattern[TermLen] = {0};
+        auto* patternWriteIter = &pattern[0];
+        TermField termField;
+        termField.writeNoStatus(patternWriteIter);
+
+        // The default value must survive the serialisation round trip,
+        // otherwise the byte pattern doesn't identify the terminator.
+        const std::uint8_t* patternReadIter = &pattern[0];
+        auto es = termField.read(patternReadIter, TermLen);
+        if ((es != comms::ErrorStatus::Success) ||
+            (termField != TermField())) {
+            return findTermination(iter, len, consumed, StepSearchTag());
         }
 
-        std::advance(iter, termField.length());
-        return comms::ErrorStatus::Success;
+        auto* begin = static_cast<const std::uint8_t*>(static_cast<const void*>(iter));
+        auto* end = begin + len;
+        auto* cur = begin;
+        while (TermLen <= static_cast<std::size_t>(end - cur)) {
+            auto searchLen = static_cast<std::size_t>(end - cur) - (TermLen - 1);
+            auto* found = static_cast<const std::uint8_t*>(std::memchr(cur, pattern[0], searchLen));
+            if (found == nullptr) {
+                break;
+            }
+
+            if (std::memcmp(found + 1, &pattern[1], TermLen - 1) == 0) {
+                consumed = static_cast<std::size_t>(found - begin);
+                return comms::ErrorStatus::Success;
+            }
+
+            cur = found + 1;
+        }
+
+        return comms::ErrorStatus::NotEnoughData;
     }
 
 };
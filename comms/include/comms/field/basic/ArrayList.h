@@ -29,6 +29,7 @@
 #include "comms/util/StaticVector.h"
 #include "comms/util/StaticString.h"
 #include "comms/details/detect.h"
+#include "comms/details/contiguous_storage.h"
 
 namespace comms
 {
@@ -239,7 +240,7 @@ public:
         using Tag =
             typename std::conditional<
                 IsRandomAccessIter && IsRawData,
-                RawDataTag,
+                RawReadTag<TIter>,
                 FieldElemTag
             >::type;
 
@@ -263,7 +264,7 @@ public:
         using Tag =
             typename std::conditional<
                 IsRandomAccessIter && IsRawData,
-                RawDataTag,
+                RawReadTag<TIter>,
                 FieldElemTag
             >::type;
 
@@ -284,7 +285,7 @@ public:
         using Tag =
             typename std::conditional<
                 IsRandomAccessIter && IsRawData,
-                RawDataTag,
+                RawReadTag<TIter>,
                 FieldElemTag
             >::type;
 
@@ -306,66 +307,25 @@ public:
     template <typename TIter>
     ErrorStatus write(TIter& iter, std::size_t len) const
     {
-        if (len < length()) {
-            return ErrorStatus::BufferOverflow;
-        }
-
-        auto es = ErrorStatus::Success;
-        auto remainingLen = len;
-        for (auto fieldIter = value_.begin(); fieldIter != value_.end(); ++fieldIter) {
-            es = writeElement(*fieldIter, iter, remainingLen);
-            if (es != ErrorStatus::Success) {
-                break;
-            }
-        }
-
-        return es;
+        return writeInternal(iter, len, WriteTag<TIter>());
     }
 
     template <typename TIter>
     void writeNoStatus(TIter& iter) const
     {
-        for (auto fieldIter = value_.begin(); fieldIter != value_.end(); ++fieldIter) {
-            writeElementNoStatus(*fieldIter, iter);
-        }
+        writeNoStatusInternal(iter, WriteTag<TIter>());
     }
 
     template <typename TIter>
     ErrorStatus writeN(std::size_t count, TIter& iter, std::size_t& len) const
     {
-        if ((value_.size() <= count) && (len < length())) {
-            return ErrorStatus::BufferOverflow;
-        }
-
-        auto es = ErrorStatus::Success;
-        for (auto fieldIter = value_.begin(); fieldIter != value_.end(); ++fieldIter) {
-            if (count == 0) {
-                break;
-            }
-
-            es = writeElement(*fieldIter, iter, len);
-            if (es != ErrorStatus::Success) {
-                break;
-            }
-
-            --count;
-        }
-
-        return es;
+        return writeInternalN(count, iter, len, WriteTag<TIter>());
     }
 
-
     template <typename TIter>
     void writeNoStatusN(std::size_t count, TIter& iter) const
     {
-        for (auto fieldIter = value_.begin(); fieldIter != value_.end(); ++fieldIter) {
-            if (count == 0) {
-                break;
-            }
-
-            writeElementNoStatus(*fieldIter, iter);
-            --count;
-        }
+        writeNoStatusInternalN(count, iter, WriteTag<TIter>());
     }
 
 private:
@@ -374,8 +334,12 @@ private:
     struct FixedLengthTag {};
     struct VarLengthTag {};
     struct RawDataTag {};
+    struct SegmentedDataTag {};
+    struct GatherWriteTag {};
     struct AssignExistsTag {};
     struct AssignMissingTag {};
+    struct ReserveExistsTag {};
+    struct ReserveMissingTag {};
 
     using ElemTag = typename std::conditional<
         std::is_integral<ElementType>::value,
@@ -389,6 +353,23 @@ private:
         FixedLengthTag
     >::type;
 
+    template <typename TIter>
+    using RawReadTag = typename std::conditional<
+        comms::details::hasRunDataFunc<TIter>(),
+        SegmentedDataTag,
+        RawDataTag
+    >::type;
+
+    template <typename TIter>
+    using WriteTag = typename std::conditional<
+        std::is_integral<ElementType>::value &&
+            (sizeof(ElementType) == sizeof(std::uint8_t)) &&
+            comms::details::isContiguousStorage<ValueType>() &&
+            comms::details::hasWriteRefFunc<TIter>(),
+        GatherWriteTag,
+        FieldElemTag
+    >::type;
+
     constexpr std::size_t lengthInternal(FieldElemTag) const
     {
         return fieldLength(FieldLengthTag());
@@ -602,6 +583,111 @@ private:
         return elem.length();
     }
 
+    template <typename TIter>
+    ErrorStatus writeInternal(TIter& iter, std::size_t len, FieldElemTag) const
+    {
+        if (len < length()) {
+            return ErrorStatus::BufferOverflow;
+        }
+
+        auto es = ErrorStatus::Success;
+        auto remainingLen = len;
+        for (auto fieldIter = value_.begin(); fieldIter != value_.end(); ++fieldIter) {
+            es = writeElement(*fieldIter, iter, remainingLen);
+            if (es != ErrorStatus::Success) {
+                break;
+            }
+        }
+
+        return es;
+    }
+
+    template <typename TIter>
+    void writeNoStatusInternal(TIter& iter, FieldElemTag) const
+    {
+        for (auto fieldIter = value_.begin(); fieldIter != value_.end(); ++fieldIter) {
+            writeElementNoStatus(*fieldIter, iter);
+        }
+    }
+
+    template <typename TIter>
+    ErrorStatus writeInternalN(std::size_t count, TIter& iter, std::size_t& len, FieldElemTag) const
+    {
+        if ((value_.size() <= count) && (len < length())) {
+            return ErrorStatus::BufferOverflow;
+        }
+
+        auto es = ErrorStatus::Success;
+        for (auto fieldIter = value_.begin(); fieldIter != value_.end(); ++fieldIter) {
+            if (count == 0) {
+                break;
+            }
+
+            es = writeElement(*fieldIter, iter, len);
+            if (es != ErrorStatus::Success) {
+                break;
+            }
+
+            --count;
+        }
+
+        return es;
+    }
+
+    template <typename TIter>
+    void writeNoStatusInternalN(std::size_t count, TIter& iter, FieldElemTag) const
+    {
+        for (auto fieldIter = value_.begin(); fieldIter != value_.end(); ++fieldIter) {
+            if (count == 0) {
+                break;
+            }
+
+            writeElementNoStatus(*fieldIter, iter);
+            --count;
+        }
+    }
+
+    template <typename TIter>
+    ErrorStatus writeInternal(TIter& iter, std::size_t len, GatherWriteTag) const
+    {
+        if (len < value_.size()) {
+            return ErrorStatus::BufferOverflow;
+        }
+
+        writeNoStatusInternal(iter, GatherWriteTag());
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    void writeNoStatusInternal(TIter& iter, GatherWriteTag) const
+    {
+        writeNoStatusInternalN(value_.size(), iter, GatherWriteTag());
+    }
+
+    template <typename TIter>
+    ErrorStatus writeInternalN(std::size_t count, TIter& iter, std::size_t& len, GatherWriteTag) const
+    {
+        count = std::min(count, static_cast<std::size_t>(value_.size()));
+        if (len < count) {
+            return ErrorStatus::BufferOverflow;
+        }
+
+        writeNoStatusInternalN(count, iter, GatherWriteTag());
+        len -= count;
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    void writeNoStatusInternalN(std::size_t count, TIter& iter, GatherWriteTag) const
+    {
+        count = std::min(count, static_cast<std::size_t>(value_.size()));
+        if (count == 0U) {
+            return;
+        }
+
+        iter.writeRef(reinterpret_cast<const std::uint8_t*>(&(*value_.begin())), count);
+    }
+
     template <typename TIter>
     ErrorStatus readInternal(TIter& iter, std::size_t len, FieldElemTag)
     {
@@ -636,6 +722,46 @@ private:
         return ErrorStatus::Success;
     }
 
+    template <typename TIter>
+    ErrorStatus readInternal(TIter& iter, std::size_t len, SegmentedDataTag)
+    {
+        if (len == 0U) {
+            value_ = ValueType();
+            return ErrorStatus::Success;
+        }
+
+        using Tag =
+            typename std::conditional<
+                details::vectorHasAssign<ValueType>(),
+                AssignExistsTag,
+                AssignMissingTag
+            >::type;
+
+        if (iter.runLength() < len) {
+            return doCopy(iter, len, Tag());
+        }
+
+        auto* data = reinterpret_cast<typename ValueType::const_pointer>(iter.runData());
+        doAssign(data, len, Tag());
+        iter += static_cast<typename TIter::difference_type>(len);
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    ErrorStatus doCopy(TIter& iter, std::size_t len, AssignExistsTag)
+    {
+        value_.assign(iter, iter + len);
+        std::advance(iter, len);
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    static ErrorStatus doCopy(TIter&, std::size_t, AssignMissingTag)
+    {
+        // The "view" cannot reference the data spread over multiple chunks
+        return ErrorStatus::NotSupported;
+    }
+
     template <typename TIter>
     void doAssign(TIter& iter, std::size_t len, AssignExistsTag) {
         value_.assign(iter, iter + len);
@@ -651,6 +777,13 @@ private:
     ErrorStatus readInternalN(std::size_t count, TIter& iter, std::size_t len, FieldElemTag)
     {
         clear();
+        // The count may come from the invalid data, don't reserve more
+        // elements than can possibly be read.
+        auto reserveCount = len;
+        if (0U < minElementLength()) {
+            reserveCount = len / minElementLength();
+        }
+        doReserve(std::min(count, reserveCount));
         while (0 < count) {
             auto elem = ElementType();
             auto es = readElement(elem, iter, len);
@@ -679,6 +812,7 @@ private:
     void readNoStatusInternalN(std::size_t count, TIter& iter, FieldElemTag)
     {
         clear();
+        doReserve(count);
         while (0 < count) {
             auto elem = ElementType();
             readElementNoStatus(elem, iter);
@@ -693,6 +827,42 @@ private:
         readInternal(iter, count, RawDataTag());
     }
 
+    template <typename TIter>
+    ErrorStatus readInternalN(std::size_t count, TIter& iter, std::size_t len, SegmentedDataTag)
+    {
+        if (len < count) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        return readInternal(iter, count, SegmentedDataTag());
+    }
+
+    template <typename TIter>
+    void readNoStatusInternalN(std::size_t count, TIter& iter, SegmentedDataTag)
+    {
+        readInternal(iter, count, SegmentedDataTag());
+    }
+
+    void doReserve(std::size_t count)
+    {
+        using Tag =
+            typename std::conditional<
+                comms::details::hasReserveFunc<ValueType>(),
+                ReserveExistsTag,
+                ReserveMissingTag
+            >::type;
+        doReserve(std::min(count, static_cast<std::size_t>(value_.max_size())), Tag());
+    }
+
+    void doReserve(std::size_t count, ReserveExistsTag)
+    {
+        value_.reserve(count);
+    }
+
+    static void doReserve(std::size_t, ReserveMissingTag)
+    {
+    }
+
     ValueType value_;
 };
 
@@ -29,6 +29,7 @@
 #include "comms/util/StaticVector.h"
 #include "comms/util/StaticString.h"
 #include "comms/details/detect.h"
+#include "comms/details/contiguous_storage.h"
 
 namespace comms
 {
@@ -231,31 +232,13 @@ public:
         static_assert(std::is_base_of<std::random_access_iterator_tag, IterCategory>::value,
             "Iterator for reading is expected to be random access one");
 
-        using ConstPointer = typename ValueType::const_pointer;
-        auto* str = reinterpret_cast<ConstPointer>(&(*iter));
-        doAdvance(iter, len);
-        auto* endStr = reinterpret_cast<ConstPointer>(&(*iter));
-        if (static_cast<std::size_t>(std::distance(str, endStr)) == len) {
-            using Tag =
-                typename std::conditional<
-                    details::stringHasAssign<ValueType>(),
-                    AssignExistsTag,
-                    AssignMissingTag
-                >::type;
-            doAssign(str, len, Tag());
-        }
-        else {
-            using Tag =
-                typename std::conditional<
-                    details::stringHasPushBack<ValueType>(),
-                    PushBackExistsTag,
-                    PushBackMissingTag
-                >::type;
-
-            doPushBack(str, len, Tag());
-        }
-
-        return ErrorStatus::Success;
+        using Tag =
+            typename std::conditional<
+                comms::details::hasRunDataFunc<TIter>(),
+                SegmentedReadTag,
+                ContiguousReadTag
+            >::type;
+        return readInternal(iter, len, Tag());
     }
 
     template <typename TIter>
@@ -309,8 +292,7 @@ public:
     template <typename TIter>
     void writeNoStatus(TIter& iter) const
     {
-        std::copy_n(value_.begin(), value_.size(), iter);
-        doAdvance(iter, value_.size());
+        doWrite(value_.size(), iter);
     }
 
     template <typename TIter>
@@ -330,8 +312,7 @@ public:
     void writeNoStatusN(std::size_t count, TIter& iter) const
     {
         count = std::min(count, value_.size());
-        std::copy_n(value_.begin(), count, iter);
-        doAdvance(iter, count);
+        doWrite(count, iter);
     }
 
 private:
@@ -343,6 +324,92 @@ private:
     struct ReserveMissingTag {};
     struct AdvancableTag {};
     struct NotAdvancableTag {};
+    struct CopyWriteTag {};
+    struct ContiguousReadTag {};
+    struct SegmentedReadTag {};
+    struct GatherWriteTag {};
+
+    template <typename TIter>
+    ErrorStatus readInternal(TIter& iter, std::size_t len, ContiguousReadTag)
+    {
+        using ConstPointer = typename ValueType::const_pointer;
+        auto* str = reinterpret_cast<ConstPointer>(&(*iter));
+        doAdvance(iter, len);
+        auto* endStr = reinterpret_cast<ConstPointer>(&(*iter));
+        if (static_cast<std::size_t>(std::distance(str, endStr)) == len) {
+            using Tag =
+                typename std::conditional<
+                    details::stringHasAssign<ValueType>(),
+                    AssignExistsTag,
+                    AssignMissingTag
+                >::type;
+            doAssign(str, len, Tag());
+        }
+        else {
+            using Tag =
+                typename std::conditional<
+                    details::stringHasPushBack<ValueType>(),
+                    PushBackExistsTag,
+                    PushBackMissingTag
+                >::type;
+
+            doPushBack(str, len, Tag());
+        }
+
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    ErrorStatus readInternal(TIter& iter, std::size_t len, SegmentedReadTag)
+    {
+        if (len == 0U) {
+            value_ = ValueType();
+            return ErrorStatus::Success;
+        }
+
+        if (iter.runLength() < len) {
+            using Tag =
+                typename std::conditional<
+                    details::stringHasPushBack<ValueType>(),
+                    PushBackExistsTag,
+                    PushBackMissingTag
+                >::type;
+
+            return doCopy(iter, len, Tag());
+        }
+
+        using ConstPointer = typename ValueType::const_pointer;
+        auto* str = reinterpret_cast<ConstPointer>(iter.runData());
+        iter += static_cast<typename TIter::difference_type>(len);
+
+        using Tag =
+            typename std::conditional<
+                details::stringHasAssign<ValueType>(),
+                AssignExistsTag,
+                AssignMissingTag
+            >::type;
+        doAssign(str, len, Tag());
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    ErrorStatus doCopy(TIter& iter, std::size_t len, PushBackExistsTag)
+    {
+        clear();
+        doReserve(len);
+        for (std::size_t idx = 0; idx < len; ++idx) {
+            value_.push_back(static_cast<ElementType>(*iter));
+            ++iter;
+        }
+        return ErrorStatus::Success;
+    }
+
+    template <typename TIter>
+    static ErrorStatus doCopy(TIter&, std::size_t, PushBackMissingTag)
+    {
+        // The "view" cannot reference the data spread over multiple chunks
+        return ErrorStatus::NotSupported;
+    }
 
     void doAssign(typename ValueType::const_pointer str, std::size_t len, AssignExistsTag)
     {
@@ -388,6 +455,36 @@ private:
     {
     }
 
+    template <typename TIter>
+    void doWrite(std::size_t count, TIter& iter) const
+    {
+        using Tag =
+            typename std::conditional<
+                comms::details::isContiguousStorage<ValueType>() &&
+                    comms::details::hasWriteRefFunc<TIter>(),
+                GatherWriteTag,
+                CopyWriteTag
+            >::type;
+        doWrite(count, iter, Tag());
+    }
+
+    template <typename TIter>
+    void doWrite(std::size_t count, TIter& iter, CopyWriteTag) const
+    {
+        std::copy_n(value_.begin(), count, iter);
+        doAdvance(iter, count);
+    }
+
+    template <typename TIter>
+    void doWrite(std::size_t count, TIter& iter, GatherWriteTag) const
+    {
+        if (count == 0U) {
+            return;
+        }
+
+        iter.writeRef(reinterpret_cast<const std::uint8_t*>(&(*value_.begin())), count);
+    }
+
     template <typename TIter>
     static void doAdvance(TIter& iter, std::size_t len)
     {
@@ -458,6 +458,27 @@ template <typename TField, typename TOpts>
 using AdaptFieldEmptySerializationT =
     typename AdaptFieldEmptySerialization<TOpts::HasEmptySerialization>::template Type<TField>;
 
+template <bool THasCachedLength>
+struct AdaptFieldCachedLength;
+
+template <>
+struct AdaptFieldCachedLength<true>
+{
+    template <typename TField>
+    using Type = comms::field::adapter::CachedLength<TField>;
+};
+
+template <>
+struct AdaptFieldCachedLength<false>
+{
+    template <typename TField>
+    using Type = TField;
+};
+
+template <typename TField, typename TOpts>
+using AdaptFieldCachedLengthT =
+    typename AdaptFieldCachedLength<TOpts::HasCachedLength>::template Type<TField>;
+
 template <typename TBasic, typename... TOptions>
 class AdaptBasicField
 {
@@ -512,6 +533,12 @@ class AdaptBasicField
             "The following options are incompatible, cannot be used together: "
             "SequenceTrailingFieldSuffix, SequenceTerminationFieldSuffix");
 
+    static_assert(
+            (!ParsedOptions::HasCachedLength) ||
+            (!ParsedOptions::HasEmptySerialization),
+            "The following options are incompatible, cannot be used together: "
+            "CachedLength, EmptySerialization");
+
     static_assert(
             (!ParsedOptions::HasFailOnInvalid) ||
             (!ParsedOptions::HasIgnoreInvalid),
@@ -576,8 +603,11 @@ class AdaptBasicField
     using EmptySerializationAdapted = AdaptFieldEmptySerializationT<
         IgnoreInvalidAdapted, ParsedOptions>;
 
+    using CachedLengthAdapted = AdaptFieldCachedLengthT<
+        EmptySerializationAdapted, ParsedOptions>;
+
 public:
-    using Type = EmptySerializationAdapted;
+    using Type = CachedLengthAdapted;
 };
 
 template <typename TBasic, typename... TOptions>
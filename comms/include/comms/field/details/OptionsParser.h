@@ -63,6 +63,7 @@ public:
     static const bool HasUnits = false;
     static const bool HasOrigDataView = false;
     static const bool HasEmptySerialization = false;
+    static const bool HasCachedLength = false;
     static const bool HasMultiRangeValidation = false;
 };
 
@@ -303,6 +304,15 @@ public:
     static const bool HasEmptySerialization = true;
 };
 
+template <typename... TOptions>
+class OptionsParser<
+    comms::option::CachedLength,
+    TOptions...> : public OptionsParser<TOptions...>
+{
+public:
+    static const bool HasCachedLength = true;
+};
+
 template <bool THasMultiRangeValidation>
 struct MultiRangeAssembler;
 
@@ -37,3 +37,4 @@
 #include "comms/field/adapter/FailOnInvalid.h"
 #include "comms/field/adapter/IgnoreInvalid.h"
 #include "comms/field/adapter/EmptySerialization.h"
+#include "comms/field/adapter/CachedLength.h"
@@ -190,6 +190,63 @@ struct HasDoRefresh {};
 /// @headerfile comms/options.h
 struct HasDoGetId {};
 
+/// @brief Option used to specify value of the field at fixed offset of the
+///     message payload, which distinguishes the message from other ones
+///     sharing the same numeric ID.
+/// @details The check is performed by comms::protocol::MsgIdLayer on the
+///     raw data before the message object is allocated, so only the message
+///     with matching discriminator is created and read. If there is not enough
+///     data to read the field, the message is still considered to be a candidate.
+///     Applicable only to messages with static numeric ID
+///     (see comms::option::StaticNumIdImpl).
+/// @tparam TOffset Offset of the field from the beginning of the payload.
+/// @tparam TField Type of the field, expected to be comms::field::IntValue
+///     or comms::field::EnumValue.
+/// @tparam TValue Expected numeric value of the field.
+/// @headerfile comms/options.h
+template <std::size_t TOffset, typename TField, std::intmax_t TValue>
+struct DiscriminatorField {};
+
+/// @brief Option used to specify range of the payload lengths, which
+///     distinguishes the message from other ones sharing the same numeric ID.
+/// @details The check is performed by comms::protocol::MsgIdLayer on the
+///     length of the data remaining after the message ID, so it is meaningful
+///     only when the outer layers limit it to the exact payload length
+///     (see comms::protocol::MsgSizeLayer). Applicable only to messages
+///     with static numeric ID (see comms::option::StaticNumIdImpl).
+/// @tparam TMin Minimal length of the payload.
+/// @tparam TMax Maximal length of the payload.
+/// @headerfile comms/options.h
+template <std::size_t TMin, std::size_t TMax = std::numeric_limits<std::size_t>::max()>
+struct DiscriminatorLengthRange
+{
+    static_assert(TMin <= TMax, "TMin must not be greater than TMax");
+};
+
+/// @brief Option used to defer decoding of the trailing message fields
+///     until they are accessed.
+/// @details When the message is read, the fields preceding the one with
+///     the specified index are decoded as usual, while the serialised data
+///     of the rest of the fields is copied into the internal buffer.
+///     The deferred fields get decoded on the first access to them via
+///     @b fields() member function (or the accessor functions generated
+///     by COMMS_MSG_FIELDS_ACCESS()), or on the call to @b doValid(),
+///     @b doRefresh(). The decoding can also be performed explicitly by
+///     calling @b decodeLazyFields(), which reports the status of the
+///     operation. The failure status is retained until the next read and
+///     makes @b doValid() report @b false. The leading fields can be inspected without triggering
+///     the decoding using @b eagerFields(). Writing and length calculation of the message with
+///     pending data use the raw data as-is. @n
+///     As the length of the deferred fields is unknown prior to decoding,
+///     all the remaining data (limited by the maximal serialisation length
+///     of the fields) is consumed. Hence the option is expected to be used
+///     when the outer layers limit the input to the exact payload length
+///     (see comms::protocol::MsgSizeLayer).
+/// @tparam TIdx Index of the first deferred field.
+/// @headerfile comms/options.h
+template <std::size_t TIdx>
+struct LazyFieldsFrom {};
+
 /// @brief Option that notifies comms::MessageBase about existence of
 ///     access to fields.
 /// @details Can be useful when there is a chain of inheritances from
@@ -202,6 +259,18 @@ struct AssumeFieldsExistence {};
 /// @headerfile comms/options.h
 struct InPlaceAllocation {};
 
+/// @brief Option that forces reuse of the released message objects instead
+///     of freeing them.
+/// @details The released objects are kept in a per type list and the next
+///     allocation of the same type reuses one after resetting it by copy
+///     assignment of the default constructed object, which allows the
+///     storage of the list and string fields to retain its capacity.
+///     The message types must be copy assignable.
+/// @tparam TMaxCached Maximal number of released objects kept per type.
+/// @headerfile comms/options.h
+template <std::size_t TMaxCached = 16>
+struct RecycleAllocation {};
+
 /// @brief Option used to allow @ref comms::GenericMessage generation inside
 ///  @ref comms::MsgFactory and/or @ref comms::protocol::MsgIdLayer classes.
 /// @tparam TGenericMessage Type of message, expected to be a variant of
@@ -1176,6 +1245,21 @@ struct EmptySerialization {};
 /// @details Just British English spelling.
 using EmptySerialisation = EmptySerialization;
 
+/// @brief Force field to cache its serialisation length.
+/// @details Useful for composite fields of variable length, such as
+///     comms::field::Bundle, comms::field::ArrayList of non fixed length
+///     elements, comms::field::Optional or comms::field::Variant, where
+///     the length() is calculated by iterating over all the members.
+///     The length is calculated on first request and kept until the field is
+///     modified using its non-const member functions, such as @b value(),
+///     @b read() or @b refresh(). As the result the consequent requests are
+///     cheap, for example when several transport layers inquire the length
+///     of the same message during write.
+/// @note The modification of the field's value via reference retrieved
+///     before the length was inquired is not tracked, such reference must
+///     not be kept when this option is used.
+struct CachedLength {};
+
 }  // namespace option
 
 }  // namespace comms
@@ -24,14 +24,18 @@
 #include <tuple>
 #include <algorithm>
 #include <utility>
-#include <tuple>
 #include <limits>
+#include <vector>
+#include <iterator>
+#include <cstdint>
+#include <type_traits>
 
 #include "comms/Assert.h"
 #include "comms/util/Tuple.h"
 #include "ProtocolLayerBase.h"
 #include "comms/fields.h"
 #include "comms/MsgFactory.h"
+#include "details/MsgIdLayerDiscriminator.h"
 
 namespace comms
 {
@@ -105,6 +109,25 @@ public:
         comms::field::isIntValue<Field>() || comms::field::isEnumValue<Field>() || comms::field::isNoValue<Field>(),
         "Field must be of IntValue or EnumValue types");
 
+    /// @brief Policy of processing the message with specific ID on read.
+    enum class ReadPolicy
+    {
+        Decode, ///< Create message object and read its contents (default).
+        Skip, ///< Don't create message object, report comms::ErrorStatus::InvalidMsgId.
+        PassThrough ///< Don't create message object, record the payload in @ref PassThroughFrame.
+    };
+
+    /// @brief View of the frame recorded when its ID has
+    ///     @ref ReadPolicy::PassThrough policy.
+    /// @details The payload references the input buffer, it remains valid
+    ///     as long as the buffer is.
+    struct PassThroughFrame
+    {
+        MsgIdType id = MsgIdType(); ///< ID of the message.
+        const std::uint8_t* payload = nullptr; ///< Beginning of the payload.
+        std::size_t length = 0U; ///< Length of the payload.
+    };
+
     /// @brief Default constructor.
     explicit MsgIdLayer() = default;
 
@@ -127,6 +150,25 @@ public:
     /// @details The function will read message ID from the data sequence first,
     ///     generate appropriate message object based on the read ID and
     ///     forward the read() request to the next layer.
+    ///     The message types that declare discriminators (see
+    ///     @ref comms::option::DiscriminatorField and
+    ///     @ref comms::option::DiscriminatorLengthRange) are skipped
+    ///     without being allocated when their discriminator doesn't match
+    ///     the remaining data, even if the message is the only one with
+    ///     the read ID. The discriminators are looked up in the per ID range
+    ///     of the static table, so only the ones of the messages sharing the
+    ///     read ID are consulted.
+    ///     The message ID is checked against the policies configured with
+    ///     @ref setReadPolicy() and @ref setDefaultReadPolicy(). The message with
+    ///     @ref ReadPolicy::Skip policy is not allocated and reported with
+    ///     comms::ErrorStatus::InvalidMsgId status, the same way as the unknown one.
+    ///     For the message with @ref ReadPolicy::PassThrough policy all the
+    ///     remaining data is consumed and recorded as a payload of the
+    ///     @ref passThroughFrame(), while comms::ErrorStatus::Success is returned
+    ///     and @b msgPtr remains empty. The pass through is possible only when
+    ///     the iterator used for reading is a pointer to single byte characters,
+    ///     otherwise the message is decoded. Both policies expect the outer
+    ///     layers to limit the input to a single frame (see @ref MsgSizeLayer).
     ///     If the message object cannot be generated (the message type is not
     ///     provided inside @b TAllMessages template parameter), but
     ///     the @ref comms::option::SupportGenericMessage option has beed used,
@@ -152,7 +194,7 @@ public:
     ///       read. In case of an error, distance between original position and
     ///       advanced will pinpoint the location of the error.
     /// @post Returns comms::ErrorStatus::Success if and only if msgPtr points
-    ///       to a valid object.
+    ///       to a valid object or the frame was recorded as pass through.
     /// @post missingSize output value is updated if and only if function
     ///       returns comms::ErrorStatus::NotEnoughData.
     template <typename TIter, typename TNextLayerReader>
@@ -177,8 +219,20 @@ public:
         auto id = field.value();
         auto remLen = size - field.length();
 
+        auto policy = readPolicy(id);
+        if (policy == ReadPolicy::Skip) {
+            return comms::ErrorStatus::InvalidMsgId;
+        }
+
+        if ((policy == ReadPolicy::PassThrough) &&
+            (recordPassThrough(id, iter, remLen, PassThroughTag<typename std::decay<decltype(iter)>::type>()))) {
+            return comms::ErrorStatus::Success;
+        }
+
         unsigned idx = 0;
+        es = comms::ErrorStatus::InvalidMsgData;
         while (true) {
+            idx = nextReadCandidate(id, idx, iter, remLen, DiscriminatorTag());
             msgPtr = createMsg(id, idx);
             if (!msgPtr) {
                 break;
@@ -284,8 +338,61 @@ public:
         return factory_.createMsg(id, idx);
     }
 
+    /// @brief Set read policy for the message ID.
+    /// @details Overrides the default policy (see @ref setDefaultReadPolicy())
+    ///     for the specified ID.
+    void setReadPolicy(MsgIdParamType id, ReadPolicy policy)
+    {
+        auto iter = findReadPolicy(id);
+        if ((iter != readPolicies_.end()) && (iter->first == id)) {
+            iter->second = policy;
+            return;
+        }
+
+        readPolicies_.insert(iter, std::make_pair(MsgIdType(id), policy));
+    }
+
+    /// @brief Set read policy for the IDs that don't have their own one.
+    void setDefaultReadPolicy(ReadPolicy policy)
+    {
+        defaultReadPolicy_ = policy;
+    }
+
+    /// @brief Remove all the policies set with @ref setReadPolicy() and
+    ///     restore the default one to @ref ReadPolicy::Decode.
+    void clearReadPolicies()
+    {
+        readPolicies_.clear();
+        defaultReadPolicy_ = ReadPolicy::Decode;
+    }
+
+    /// @brief Get read policy applied to the message ID.
+    ReadPolicy readPolicy(MsgIdParamType id) const
+    {
+        if (readPolicies_.empty()) {
+            return defaultReadPolicy_;
+        }
+
+        auto iter = findReadPolicy(id);
+        if ((iter == readPolicies_.end()) || (iter->first != id)) {
+            return defaultReadPolicy_;
+        }
+
+        return iter->second;
+    }
+
+    /// @brief Get the frame recorded by the last read of the message with
+    ///     @ref ReadPolicy::PassThrough policy.
+    const PassThroughFrame& passThroughFrame() const
+    {
+        return passThroughFrame_;
+    }
+
 private:
 
+    using ReadPolicyInfo = std::pair<MsgIdType, ReadPolicy>;
+    using ReadPoliciesList = std::vector<ReadPolicyInfo>;
+
     struct PolymorphicIdTag {};
     struct DirectIdTag {};
 
@@ -298,6 +405,82 @@ private:
         >::type;
 
 
+    struct NoDiscriminatorTag {};
+    struct UseDiscriminatorTag {};
+
+    using DiscriminatorTag =
+        typename std::conditional<
+            comms::details::msgFactoryAllHaveStaticNumId<AllMessages>() &&
+                details::msgIdLayerHasDiscriminators<AllMessages>(),
+            UseDiscriminatorTag,
+            NoDiscriminatorTag
+        >::type;
+
+    template <typename TIter>
+    static unsigned nextReadCandidate(MsgIdParamType, unsigned idx, const TIter&, std::size_t, NoDiscriminatorTag)
+    {
+        return idx;
+    }
+
+    template <typename TIter>
+    static unsigned nextReadCandidate(MsgIdParamType id, unsigned idx, const TIter& iter, std::size_t len, UseDiscriminatorTag)
+    {
+        using IterType = typename std::decay<decltype(iter)>::type;
+        using IdType = typename std::decay<MsgIdParamType>::type;
+        using Table = details::MsgIdLayerDiscriminatorTable<AllMessages, IdType, IterType>;
+        return Table::nextCandidate(id, idx, iter, len);
+    }
+
+    struct RecordPassThroughTag {};
+    struct NoPassThroughTag {};
+
+    template <typename TIter>
+    using PassThroughTag =
+        typename std::conditional<
+            std::is_pointer<TIter>::value &&
+                (sizeof(typename std::iterator_traits<TIter>::value_type) == 1U),
+            RecordPassThroughTag,
+            NoPassThroughTag
+        >::type;
+
+    typename ReadPoliciesList::const_iterator findReadPolicy(MsgIdParamType id) const
+    {
+        return
+            std::lower_bound(
+                readPolicies_.begin(), readPolicies_.end(), id,
+                [](const ReadPolicyInfo& info, MsgIdParamType val) -> bool
+                {
+                    return info.first < val;
+                });
+    }
+
+    typename ReadPoliciesList::iterator findReadPolicy(MsgIdParamType id)
+    {
+        return
+            std::lower_bound(
+                readPolicies_.begin(), readPolicies_.end(), id,
+                [](const ReadPolicyInfo& info, MsgIdParamType val) -> bool
+                {
+                    return info.first < val;
+                });
+    }
+
+    template <typename TIter>
+    bool recordPassThrough(MsgIdParamType id, TIter& iter, std::size_t len, RecordPassThroughTag)
+    {
+        passThroughFrame_.id = id;
+        passThroughFrame_.payload = reinterpret_cast<const std::uint8_t*>(iter);
+        passThroughFrame_.length = len;
+        std::advance(iter, len);
+        return true;
+    }
+
+    template <typename TIter>
+    static bool recordPassThrough(MsgIdParamType, TIter&, std::size_t, NoPassThroughTag)
+    {
+        return false;
+    }
+
     template <typename TMsg>
     static MsgIdParamType getMsgId(const TMsg& msg, PolymorphicIdTag)
     {
@@ -319,6 +502,9 @@ private:
 
 
     Factory factory_;
+    ReadPoliciesList readPolicies_;
+    ReadPolicy defaultReadPolicy_ = ReadPolicy::Decode;
+    PassThroughFrame passThroughFrame_;
 
 };
 
@@ -19,6 +19,11 @@
 #pragma once
 
 #include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+#include "comms/Assert.h"
+#include "comms/details/detect.h"
 
 namespace comms
 {
@@ -45,12 +50,48 @@ public:
     /// @post The iterator is advanced by number of bytes read (len).
     template <typename TIter>
     TResult operator()(TIter& iter, std::size_t len) const
+    {
+        using Tag =
+            typename std::conditional<
+                comms::details::hasRunDataFunc<TIter>(),
+                SegmentedTag,
+                SequentialTag
+            >::type;
+        return calc(iter, len, Tag());
+    }
+
+private:
+    struct SequentialTag {};
+    struct SegmentedTag {};
+
+    template <typename TIter>
+    static TResult calc(TIter& iter, std::size_t len, SequentialTag)
+    {
+        return sum(iter, len, TResult(0));
+    }
+
+    template <typename TIter>
+    static TResult calc(TIter& iter, std::size_t len, SegmentedTag)
+    {
+        auto checksum = TResult(0);
+        while (0U < len) {
+            auto runLen = std::min(len, iter.runLength());
+            GASSERT(0U < runLen);
+            auto* data = iter.runData();
+            checksum = sum(data, runLen, checksum);
+            iter += static_cast<typename TIter::difference_type>(runLen);
+            len -= runLen;
+        }
+        return checksum;
+    }
+
+    template <typename TIter>
+    static TResult sum(TIter& iter, std::size_t len, TResult checksum)
     {
         using ByteType = typename std::make_unsigned<
             typename std::decay<decltype(*iter)>::type
         >::type;
 
-        auto checksum = TResult(0);
         for (auto idx = 0U; idx < len; ++idx) {
             checksum += static_cast<TResult>(static_cast<ByteType>(*iter));
             ++iter;
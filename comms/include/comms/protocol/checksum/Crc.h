@@ -22,6 +22,10 @@
 #include <array>
 #include <limits>
 #include <type_traits>
+#include <algorithm>
+
+#include "comms/Assert.h"
+#include "comms/details/detect.h"
 
 namespace comms
 {
@@ -281,11 +285,51 @@ public:
     /// @post The iterator is advanced by number of bytes read (len).
     template <typename TIter>
     TResult operator()(TIter& iter, std::size_t len) const
+    {
+        using Tag =
+            typename std::conditional<
+                comms::details::hasRunDataFunc<TIter>(),
+                SegmentedTag,
+                SequentialTag
+            >::type;
+
+        auto rem = calc(iter, len, Tag());
+        return (reflectRem(rem) ^ TFin);
+    }
+
+private:
+    struct NoReflectTag {};
+    struct DoReflectTag {};
+    struct SequentialTag {};
+    struct SegmentedTag {};
+
+    template <typename TIter>
+    static TResult calc(TIter& iter, std::size_t len, SequentialTag)
+    {
+        return update(iter, len, TInit);
+    }
+
+    template <typename TIter>
+    static TResult calc(TIter& iter, std::size_t len, SegmentedTag)
+    {
+        TResult rem = TInit;
+        while (0U < len) {
+            auto runLen = std::min(len, iter.runLength());
+            GASSERT(0U < runLen);
+            auto* data = iter.runData();
+            rem = update(data, runLen, rem);
+            iter += static_cast<typename TIter::difference_type>(runLen);
+            len -= runLen;
+        }
+        return rem;
+    }
+
+    template <typename TIter>
+    static TResult update(TIter& iter, std::size_t len, TResult rem)
     {
         static const std::size_t Width =
             sizeof(TResult) * std::numeric_limits<std::uint8_t>::digits;
 
-        TResult rem = TInit;
         auto& initTable = details::CrcInitTable<TResult, TPoly>::get();
 
         for (std::size_t byte = 0U; byte < len; ++byte)
@@ -300,13 +344,9 @@ public:
             ++iter;
         }
 
-        return (reflectRem(rem) ^ TFin);
+        return rem;
     }
 
-private:
-    struct NoReflectTag {};
-    struct DoReflectTag {};
-
     using ReflectTag = typename std::conditional<
         TReflect,
         DoReflectTag,
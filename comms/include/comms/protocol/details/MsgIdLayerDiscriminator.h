@@ -0,0 +1,188 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+#include <tuple>
+#include <iterator>
+
+#include "comms/ErrorStatus.h"
+#include "comms/util/Tuple.h"
+
+namespace comms
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+struct MsgIdLayerDiscriminatorCheckHelper
+{
+    template <typename TMessage>
+    constexpr bool operator()(bool value) const
+    {
+        return
+            value ||
+            TMessage::ImplOptions::HasDiscriminatorField ||
+            TMessage::ImplOptions::HasDiscriminatorLengthRange;
+    }
+};
+
+template <typename TAllMessages>
+constexpr bool msgIdLayerHasDiscriminators()
+{
+    return comms::util::tupleTypeAccumulate<TAllMessages>(false, MsgIdLayerDiscriminatorCheckHelper());
+}
+
+template <typename TMessage>
+class MsgIdLayerDiscriminator
+{
+    using ImplOptions = typename TMessage::ImplOptions;
+
+public:
+    template <typename TIter>
+    static bool accepts(TIter iter, std::size_t len)
+    {
+        return
+            acceptsLength(len, LengthCheckTag()) &&
+            acceptsField(iter, len, FieldCheckTag());
+    }
+
+private:
+    struct CheckTag {};
+    struct NoCheckTag {};
+
+    using LengthCheckTag =
+        typename std::conditional<
+            ImplOptions::HasDiscriminatorLengthRange,
+            CheckTag,
+            NoCheckTag
+        >::type;
+
+    using FieldCheckTag =
+        typename std::conditional<
+            ImplOptions::HasDiscriminatorField,
+            CheckTag,
+            NoCheckTag
+        >::type;
+
+    static bool acceptsLength(std::size_t, NoCheckTag)
+    {
+        return true;
+    }
+
+    static bool acceptsLength(std::size_t len, CheckTag)
+    {
+        return
+            (ImplOptions::DiscriminatorMinLength <= len) &&
+            (len <= ImplOptions::DiscriminatorMaxLength);
+    }
+
+    template <typename TIter>
+    static bool acceptsField(TIter, std::size_t, NoCheckTag)
+    {
+        return true;
+    }
+
+    template <typename TIter>
+    static bool acceptsField(TIter iter, std::size_t len, CheckTag)
+    {
+        using Field = typename ImplOptions::DiscriminatorField;
+        static const std::size_t Offset = ImplOptions::DiscriminatorOffset;
+        if (len < (Offset + Field::minLength())) {
+            // Let the actual read report the missing data
+            return true;
+        }
+
+        Field field;
+        auto fieldIter = iter + Offset;
+        auto es = field.read(fieldIter, len - Offset);
+        if (es != comms::ErrorStatus::Success) {
+            return true;
+        }
+
+        using ValueType = typename Field::ValueType;
+        return field.value() == static_cast<ValueType>(ImplOptions::DiscriminatorValue);
+    }
+};
+
+template <typename TMsgIdParamType, typename TIter>
+struct MsgIdLayerDiscriminatorEntry
+{
+    TMsgIdParamType id_;
+    bool (*accepts_)(TIter, std::size_t);
+};
+
+template <typename TAllMessages, typename TMsgIdParamType, typename TIter>
+class MsgIdLayerDiscriminatorTable;
+
+template <typename... TMessages, typename TMsgIdParamType, typename TIter>
+class MsgIdLayerDiscriminatorTable<std::tuple<TMessages...>, TMsgIdParamType, TIter>
+{
+    using Entry = MsgIdLayerDiscriminatorEntry<TMsgIdParamType, TIter>;
+
+public:
+    // Returns index (among the messages with the same ID) of the first
+    // candidate starting from fromIdx, which discriminator accepts the data.
+    static unsigned nextCandidate(
+        TMsgIdParamType id,
+        unsigned fromIdx,
+        TIter iter,
+        std::size_t len)
+    {
+        static const Entry Table[] = {
+            Entry{static_cast<TMsgIdParamType>(TMessages::MsgId), &MsgIdLayerDiscriminator<TMessages>::template accepts<TIter>}...
+        };
+
+        auto* tableEnd = &Table[0] + sizeof...(TMessages);
+        auto range =
+            std::equal_range(
+                &Table[0], tableEnd, Entry{id, nullptr},
+                [](const Entry& e1, const Entry& e2) -> bool
+                {
+                    return e1.id_ < e2.id_;
+                });
+
+        auto count = static_cast<unsigned>(std::distance(range.first, range.second));
+        if (count == 0U) {
+            // Unknown ID, let the actual read decide
+            return fromIdx;
+        }
+
+        for (auto idx = fromIdx; idx < count; ++idx) {
+            if (range.first[idx].accepts_(iter, len)) {
+                return idx;
+            }
+        }
+
+        return std::max(count, fromIdx);
+    }
+};
+
+}  // namespace details
+
+}  // namespace protocol
+
+}  // namespace comms
+
+
@@ -0,0 +1,533 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains comms::util::GatherBuffer class.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "comms/Assert.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Output buffer for the gather (scatter-gather I/O) write.
+/// @details The written data is recorded as a list of segments. Bytes written
+///     one by one (headers, trailers, numeric fields, etc...) are stored in the
+///     internal scratch buffer, while the raw data sequences (comms::field::String
+///     and comms::field::ArrayList of raw bytes) kept in contiguous storage
+///     (std::vector, std::string, comms::util::StaticVector,
+///     comms::util::StaticString and the "views"), which are not shorter than the
+///     configured limit, are only referenced in place. The sequences in other
+///     storage types are written byte by byte. The resulting segments
+///     (see @ref segments()) can be passed to @b writev() / @b sendmsg()
+///     without extra copying. @n
+///     The writing is performed using @ref WriteIterator (see @ref writeIterator()),
+///     which is expected to be used as the write iterator of the message
+///     interface (see comms::option::WriteIterator). If the protocol stack
+///     write returns comms::ErrorStatus::UpdateRequired (for example because of
+///     comms::protocol::ChecksumLayer), the update is expected to be performed
+///     using the random access @ref Iterator (see @ref begin()), which
+///     walks over all the segments, so the checksums are calculated over
+///     the referenced data as well, while only the bytes stored in the
+///     scratch buffer can be modified:
+///     @code
+///     comms::util::GatherBuffer buf;
+///     auto writeIter = buf.writeIterator();
+///     auto es = stack.write(msg, writeIter, maxSize);
+///     if (es == comms::ErrorStatus::UpdateRequired) {
+///         auto updateIter = buf.begin();
+///         es = stack.update(updateIter, buf.size());
+///     }
+///     ...
+///     for (auto& seg : buf.segments()) {
+///         ... // fill iovec
+///     }
+///     @endcode
+///     The referenced data belongs to the message fields, hence the message
+///     must not be modified or destroyed while the segments are in use.
+/// @headerfile "comms/util/GatherBuffer.h"
+class GatherBuffer
+{
+    struct Chunk
+    {
+        const std::uint8_t* ref_;
+        std::size_t offset_;
+        std::size_t size_;
+    };
+
+    using ChunksList = std::vector<Chunk>;
+
+public:
+    /// @brief Default minimal length of the data sequence to be referenced in place.
+    static const std::size_t DefaultMinRefLength = 256U;
+
+    /// @brief Single contiguous segment of the written data.
+    struct Segment
+    {
+        const std::uint8_t* data; ///< Pointer to the data.
+        std::size_t size; ///< Length of the data.
+    };
+
+    /// @brief List of the segments.
+    using SegmentsList = std::vector<Segment>;
+
+    /// @brief Output iterator used to write into the buffer.
+    class WriteIterator
+    {
+    public:
+        using iterator_category = std::output_iterator_tag;
+        using value_type = std::uint8_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = void;
+
+        WriteIterator() = default;
+
+        explicit WriteIterator(GatherBuffer& buf) : buf_(&buf) {}
+
+        WriteIterator& operator*()
+        {
+            return *this;
+        }
+
+        WriteIterator& operator=(std::uint8_t byte)
+        {
+            GASSERT(buf_ != nullptr);
+            buf_->writeByte(byte);
+            return *this;
+        }
+
+        WriteIterator& operator++()
+        {
+            return *this;
+        }
+
+        WriteIterator& operator++(int)
+        {
+            return *this;
+        }
+
+        /// @brief Write sequence of the raw data, referencing it in place
+        ///     if it is long enough.
+        void writeRef(const std::uint8_t* data, std::size_t size)
+        {
+            GASSERT(buf_ != nullptr);
+            buf_->writeRef(data, size);
+        }
+
+    private:
+        GatherBuffer* buf_ = nullptr;
+    };
+
+    /// @brief Random access iterator over all the written bytes.
+    /// @details When @b TConst is @b false (see @ref Iterator), the iterator
+    ///     is used to update the written data (see @b update() of the
+    ///     protocol stack). Only the bytes stored in the scratch buffer are
+    ///     updatable in place. The referenced data belongs to the message
+    ///     fields and may reside in the read-only memory, hence dereferencing
+    ///     such byte produces the reference to a copy of its value held by
+    ///     the iterator: the value can be read, while the written value is
+    ///     discarded. The @ref runData() and @ref runLength() member
+    ///     functions expose the contiguous runs of the data for reading,
+    ///     which allows the checksum calculators to process the referenced
+    ///     data without dereferencing every byte. The buffer must not be
+    ///     written while the iterator is in use.
+    template <bool TConst>
+    class BasicIterator
+    {
+        using BufferType =
+            typename std::conditional<
+                TConst,
+                const GatherBuffer,
+                GatherBuffer
+            >::type;
+
+        using ByteType =
+            typename std::conditional<
+                TConst,
+                const std::uint8_t,
+                std::uint8_t
+            >::type;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::uint8_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ByteType*;
+        using reference = ByteType&;
+
+        BasicIterator() = default;
+
+        BasicIterator(BufferType& buf, std::size_t pos)
+          : buf_(&buf)
+        {
+            setPos(pos);
+        }
+
+        reference operator*() const
+        {
+            GASSERT(buf_ != nullptr);
+            auto& chunk = currChunk();
+            if (chunk.ref_ != nullptr) {
+                return refByte(chunk.ref_[chunkOffset_]);
+            }
+
+            return buf_->scratch_[chunk.offset_ + chunkOffset_];
+        }
+
+        reference operator[](difference_type diff) const
+        {
+            return *(*this + diff);
+        }
+
+        /// @brief Pointer to the current byte within its chunk.
+        const std::uint8_t* runData() const
+        {
+            GASSERT(buf_ != nullptr);
+            auto& chunk = currChunk();
+            if (chunk.ref_ != nullptr) {
+                return chunk.ref_ + chunkOffset_;
+            }
+
+            return buf_->scratch_.data() + chunk.offset_ + chunkOffset_;
+        }
+
+        /// @brief Number of bytes left in the current chunk, including
+        ///     the current one.
+        std::size_t runLength() const
+        {
+            GASSERT(buf_ != nullptr);
+            if (buf_->chunks_.size() <= chunkIdx_) {
+                return 0U;
+            }
+
+            return buf_->chunks_[chunkIdx_].size_ - chunkOffset_;
+        }
+
+        BasicIterator& operator++()
+        {
+            ++pos_;
+            ++chunkOffset_;
+            skipExhausted();
+            return *this;
+        }
+
+        BasicIterator operator++(int)
+        {
+            auto copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        BasicIterator& operator--()
+        {
+            setPos(pos_ - 1);
+            return *this;
+        }
+
+        BasicIterator operator--(int)
+        {
+            auto copy = *this;
+            --(*this);
+            return copy;
+        }
+
+        BasicIterator& operator+=(difference_type diff)
+        {
+            setPos(static_cast<std::size_t>(static_cast<difference_type>(pos_) + diff));
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type diff)
+        {
+            return (*this) += (-diff);
+        }
+
+        BasicIterator operator+(difference_type diff) const
+        {
+            auto copy = *this;
+            copy += diff;
+            return copy;
+        }
+
+        BasicIterator operator-(difference_type diff) const
+        {
+            auto copy = *this;
+            copy -= diff;
+            return copy;
+        }
+
+        difference_type operator-(const BasicIterator& other) const
+        {
+            return static_cast<difference_type>(pos_) - static_cast<difference_type>(other.pos_);
+        }
+
+        bool operator==(const BasicIterator& other) const
+        {
+            return pos_ == other.pos_;
+        }
+
+        bool operator!=(const BasicIterator& other) const
+        {
+            return pos_ != other.pos_;
+        }
+
+        bool operator<(const BasicIterator& other) const
+        {
+            return pos_ < other.pos_;
+        }
+
+        bool operator<=(const BasicIterator& other) const
+        {
+            return pos_ <= other.pos_;
+        }
+
+        bool operator>(const BasicIterator& other) const
+        {
+            return pos_ > other.pos_;
+        }
+
+        bool operator>=(const BasicIterator& other) const
+        {
+            return pos_ >= other.pos_;
+        }
+
+    private:
+        struct ConstTag {};
+        struct UpdatableTag {};
+
+        using RefTag =
+            typename std::conditional<
+                TConst,
+                ConstTag,
+                UpdatableTag
+            >::type;
+
+        const Chunk& currChunk() const
+        {
+            auto& chunks = buf_->chunks_;
+            static_cast<void>(chunks);
+            GASSERT(chunkIdx_ < chunks.size());
+            GASSERT(chunkOffset_ < chunks[chunkIdx_].size_);
+            return buf_->chunks_[chunkIdx_];
+        }
+
+        reference refByte(const std::uint8_t& byte) const
+        {
+            return refByte(byte, RefTag());
+        }
+
+        static const std::uint8_t& refByte(const std::uint8_t& byte, ConstTag)
+        {
+            return byte;
+        }
+
+        std::uint8_t& refByte(const std::uint8_t& byte, UpdatableTag) const
+        {
+            refCopy_ = byte;
+            return refCopy_;
+        }
+
+        void setPos(std::size_t pos)
+        {
+            GASSERT(buf_ != nullptr);
+            if (pos < pos_) {
+                pos_ = 0U;
+                chunkIdx_ = 0U;
+                chunkOffset_ = 0U;
+            }
+
+            chunkOffset_ += (pos - pos_);
+            pos_ = pos;
+            skipExhausted();
+        }
+
+        void skipExhausted()
+        {
+            auto& chunks = buf_->chunks_;
+            while ((chunkIdx_ < chunks.size()) && (chunks[chunkIdx_].size_ <= chunkOffset_)) {
+                chunkOffset_ -= chunks[chunkIdx_].size_;
+                ++chunkIdx_;
+            }
+        }
+
+        BufferType* buf_ = nullptr;
+        std::size_t pos_ = 0U;
+        std::size_t chunkIdx_ = 0U;
+        std::size_t chunkOffset_ = 0U;
+        mutable std::uint8_t refCopy_ = 0U;
+    };
+
+    /// @brief Random access iterator used to update the written data.
+    using Iterator = BasicIterator<false>;
+
+    /// @brief Random access iterator used to read the written data.
+    using ConstIterator = BasicIterator<true>;
+
+    /// @brief Constructor
+    /// @param[in] minRefLength Minimal length of the data sequence to be
+    ///     referenced in place rather than copied into the scratch buffer.
+    explicit GatherBuffer(std::size_t minRefLength = DefaultMinRefLength)
+      : minRefLength_(minRefLength)
+    {
+    }
+
+    /// @brief Get iterator to write the data to the end of the buffer.
+    WriteIterator writeIterator()
+    {
+        return WriteIterator(*this);
+    }
+
+    /// @brief Get random access iterator to the beginning of the written data
+    ///     to update it.
+    Iterator begin()
+    {
+        return Iterator(*this, 0U);
+    }
+
+    /// @brief Get random access iterator to the end of the written data
+    ///     to update it.
+    Iterator end()
+    {
+        return Iterator(*this, size_);
+    }
+
+    /// @brief Get random access iterator to the beginning of the written data.
+    ConstIterator begin() const
+    {
+        return ConstIterator(*this, 0U);
+    }
+
+    /// @brief Get random access iterator to the end of the written data.
+    ConstIterator end() const
+    {
+        return ConstIterator(*this, size_);
+    }
+
+    /// @brief Same as const version of @ref begin().
+    ConstIterator cbegin() const
+    {
+        return begin();
+    }
+
+    /// @brief Same as const version of @ref end().
+    ConstIterator cend() const
+    {
+        return end();
+    }
+
+    /// @brief Total length of the written data.
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    /// @brief Check whether there is no written data.
+    bool empty() const
+    {
+        return size_ == 0U;
+    }
+
+    /// @brief Minimal length of the data sequence to be referenced in place.
+    std::size_t minRefLength() const
+    {
+        return minRefLength_;
+    }
+
+    /// @brief Get the written data as the list of segments.
+    /// @details The segments referencing the scratch buffer are valid until
+    ///     the buffer is written or cleared.
+    const SegmentsList& segments()
+    {
+        segments_.clear();
+        segments_.reserve(chunks_.size());
+        for (auto& chunk : chunks_) {
+            auto* data = chunk.ref_;
+            if (data == nullptr) {
+                data = scratch_.data() + chunk.offset_;
+            }
+            segments_.push_back(Segment{data, chunk.size_});
+        }
+        return segments_;
+    }
+
+    /// @brief Append single byte to the scratch buffer.
+    void writeByte(std::uint8_t byte)
+    {
+        if (chunks_.empty() || (chunks_.back().ref_ != nullptr)) {
+            chunks_.push_back(Chunk{nullptr, scratch_.size(), 0U});
+        }
+
+        scratch_.push_back(byte);
+        ++chunks_.back().size_;
+        ++size_;
+    }
+
+    /// @brief Append sequence of the raw data.
+    /// @details The data is referenced in place if it is not shorter
+    ///     than @ref minRefLength(), otherwise it is copied into the
+    ///     scratch buffer.
+    void writeRef(const std::uint8_t* data, std::size_t size)
+    {
+        if (size == 0U) {
+            return;
+        }
+
+        if (size < minRefLength_) {
+            for (auto idx = 0U; idx < size; ++idx) {
+                writeByte(data[idx]);
+            }
+            return;
+        }
+
+        chunks_.push_back(Chunk{data, 0U, size});
+        size_ += size;
+    }
+
+    /// @brief Remove all the written data.
+    void clear()
+    {
+        scratch_.clear();
+        chunks_.clear();
+        segments_.clear();
+        size_ = 0U;
+    }
+
+private:
+    std::vector<std::uint8_t> scratch_;
+    ChunksList chunks_;
+    SegmentsList segments_;
+    std::size_t size_ = 0U;
+    std::size_t minRefLength_ = DefaultMinRefLength;
+};
+
+}  // namespace util
+
+}  // namespace comms
+
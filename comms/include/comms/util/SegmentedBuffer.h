@@ -0,0 +1,335 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains comms::util::SegmentedBuffer class.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "comms/Assert.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Input data residing in the chain of separate buffer chunks.
+/// @details Allows processing of the input data received in multiple
+///     chunks (for example multiple socket reads) without coalescing them
+///     into a single contiguous buffer first. The chunks are only
+///     referenced, the caller is responsible to keep them valid while the
+///     buffer and its iterators are in use. @n
+///     The @ref Iterator is a random access one and can be used as the read
+///     iterator of the message interface (see comms::option::ReadIterator).
+///     The reading of the integral values (see comms/util/access.h), raw
+///     data sequences (comms::field::String and comms::field::ArrayList
+///     of raw bytes) and the checksum calculators (see comms::protocol::checksum)
+///     process the whole contiguous runs of the chunks when possible instead
+///     of accessing the data byte by byte. They recognise any iterator
+///     providing the same @b runData() and @b runLength() member functions
+///     as the @ref Iterator, so other chunk chain iterators can benefit from
+///     the same optimisation.
+///     @code
+///     comms::util::SegmentedBuffer buf;
+///     buf.append(chunk1, chunk1Len);
+///     buf.append(chunk2, chunk2Len);
+///     auto readIter = buf.begin();
+///     auto es = stack.read(msgPtr, readIter, buf.size());
+///     if (es != comms::ErrorStatus::NotEnoughData) {
+///         buf.consume(static_cast<std::size_t>(std::distance(buf.begin(), readIter)));
+///     }
+///     @endcode
+/// @headerfile "comms/util/SegmentedBuffer.h"
+class SegmentedBuffer
+{
+public:
+    /// @brief Single contiguous chunk of the data.
+    struct Segment
+    {
+        const std::uint8_t* data; ///< Pointer to the data.
+        std::size_t size; ///< Length of the data.
+    };
+
+    /// @brief List of the chunks.
+    using SegmentsList = std::vector<Segment>;
+
+    /// @brief Random access iterator over the bytes of all the chunks.
+    /// @details Invalidated by any modification of the buffer.
+    class Iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::uint8_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::uint8_t*;
+        using reference = const std::uint8_t&;
+
+        Iterator() = default;
+
+        Iterator(const SegmentedBuffer& buf, std::size_t pos)
+          : buf_(&buf)
+        {
+            setPos(pos);
+        }
+
+        reference operator*() const
+        {
+            GASSERT(0U < runLen_);
+            return *run_;
+        }
+
+        reference operator[](difference_type diff) const
+        {
+            return *(*this + diff);
+        }
+
+        Iterator& operator++()
+        {
+            GASSERT(0U < runLen_);
+            ++pos_;
+            ++run_;
+            --runLen_;
+            if (runLen_ == 0U) {
+                setPos(pos_);
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        Iterator& operator--()
+        {
+            setPos(pos_ - 1);
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            auto copy = *this;
+            --(*this);
+            return copy;
+        }
+
+        Iterator& operator+=(difference_type diff)
+        {
+            if ((0 <= diff) && (static_cast<std::size_t>(diff) < runLen_)) {
+                pos_ += static_cast<std::size_t>(diff);
+                run_ += diff;
+                runLen_ -= static_cast<std::size_t>(diff);
+                return *this;
+            }
+
+            setPos(static_cast<std::size_t>(static_cast<difference_type>(pos_) + diff));
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type diff)
+        {
+            return (*this) += (-diff);
+        }
+
+        Iterator operator+(difference_type diff) const
+        {
+            auto copy = *this;
+            copy += diff;
+            return copy;
+        }
+
+        Iterator operator-(difference_type diff) const
+        {
+            auto copy = *this;
+            copy -= diff;
+            return copy;
+        }
+
+        difference_type operator-(const Iterator& other) const
+        {
+            return static_cast<difference_type>(pos_) - static_cast<difference_type>(other.pos_);
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return pos_ == other.pos_;
+        }
+
+        bool operator!=(const Iterator& other) const
+        {
+            return pos_ != other.pos_;
+        }
+
+        bool operator<(const Iterator& other) const
+        {
+            return pos_ < other.pos_;
+        }
+
+        bool operator<=(const Iterator& other) const
+        {
+            return pos_ <= other.pos_;
+        }
+
+        bool operator>(const Iterator& other) const
+        {
+            return pos_ > other.pos_;
+        }
+
+        bool operator>=(const Iterator& other) const
+        {
+            return pos_ >= other.pos_;
+        }
+
+        /// @brief Pointer to the current byte within its chunk.
+        const std::uint8_t* runData() const
+        {
+            return run_;
+        }
+
+        /// @brief Number of bytes left in the current chunk, including
+        ///     the current one.
+        std::size_t runLength() const
+        {
+            return runLen_;
+        }
+
+    private:
+        void setPos(std::size_t pos)
+        {
+            GASSERT(buf_ != nullptr);
+            auto& segments = buf_->segments_;
+            if (pos < runStart_) {
+                segIdx_ = 0U;
+                runStart_ = 0U;
+            }
+
+            while ((segIdx_ < segments.size()) &&
+                   ((runStart_ + segments[segIdx_].size) <= pos)) {
+                runStart_ += segments[segIdx_].size;
+                ++segIdx_;
+            }
+
+            pos_ = pos;
+            if (segments.size() <= segIdx_) {
+                GASSERT(pos == buf_->size_);
+                run_ = nullptr;
+                runLen_ = 0U;
+                return;
+            }
+
+            auto offset = pos - runStart_;
+            run_ = segments[segIdx_].data + offset;
+            runLen_ = segments[segIdx_].size - offset;
+        }
+
+        const SegmentedBuffer* buf_ = nullptr;
+        std::size_t pos_ = 0U;
+        std::size_t segIdx_ = 0U;
+        std::size_t runStart_ = 0U;
+        const std::uint8_t* run_ = nullptr;
+        std::size_t runLen_ = 0U;
+    };
+
+    /// @brief Add chunk of the data to the end of the buffer.
+    /// @details The data is referenced, not copied.
+    void append(const std::uint8_t* data, std::size_t size)
+    {
+        if (size == 0U) {
+            return;
+        }
+
+        segments_.push_back(Segment{data, size});
+        size_ += size;
+    }
+
+    /// @brief Remove the processed data from the beginning of the buffer.
+    /// @details The fully consumed chunks are dropped from the list.
+    void consume(std::size_t len)
+    {
+        GASSERT(len <= size_);
+        auto count = 0U;
+        while ((count < segments_.size()) && (segments_[count].size <= len)) {
+            len -= segments_[count].size;
+            size_ -= segments_[count].size;
+            ++count;
+        }
+
+        segments_.erase(segments_.begin(), segments_.begin() + count);
+        if ((0U < len) && (!segments_.empty())) {
+            segments_.front().data += len;
+            segments_.front().size -= len;
+            size_ -= len;
+        }
+    }
+
+    /// @brief Get iterator to the first byte.
+    Iterator begin() const
+    {
+        return Iterator(*this, 0U);
+    }
+
+    /// @brief Get iterator past the last byte.
+    Iterator end() const
+    {
+        return Iterator(*this, size_);
+    }
+
+    /// @brief Total length of the data in all the chunks.
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    /// @brief Check whether the buffer has no data.
+    bool empty() const
+    {
+        return size_ == 0U;
+    }
+
+    /// @brief Get the referenced chunks.
+    const SegmentsList& segments() const
+    {
+        return segments_;
+    }
+
+    /// @brief Remove all the chunks.
+    void clear()
+    {
+        segments_.clear();
+        size_ = 0U;
+    }
+
+private:
+    SegmentsList segments_;
+    std::size_t size_ = 0U;
+};
+
+}  // namespace util
+
+}  // namespace comms
+
@@ -23,6 +23,8 @@
 #include <limits>
 #include <iterator>
 
+#include "comms/details/detect.h"
+
 namespace comms
 {
 
@@ -306,7 +308,15 @@ struct WriteHelper<TEndian, true>
         static const bool IsPointerToUnsigned =
             std::is_pointer<TIter>::value &&
             std::is_unsigned<ByteType>::value;
-        return WriteRandomAccessHelper<TEndian, IsPointerToUnsigned>::write(value, size, iter);
+
+        // The iterators over the chain of chunks don't guarantee the
+        // written bytes to be contiguous.
+        using Helper = typename std::conditional<
+            comms::details::hasRunDataFunc<TIter>(),
+            WriteHelper<TEndian, false>,
+            WriteRandomAccessHelper<TEndian, IsPointerToUnsigned>
+        >::type;
+        return Helper::write(value, size, iter);
     }
 };
 
@@ -452,6 +462,24 @@ struct ReadRandomAccessHelper<TEndian, false, TIsUnsignedConst>
     }
 };
 
+template <typename TEndian>
+struct ReadSegmentedHelper
+{
+    template <typename T, typename TIter>
+    static T read(std::size_t size, TIter& iter)
+    {
+        if (iter.runLength() < size) {
+            return details::read<TEndian, T>(size, iter);
+        }
+
+        auto startPtr = iter.runData();
+        auto endPtr = startPtr;
+        auto value = details::read<TEndian, T>(size, endPtr);
+        iter += (endPtr - startPtr);
+        return value;
+    }
+};
+
 template <typename TEndian, bool TIsRandomAccess>
 struct ReadHelper;
 
@@ -478,7 +506,13 @@ struct ReadHelper<TEndian, true>
         static const bool IsUnsignedConstData =
             std::is_const<ByteType>::value &&
             std::is_unsigned<ByteType>::value;
-        return ReadRandomAccessHelper<TEndian, IsPointer, IsUnsignedConstData>::template read<T>(size, iter);
+
+        using Helper = typename std::conditional<
+            comms::details::hasRunDataFunc<TIter>(),
+            ReadSegmentedHelper<TEndian>,
+            ReadRandomAccessHelper<TEndian, IsPointer, IsUnsignedConstData>
+        >::type;
+        return Helper::template read<T>(size, iter);
     }
 };
 
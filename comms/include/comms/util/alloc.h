@@ -26,6 +26,8 @@
 #include <type_traits>
 #include <array>
 #include <algorithm>
+#include <vector>
+#include <tuple>
 
 #include "comms/Assert.h"
 #include "Tuple.h"
@@ -110,6 +112,119 @@ private:
 };
 
 
+template <typename T, typename TTuple>
+struct RecycleTypeIdx;
+
+template <typename T, typename... TRest>
+struct RecycleTypeIdx<T, std::tuple<T, TRest...> >
+{
+    static const std::size_t Value = 0U;
+};
+
+template <typename T, typename TFirst, typename... TRest>
+struct RecycleTypeIdx<T, std::tuple<TFirst, TRest...> >
+{
+    static const std::size_t Value = 1U + RecycleTypeIdx<T, std::tuple<TRest...> >::Value;
+};
+
+template <typename TInterface>
+class RecycleState
+{
+public:
+    RecycleState(std::size_t typesCount, std::size_t maxCached)
+      : lists_(typesCount),
+        maxCached_(maxCached)
+    {
+        // Make sure releasing an object never allocates
+        for (auto& list : lists_) {
+            list.reserve(maxCached_);
+        }
+    }
+
+    RecycleState(const RecycleState&) = delete;
+    RecycleState& operator=(const RecycleState&) = delete;
+
+    ~RecycleState() noexcept
+    {
+        clearLists();
+    }
+
+    TInterface* take(std::size_t typeIdx)
+    {
+        GASSERT(typeIdx < lists_.size());
+        auto& list = lists_[typeIdx];
+        if (list.empty()) {
+            return nullptr;
+        }
+
+        auto* obj = list.back();
+        list.pop_back();
+        return obj;
+    }
+
+    void release(std::size_t typeIdx, TInterface* obj)
+    {
+        GASSERT(typeIdx < lists_.size());
+        auto& list = lists_[typeIdx];
+        if (closed_ || (maxCached_ <= list.size())) {
+            delete obj;
+            return;
+        }
+
+        list.push_back(obj);
+    }
+
+    void close()
+    {
+        closed_ = true;
+        clearLists();
+    }
+
+private:
+    void clearLists()
+    {
+        for (auto& list : lists_) {
+            for (auto* obj : list) {
+                delete obj;
+            }
+            list.clear();
+        }
+    }
+
+    std::vector<std::vector<TInterface*> > lists_;
+    std::size_t maxCached_ = 0U;
+    bool closed_ = false;
+};
+
+template <typename TInterface>
+class RecycleDeleter
+{
+public:
+    using State = RecycleState<TInterface>;
+
+    RecycleDeleter() = default;
+
+    RecycleDeleter(std::shared_ptr<State> state, std::size_t typeIdx)
+      : state_(std::move(state)),
+        typeIdx_(typeIdx)
+    {
+    }
+
+    void operator()(TInterface* obj)
+    {
+        if (!state_) {
+            delete obj;
+            return;
+        }
+
+        state_->release(typeIdx_, obj);
+    }
+
+private:
+    std::shared_ptr<State> state_;
+    std::size_t typeIdx_ = 0U;
+};
+
 }  // namespace details
 
 /// @brief Dynamic memory allocator
@@ -151,6 +266,137 @@ public:
     }
 };
 
+/// @brief Recycling dynamic memory allocator
+/// @details Similar to @ref DynMemory, but the released objects are not
+///     freed. Instead they are kept in a list of the relevant type (up to
+///     @b TMaxCached per type) and reused by the following allocations of the
+///     same type without arguments. The reused object is reset by the copy
+///     assignment of the default constructed one, which allows the
+///     storage of the contained vectors and strings to retain its capacity.
+///     The objects may outlive the allocator, they are freed when released
+///     in such case. The allocator and objects it creates are not thread safe.
+/// @tparam TInterface Common interface class for all objects being allocated
+///     with this allocator.
+/// @tparam TAllTypes All the possible types that can be allocated with this
+///     allocator bundled in @b std::tuple.
+/// @tparam TMaxCached Maximal number of released objects kept per type.
+template <typename TInterface, typename TAllTypes, std::size_t TMaxCached = 16>
+class DynMemoryRecycle
+{
+    using State = details::RecycleState<TInterface>;
+    using Deleter = details::RecycleDeleter<TInterface>;
+
+public:
+    /// @brief Smart pointer (std::unique_ptr) to the allocated object.
+    /// @details The custom deleter returns the object to the allocator.
+    using Ptr = std::unique_ptr<TInterface, Deleter>;
+
+    /// @brief Default constructor
+    DynMemoryRecycle()
+      : state_(createState())
+    {
+    }
+
+    /// @brief Copy constructor.
+    /// @details The released objects are not shared between the allocators.
+    DynMemoryRecycle(const DynMemoryRecycle&)
+      : state_(createState())
+    {
+    }
+
+    /// @brief Destructor
+    /// @details Frees all the cached objects, the ones that are still
+    ///     in use will be freed when released.
+    ~DynMemoryRecycle() noexcept
+    {
+        state_->close();
+    }
+
+    /// @brief Copy assignment.
+    /// @details Does nothing, the released objects are not shared between
+    ///     the allocators.
+    DynMemoryRecycle& operator=(const DynMemoryRecycle&)
+    {
+        return *this;
+    }
+
+    /// @brief Allocation function
+    /// @details Reuses previously released object of the same type if
+    ///     no constructor arguments are provided.
+    /// @tparam TObj Type of the object being allocated, expected to be the
+    ///     same as or derived from TInterface.
+    /// @tparam TArgs types of arguments to be passed to the constructor.
+    /// @return Smart pointer to the allocated object.
+    template <typename TObj, typename... TArgs>
+    Ptr alloc(TArgs&&... args)
+    {
+        static_assert(std::is_base_of<TInterface, TObj>::value,
+            "TObj does not inherit from TInterface");
+
+        static_assert(comms::util::IsInTuple<TObj, TAllTypes>::Value, ""
+            "TObj must be in provided tuple of supported types");
+
+        static_assert(
+            std::has_virtual_destructor<TInterface>::value ||
+            std::is_same<TInterface, TObj>::value,
+            "TInterface is expected to have virtual destructor");
+
+        static const std::size_t TypeIdx = details::RecycleTypeIdx<TObj, TAllTypes>::Value;
+        return Ptr(
+            allocInternal<TObj>(std::forward<TArgs>(args)...),
+            Deleter(state_, TypeIdx));
+    }
+
+    /// @brief Function used to wrap raw pointer into a smart one
+    /// @tparam Type of the object, expected to be the
+    ///     same as or derived from TInterface and be in @b TAllTypes.
+    /// @param[in] obj Pointer to previously allocated object.
+    /// @return Smart pointer to the wrapped object.
+    template <typename TObj>
+    Ptr wrap(TObj* obj)
+    {
+        static_assert(std::is_base_of<TInterface, TObj>::value,
+            "TObj does not inherit from TInterface");
+
+        static_assert(comms::util::IsInTuple<TObj, TAllTypes>::Value, ""
+            "TObj must be in provided tuple of supported types");
+
+        static const std::size_t TypeIdx = details::RecycleTypeIdx<TObj, TAllTypes>::Value;
+        return Ptr(obj, Deleter(state_, TypeIdx));
+    }
+
+private:
+    static std::shared_ptr<State> createState()
+    {
+        return std::make_shared<State>(std::tuple_size<TAllTypes>::value, TMaxCached);
+    }
+
+    template <typename TObj>
+    TInterface* allocInternal()
+    {
+        static_assert(std::is_copy_assignable<TObj>::value,
+            "Recycled objects are expected to be copy assignable");
+
+        static const std::size_t TypeIdx = details::RecycleTypeIdx<TObj, TAllTypes>::Value;
+        auto* obj = state_->take(TypeIdx);
+        if (obj == nullptr) {
+            return new TObj();
+        }
+
+        static const TObj Default{};
+        *static_cast<TObj*>(obj) = Default;
+        return obj;
+    }
+
+    template <typename TObj, typename TFirst, typename... TArgs>
+    static TInterface* allocInternal(TFirst&& first, TArgs&&... args)
+    {
+        return new TObj(std::forward<TFirst>(first), std::forward<TArgs>(args)...);
+    }
+
+    std::shared_ptr<State> state_;
+};
+
 /// @brief In-place single object allocator.
 /// @details May allocate only single object at a time. In order to be able
 ///     to allocate new object, previous one must be destructed first. The
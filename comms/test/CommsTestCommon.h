@@ -34,6 +34,7 @@ enum MessageType {
     MessageType3,
     MessageType4,
     MessageType5,
+    MessageType6,
 };
 
 template <typename TTraits>
@@ -381,6 +382,52 @@ bool operator==(
     return msg1.fields() == msg2.fields();
 }
 
+template <typename TField>
+using FieldsMessage6 =
+    std::tuple<
+        comms::field::IntValue<TField, std::uint16_t>,
+        comms::field::ArrayList<
+            TField,
+            std::uint8_t,
+            comms::option::SequenceSizeFieldPrefix<comms::field::IntValue<TField, std::uint8_t> >
+        >
+    >;
+
+template <typename TMessage>
+class Message6 : public
+        comms::MessageBase<
+            TMessage,
+            comms::option::StaticNumIdImpl<MessageType6>,
+            comms::option::FieldsImpl<FieldsMessage6<typename TMessage::Field> >,
+            comms::option::LazyFieldsFrom<1>,
+            comms::option::MsgType<Message6<TMessage> >
+        >
+{
+public:
+
+    COMMS_MSG_FIELDS_ACCESS(value1, value2);
+
+    Message6() = default;
+
+    virtual ~Message6() noexcept = default;
+
+protected:
+
+    virtual const std::string& getNameImpl() const
+    {
+        static const std::string str("Message6");
+        return str;
+    }
+};
+
+template <typename... TArgs>
+bool operator==(
+    const Message6<TArgs...>& msg1,
+    const Message6<TArgs...>& msg2)
+{
+    return msg1.fields() == msg2.fields();
+}
+
 template <typename TMessage>
 using AllMessages =
     std::tuple<
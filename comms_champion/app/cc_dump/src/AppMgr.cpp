@@ -18,12 +18,15 @@
 #include "AppMgr.h"
 
 #include <iostream>
+#include <algorithm>
+#include <fstream>
 #include <type_traits>
 #include <string>
 
 CC_DISABLE_WARNINGS()
 #include <QtCore/QDir>
 #include <QtCore/QCoreApplication>
+#include <QtCore/QJsonDocument>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/property/message.h"
@@ -59,6 +62,10 @@ AppMgr::AppMgr()
                 return;
             }
 
+            if (!m_filter.matches(*msg)) {
+                return;
+            }
+
             dispatchMsg(*msg);
         });
 
@@ -81,12 +88,22 @@ AppMgr::AppMgr()
     connect(
         &m_flushTimer, SIGNAL(timeout()),
         this, SLOT(flushOutput()));
+
+    connect(
+        &m_statsTimer, SIGNAL(timeout()),
+        this, SLOT(printStats()));
 }
 
 AppMgr::~AppMgr() noexcept = default;
 
 bool AppMgr::start(const Config& config)
 {
+    if (!m_filter.parse(config.m_filter)) {
+        std::cerr << "ERROR: Invalid filter: " <<
+            m_filter.errorString().toStdString() << std::endl;
+        return false;
+    }
+
     if (config.m_pluginsDir.isEmpty()) {
         std::cerr << "ERROR: Unknown plugins directory!" << std::endl;
         return false;
@@ -103,6 +120,11 @@ bool AppMgr::start(const Config& config)
         return false;
     }
 
+    if (config.m_decodeOnly) {
+        m_config = config;
+        return startDecodeOnly(plugins);
+    }
+
     if (!applyPlugins(plugins)) {
         std::cerr << "ERROR: Failed to apply plugins" << std::endl;
         return false;
@@ -118,7 +140,16 @@ bool AppMgr::start(const Config& config)
     }
 
     if (!m_config.m_inMsgsFile.isEmpty()) {
-        m_record.reset(new RecordMessageHandler(m_config.m_inMsgsFile));
+        m_record.reset(
+            new RecordMessageHandler(
+                m_config.m_inMsgsFile,
+                m_config.m_rotateSize,
+                m_config.m_rotateTime));
+    }
+
+    if (0U < m_config.m_statsInterval) {
+        m_msgMgr.setStatsEnabled(true);
+        m_statsTimer.start(static_cast<int>(m_config.m_statsInterval * 1000U));
     }
 
     m_msgMgr.setRecvEnabled(true);
@@ -163,10 +194,51 @@ void AppMgr::flushOutput()
     }
 
     if (m_record) {
-        m_record->flush();
+        auto dropped = m_record->droppedCount();
+        if (m_recordDropsReported < dropped) {
+            std::cerr << "WARNING: " << (dropped - m_recordDropsReported) <<
+                " messages were not recorded, disk is too slow" << std::endl;
+            m_recordDropsReported = dropped;
+        }
     }
 }
 
+void AppMgr::printStats()
+{
+    QJsonObject obj;
+    if (m_decodeOnlyMgr) {
+        obj = m_decodeOnlyMgr->toJson(m_decodeOnlyMgr->current());
+    }
+    else {
+        obj = m_msgMgr.getStats().toJson();
+    }
+
+    if (m_record) {
+        obj.insert("record_dropped", static_cast<double>(m_record->droppedCount()));
+    }
+
+    QJsonDocument doc(obj);
+    std::cerr << doc.toJson(QJsonDocument::Compact).constData() << std::endl;
+}
+
+void AppMgr::decodeOnlyFinished()
+{
+    if (!m_decodeOnlyMgr) {
+        return;
+    }
+
+    if (m_decodeOnlySocket) {
+        m_decodeOnlySocket->socketDisconnect();
+        m_decodeOnlySocket->stop();
+    }
+
+    auto totals = m_decodeOnlyMgr->finish();
+    QJsonDocument doc(m_decodeOnlyMgr->toJson(totals));
+    std::cout << doc.toJson(QJsonDocument::Compact).constData() << std::endl;
+    m_decodeOnlyMgr.reset();
+    m_decodeOnlySocket.reset();
+}
+
 bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
 {
     typedef cc::Plugin::ListOfFilters ListOfFilters;
@@ -176,6 +248,7 @@ bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
         cc::SocketPtr m_socket;
         ListOfFilters m_filters;
         cc::ProtocolPtr m_protocol;
+        cc::Plugin* m_protocolPlugin = nullptr;
     };
 
     auto applyInfo = ApplyInfo();
@@ -194,6 +267,7 @@ bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
 
         if (!applyInfo.m_protocol) {
             applyInfo.m_protocol = plugin->createProtocol();
+            applyInfo.m_protocolPlugin = plugin;
         }
     }
 
@@ -215,7 +289,143 @@ bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
 
     m_msgMgr.setProtocol(std::move(applyInfo.m_protocol));
 
+    // Every decoding thread requires its own protocol object
+    auto* protocolPlugin = applyInfo.m_protocolPlugin;
+    m_msgMgr.setRecvWorkers(
+        [protocolPlugin]() -> cc::ProtocolPtr
+        {
+            return protocolPlugin->createProtocol();
+        });
+
+    m_pluginMgr.setAppliedPlugins(plugins);
+    return true;
+}
+
+bool AppMgr::startDecodeOnly(const ListOfPluginInfos& plugins)
+{
+    bool useSocket = m_config.m_decodeInput.isEmpty();
+    cc::Plugin* protocolPlugin = nullptr;
+    cc::SocketPtr socket;
+    bool hasFilters = false;
+    for (auto& info : plugins) {
+        cc::Plugin* plugin = m_pluginMgr.loadPlugin(*info);
+        if (plugin == nullptr) {
+            assert(!"Failed to load plugin");
+            continue;
+        }
+
+        if (useSocket && (!socket)) {
+            socket = plugin->createSocket();
+        }
+
+        hasFilters = hasFilters || (!plugin->createFilters().isEmpty());
+
+        if ((protocolPlugin == nullptr) && plugin->createProtocol()) {
+            protocolPlugin = plugin;
+        }
+    }
+
+    if (protocolPlugin == nullptr) {
+        std::cerr << "ERROR: Protocol hasn't been set!" << std::endl;
+        return false;
+    }
+
+    if (useSocket && (!socket)) {
+        std::cerr << "ERROR: Socket hasn't been set!" << std::endl;
+        return false;
+    }
+
+    if (hasFilters) {
+        std::cerr << "WARNING: Filters are not applied in decode only mode" << std::endl;
+    }
+
+    if ((!useSocket) && (1U < m_config.m_decodeWorkers)) {
+        std::cerr << "WARNING: The input file is decoded by single worker" << std::endl;
+    }
+
+    DecodeOnlyMgr::ProtocolsList protocols;
+    auto workersCount = std::max(m_config.m_decodeWorkers, 1U);
+    for (auto idx = 0U; idx < workersCount; ++idx) {
+        protocols.push_back(protocolPlugin->createProtocol());
+        assert(protocols.back());
+    }
+
     m_pluginMgr.setAppliedPlugins(plugins);
+    m_decodeOnlyMgr.reset(new DecodeOnlyMgr(std::move(protocols)));
+    m_decodeOnlyMgr->start();
+
+    if (0U < m_config.m_statsInterval) {
+        m_statsTimer.start(static_cast<int>(m_config.m_statsInterval * 1000U));
+    }
+
+    if (!useSocket) {
+        bool readOk = false;
+        if (m_config.m_decodeInput == "-") {
+            readOk = m_decodeOnlyMgr->feedStream(std::cin);
+        }
+        else {
+            std::ifstream stream(m_config.m_decodeInput.toStdString(), std::ios::binary);
+            if (!stream) {
+                std::cerr << "ERROR: Failed to open \"" <<
+                    m_config.m_decodeInput.toStdString() << "\"" << std::endl;
+                return false;
+            }
+            readOk = m_decodeOnlyMgr->feedStream(stream);
+        }
+
+        if (!readOk) {
+            std::cerr << "WARNING: Failed to read the whole input" << std::endl;
+        }
+
+        decodeOnlyFinished();
+        QTimer::singleShot(0, qApp, SLOT(quit()));
+        return true;
+    }
+
+    socket->setDataReceivedCallback(
+        [this](cc::DataInfoPtr dataPtr)
+        {
+            if (m_decodeOnlyMgr) {
+                m_decodeOnlyMgr->feed(std::move(dataPtr));
+            }
+        });
+
+    socket->setConnectionClosedReportCallback(
+        [this](cc::DataInfo::ConnectionId id)
+        {
+            if (m_decodeOnlyMgr) {
+                m_decodeOnlyMgr->connectionClosed(id);
+            }
+        });
+
+    socket->setDisconnectedReportCallback(
+        []()
+        {
+            QTimer::singleShot(0, qApp, SLOT(quit()));
+        });
+
+    socket->setErrorReportCallback(
+        [](const QString& msg)
+        {
+            std::cerr << "ERROR: " << msg.toStdString() << std::endl;
+        });
+
+    connect(
+        qApp, SIGNAL(aboutToQuit()),
+        this, SLOT(decodeOnlyFinished()));
+
+    // Separate protocol object for sockets that generate traffic themselves
+    socket->applyProtocol(protocolPlugin->createProtocol());
+    if (!socket->start()) {
+        std::cerr << "ERROR: Failed to start socket" << std::endl;
+        return false;
+    }
+
+    if (!socket->socketConnect()) {
+        std::cerr << "WARNING: Socket failed to connect!" << std::endl;
+    }
+
+    m_decodeOnlySocket = std::move(socket);
     return true;
 }
 
@@ -31,9 +31,11 @@ CC_ENABLE_WARNINGS()
 #include "comms_champion/MsgMgr.h"
 #include "comms_champion/MsgFileMgr.h"
 #include "comms_champion/MsgSendMgr.h"
+#include "comms_champion/MsgQuery.h"
 
 #include "CsvDumpMessageHandler.h"
 #include "RecordMessageHandler.h"
+#include "DecodeOnlyMgr.h"
 
 namespace comms_dump
 {
@@ -48,9 +50,16 @@ public:
         QString m_pluginConfigFile;
         QString m_outMsgsFile;
         QString m_inMsgsFile;
+        QString m_filter;
+        QString m_decodeInput; // file to decode, "-" for stdin, empty for socket
         unsigned m_lastWait = 0U;
+        unsigned m_statsInterval = 0U; // seconds, 0 means disabled
+        unsigned m_decodeWorkers = 1U;
+        unsigned long long m_rotateSize = 0U; // bytes, 0 means disabled
+        unsigned m_rotateTime = 0U; // seconds, 0 means disabled
         bool m_recordOutgoing = false;
         bool m_quiet = false;
+        bool m_decodeOnly = false;
     };
 
     AppMgr();
@@ -60,13 +69,17 @@ public:
 
 private slots:
     void flushOutput();
+    void printStats();
+    void decodeOnlyFinished();
 
 private:
     typedef comms_champion::PluginMgr::ListOfPluginInfos ListOfPluginInfos;
     typedef std::unique_ptr<CsvDumpMessageHandler> CsvDumpMessageHandlerPtr;
     typedef std::unique_ptr<RecordMessageHandler> RecordMessageHandlerPtr;
+    typedef std::unique_ptr<DecodeOnlyMgr> DecodeOnlyMgrPtr;
 
     bool applyPlugins(const ListOfPluginInfos& plugins);
+    bool startDecodeOnly(const ListOfPluginInfos& plugins);
     void dispatchMsg(comms_champion::Message& msg);
 
     comms_champion::PluginMgr m_pluginMgr;
@@ -74,9 +87,14 @@ private:
     comms_champion::MsgFileMgr m_msgFileMgr;
     comms_champion::MsgSendMgr m_msgSendMgr;
     Config m_config;
+    comms_champion::MsgQuery m_filter;
     CsvDumpMessageHandlerPtr m_csvDump;
     RecordMessageHandlerPtr m_record;
+    DecodeOnlyMgrPtr m_decodeOnlyMgr;
+    unsigned long long m_recordDropsReported = 0U;
+    comms_champion::SocketPtr m_decodeOnlySocket;
     QTimer m_flushTimer;
+    QTimer m_statsTimer;
 };
 
 } /* namespace comms_dump */
@@ -185,6 +185,12 @@ void CsvDumpMessageHandler::beginMsgHandlingImpl(cc::Message& msg)
         m_out << timestamp << m_sep;
     }
 
+    auto& typeInfo = msg.typeInfo();
+    if (typeInfo.m_static) {
+        m_out << typeInfo.m_idAsStdString;
+        return;
+    }
+
     m_out << msg.idAsString().toStdString();
 }
 
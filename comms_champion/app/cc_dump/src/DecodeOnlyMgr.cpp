@@ -0,0 +1,287 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "DecodeOnlyMgr.h"
+
+#include <cassert>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace cc = comms_champion;
+
+namespace comms_dump
+{
+
+namespace
+{
+
+const std::size_t MaxQueuedJobs = 8U;
+
+}  // namespace
+
+class DecodeOnlyMgr::Worker
+{
+public:
+    explicit Worker(cc::ProtocolPtr protocol)
+      : m_protocol(std::move(protocol))
+    {
+        assert(m_protocol);
+        m_protocol->setDecodeOnly(true);
+        m_protocol->setStatsEnabled(true);
+    }
+
+    ~Worker() noexcept
+    {
+        stop();
+    }
+
+    void start()
+    {
+        assert(!m_thread.joinable());
+        m_thread = std::thread(
+            [this]()
+            {
+                run();
+            });
+    }
+
+    void push(cc::DataInfoPtr data, bool final)
+    {
+        std::unique_lock<std::mutex> guard(m_lock);
+        m_spaceCond.wait(
+            guard,
+            [this]() -> bool
+            {
+                return m_queue.size() < MaxQueuedJobs;
+            });
+
+        m_queue.push_back(Job{std::move(data), final});
+        m_dataCond.notify_one();
+    }
+
+    void stop()
+    {
+        if (!m_thread.joinable()) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_stopRequested = true;
+            m_dataCond.notify_one();
+        }
+
+        m_thread.join();
+    }
+
+    unsigned long long bytes() const
+    {
+        return m_bytes;
+    }
+
+    unsigned long long msgs() const
+    {
+        return m_msgs;
+    }
+
+    void collectStats(cc::PipelineStats& stats) const
+    {
+        assert(!m_thread.joinable());
+        m_protocol->collectStats(stats);
+    }
+
+private:
+    struct Job
+    {
+        cc::DataInfoPtr m_data;
+        bool m_final;
+    };
+
+    void run()
+    {
+        while (true) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> guard(m_lock);
+                m_dataCond.wait(
+                    guard,
+                    [this]() -> bool
+                    {
+                        return m_stopRequested || (!m_queue.empty());
+                    });
+
+                if (m_queue.empty()) {
+                    assert(m_stopRequested);
+                    return;
+                }
+
+                job = std::move(m_queue.front());
+                m_queue.pop_front();
+                m_spaceCond.notify_one();
+            }
+
+            assert(job.m_data);
+            m_protocol->read(*job.m_data, job.m_final);
+            m_bytes += job.m_data->m_data.size();
+
+            // The returned list also contains the messages reporting invalid
+            // frames and garbage data, count only the decoded ones.
+            m_msgs = m_protocol->decodedMsgsCount();
+        }
+    }
+
+    cc::ProtocolPtr m_protocol;
+    std::deque<Job> m_queue;
+    std::mutex m_lock;
+    std::condition_variable m_dataCond;
+    std::condition_variable m_spaceCond;
+    bool m_stopRequested = false;
+    std::thread m_thread;
+    std::atomic<unsigned long long> m_bytes{0U};
+    std::atomic<unsigned long long> m_msgs{0U};
+};
+
+DecodeOnlyMgr::DecodeOnlyMgr(ProtocolsList&& protocols)
+{
+    assert(!protocols.empty());
+    m_workers.reserve(protocols.size());
+    for (auto& p : protocols) {
+        m_workers.push_back(WorkerPtr(new Worker(std::move(p))));
+    }
+}
+
+DecodeOnlyMgr::~DecodeOnlyMgr() noexcept = default;
+
+void DecodeOnlyMgr::start()
+{
+    m_startTime = Clock::now();
+    for (auto& w : m_workers) {
+        w->start();
+    }
+}
+
+void DecodeOnlyMgr::feed(cc::DataInfoPtr data)
+{
+    if ((!data) || m_finished) {
+        return;
+    }
+
+    auto& worker = workerFor(data->m_connectionId);
+    worker.push(std::move(data), false);
+}
+
+void DecodeOnlyMgr::connectionClosed(cc::DataInfo::ConnectionId id)
+{
+    if (m_finished) {
+        return;
+    }
+
+    auto data = cc::makeDataInfo();
+    data->m_connectionId = id;
+    workerFor(id).push(std::move(data), true);
+}
+
+bool DecodeOnlyMgr::feedStream(std::istream& stream)
+{
+    // The protocol doesn't report where the frames end, so the segments
+    // can't be framed independently without splitting the messages
+    // at the boundaries. Keep all of them on the same worker instead.
+    auto& worker = workerFor(cc::DataInfo::DefaultConnectionId);
+    while (stream) {
+        auto data = cc::makeDataInfo();
+        data->m_data.resize(SegmentSize);
+        stream.read(reinterpret_cast<char*>(&data->m_data[0]), static_cast<std::streamsize>(SegmentSize));
+        auto count = stream.gcount();
+        if (count <= 0) {
+            break;
+        }
+
+        data->m_data.resize(static_cast<std::size_t>(count));
+        worker.push(std::move(data), false);
+    }
+
+    connectionClosed(cc::DataInfo::DefaultConnectionId);
+    return !stream.bad();
+}
+
+DecodeOnlyMgr::Totals DecodeOnlyMgr::finish()
+{
+    for (auto& w : m_workers) {
+        w->stop();
+    }
+    m_finished = true;
+
+    auto totals = current();
+    cc::PipelineStats stats;
+    for (auto& w : m_workers) {
+        w->collectStats(stats);
+    }
+
+    totals.m_invalidMsgs = stats.m_invalidMsgs;
+    totals.m_garbageBytes = stats.m_garbageBytes;
+    return totals;
+}
+
+DecodeOnlyMgr::Totals DecodeOnlyMgr::current() const
+{
+    Totals totals;
+    totals.m_durationMs =
+        static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                Clock::now() - m_startTime).count());
+
+    for (auto& w : m_workers) {
+        totals.m_bytes += w->bytes();
+        totals.m_msgs += w->msgs();
+    }
+    return totals;
+}
+
+QJsonObject DecodeOnlyMgr::toJson(const Totals& totals) const
+{
+    auto rateFunc =
+        [&totals](unsigned long long count) -> double
+        {
+            if (totals.m_durationMs == 0U) {
+                return 0.0;
+            }
+            return (static_cast<double>(count) * 1000.0) / static_cast<double>(totals.m_durationMs);
+        };
+
+    QJsonObject obj;
+    obj.insert("workers", static_cast<int>(m_workers.size()));
+    obj.insert("duration_ms", static_cast<double>(totals.m_durationMs));
+    obj.insert("bytes", static_cast<double>(totals.m_bytes));
+    obj.insert("msgs", static_cast<double>(totals.m_msgs));
+    obj.insert("invalid_msgs", static_cast<double>(totals.m_invalidMsgs));
+    obj.insert("garbage_bytes", static_cast<double>(totals.m_garbageBytes));
+    obj.insert("bytes_per_sec", rateFunc(totals.m_bytes));
+    obj.insert("msgs_per_sec", rateFunc(totals.m_msgs));
+    return obj;
+}
+
+DecodeOnlyMgr::Worker& DecodeOnlyMgr::workerFor(cc::DataInfo::ConnectionId id)
+{
+    assert(!m_workers.empty());
+    return *m_workers[static_cast<std::size_t>(id) % m_workers.size()];
+}
+
+} /* namespace comms_dump */
+
@@ -0,0 +1,108 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <istream>
+#include <chrono>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QJsonObject>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Protocol.h"
+#include "comms_champion/DataInfo.h"
+
+namespace comms_dump
+{
+
+/// @brief Decodes the input on multiple worker threads without retaining
+///     the messages.
+/// @details Every worker owns separate protocol object and decodes
+///     independently framed chunks of input: the data of the same socket
+///     connection is always processed by the same worker. The input stream
+///     is processed as single connection, its segments are decoded
+///     sequentially by the same worker, while the next ones are being read.
+class DecodeOnlyMgr
+{
+public:
+    typedef std::vector<comms_champion::ProtocolPtr> ProtocolsList;
+
+    struct Totals
+    {
+        unsigned long long m_durationMs = 0U;
+        unsigned long long m_bytes = 0U;
+        unsigned long long m_msgs = 0U;
+        unsigned long long m_invalidMsgs = 0U;
+        unsigned long long m_garbageBytes = 0U;
+    };
+
+    /// @brief Size of the segments the input stream is read in.
+    static const std::size_t SegmentSize = 1024U * 1024U;
+
+    /// @brief Constructor, creates worker per provided protocol.
+    explicit DecodeOnlyMgr(ProtocolsList&& protocols);
+    ~DecodeOnlyMgr() noexcept;
+
+    /// @brief Start worker threads.
+    void start();
+
+    /// @brief Decode data reported by the socket.
+    /// @details Blocks when the queue of the responsible worker is full.
+    void feed(comms_champion::DataInfoPtr data);
+
+    /// @brief Report termination of the socket connection.
+    void connectionClosed(comms_champion::DataInfo::ConnectionId id);
+
+    /// @brief Read the whole stream and decode it.
+    /// @details The stream is decoded as one continuous connection, i.e.
+    ///     the unconsumed tail of every segment is kept by the protocol
+    ///     object and decoded together with the next one. As the result
+    ///     the messages crossing the segment boundaries are decoded properly
+    ///     instead of being reported as garbage, but the stream doesn't
+    ///     benefit from multiple workers.
+    /// @return false in case of read error.
+    bool feedStream(std::istream& stream);
+
+    /// @brief Wait for all the queued data to be decoded and stop the workers.
+    /// @return Final totals including errors.
+    Totals finish();
+
+    /// @brief Totals collected so far, the errors are reported by finish() only.
+    Totals current() const;
+
+    /// @brief Convert totals to JSON object with the rates.
+    QJsonObject toJson(const Totals& totals) const;
+
+private:
+    class Worker;
+    typedef std::unique_ptr<Worker> WorkerPtr;
+    typedef std::chrono::steady_clock Clock;
+
+    Worker& workerFor(comms_champion::DataInfo::ConnectionId id);
+
+    std::vector<WorkerPtr> m_workers;
+    Clock::time_point m_startTime;
+    bool m_finished = false;
+};
+
+} /* namespace comms_dump */
+
@@ -18,30 +18,209 @@
 
 #include "RecordMessageHandler.h"
 
+#include <iostream>
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QFileInfo>
+CC_ENABLE_WARNINGS()
+
 namespace cc = comms_champion;
 
 namespace comms_dump
 {
 
-RecordMessageHandler::RecordMessageHandler(const QString& filename)
+namespace
 {
-    m_saveHandler = cc::MsgFileMgr::startRecvSave(filename);
-}
 
-RecordMessageHandler::~RecordMessageHandler() noexcept = default;
+const std::size_t QueueSize = 1U << 16;
+const std::size_t QueueMask = QueueSize - 1U;
+const int WriteBlockSize = 64 * 1024;
+const auto FlushPeriod = std::chrono::seconds(1);
+const auto IdleWait = std::chrono::milliseconds(5);
+
+}  // namespace
+
+RecordMessageHandler::RecordMessageHandler(
+    const QString& filename,
+    unsigned long long rotateSize,
+    unsigned rotateTime)
+  : m_filename(filename),
+    m_rotateSize(rotateSize),
+    m_rotateTime(std::chrono::seconds(rotateTime)),
+    m_queue(QueueSize)
+{
+    m_writer = std::thread(
+        [this]()
+        {
+            writerLoop();
+        });
+}
 
-void RecordMessageHandler::flush()
+RecordMessageHandler::~RecordMessageHandler() noexcept
 {
-    if (m_saveHandler) {
-        cc::MsgFileMgr::flushRecvFile(m_saveHandler);
+    m_stopping = true;
+    if (m_writer.joinable()) {
+        m_writer.join();
     }
 }
 
+unsigned long long RecordMessageHandler::droppedCount() const
+{
+    return m_dropped;
+}
+
 void RecordMessageHandler::beginMsgHandlingImpl(cc::Message& msg)
 {
-    if (m_saveHandler) {
-        cc::MsgFileMgr::addToRecvSave(m_saveHandler, msg);
+    auto data = cc::MsgFileMgr::encodeRecvMsg(msg);
+    if (data.isEmpty()) {
+        return;
     }
+
+    auto head = m_head.load(std::memory_order_relaxed);
+    auto tail = m_tail.load(std::memory_order_acquire);
+    if (QueueSize <= (head - tail)) {
+        m_dropped.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    m_queue[head & QueueMask] = std::move(data);
+    m_head.store(head + 1U, std::memory_order_release);
+}
+
+void RecordMessageHandler::writerLoop()
+{
+    openNextFile();
+    auto lastFlush = Clock::now();
+    while (true) {
+        // Must be checked before draining the queue to record everything
+        // pushed prior to the stop request.
+        bool stopping = m_stopping;
+        auto tail = m_tail.load(std::memory_order_relaxed);
+        auto head = m_head.load(std::memory_order_acquire);
+        auto now = Clock::now();
+        bool idle = (tail == head);
+        while (tail != head) {
+            auto& entry = m_queue[tail & QueueMask];
+            addEntry(entry, now);
+            entry = QByteArray();
+            ++tail;
+        }
+        m_tail.store(tail, std::memory_order_release);
+
+        if (stopping) {
+            break;
+        }
+
+        if (FlushPeriod <= (now - lastFlush)) {
+            writePending(true);
+            if (m_file) {
+                m_file->flush();
+            }
+            lastFlush = now;
+        }
+        else {
+            writePending(false);
+        }
+
+        if (idle) {
+            std::this_thread::sleep_for(IdleWait);
+        }
+    }
+
+    closeFile();
+}
+
+void RecordMessageHandler::addEntry(const QByteArray& entry, Clock::time_point now)
+{
+    if (!m_file) {
+        return;
+    }
+
+    if (!m_fileEmpty) {
+        bool sizeExceeded =
+            (0U < m_rotateSize) &&
+            (m_rotateSize <= (m_fileSize + static_cast<unsigned long long>(m_pending.size() + entry.size())));
+
+        bool timeExceeded =
+            (Clock::duration::zero() < m_rotateTime) &&
+            (m_rotateTime <= (now - m_fileOpenTime));
+
+        if (sizeExceeded || timeExceeded) {
+            closeFile();
+            openNextFile();
+            if (!m_file) {
+                return;
+            }
+        }
+    }
+
+    if (!m_fileEmpty) {
+        m_pending.append(",\n");
+    }
+
+    m_pending.append(entry);
+    m_fileEmpty = false;
+}
+
+void RecordMessageHandler::writePending(bool all)
+{
+    if (!m_file) {
+        m_pending.clear();
+        return;
+    }
+
+    auto size = m_pending.size();
+    if (!all) {
+        size = (size / WriteBlockSize) * WriteBlockSize;
+    }
+
+    if (size == 0) {
+        return;
+    }
+
+    m_file->write(m_pending.constData(), size);
+    m_fileSize += static_cast<unsigned long long>(size);
+    m_pending.remove(0, size);
+}
+
+void RecordMessageHandler::openNextFile()
+{
+    auto filename = m_filename;
+    if (0U < m_fileIdx) {
+        QFileInfo info(m_filename);
+        filename = info.path() + '/' + info.completeBaseName() + '.' + QString::number(m_fileIdx);
+        auto suffix = info.suffix();
+        if (!suffix.isEmpty()) {
+            filename += '.' + suffix;
+        }
+    }
+    ++m_fileIdx;
+
+    m_file.reset(new QFile(filename));
+    if (!m_file->open(QIODevice::WriteOnly)) {
+        std::cerr << "ERROR: Failed to open the file " <<
+            filename.toStdString() << std::endl;
+        m_file.reset();
+        return;
+    }
+
+    static const QByteArray Prefix("[\n");
+    m_file->write(Prefix);
+    m_fileSize = static_cast<unsigned long long>(Prefix.size());
+    m_fileOpenTime = Clock::now();
+    m_fileEmpty = true;
+}
+
+void RecordMessageHandler::closeFile()
+{
+    if (!m_file) {
+        return;
+    }
+
+    writePending(true);
+    m_file->write("\n]\n");
+    m_file->close();
+    m_file.reset();
 }
 
 }  // namespace comms_dump
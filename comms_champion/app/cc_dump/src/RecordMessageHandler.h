@@ -19,11 +19,17 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
 #include <QtCore/QString>
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/MessageHandler.h"
@@ -32,22 +38,62 @@ CC_ENABLE_WARNINGS()
 namespace comms_dump
 {
 
+/// @brief Records the messages in the same format as
+///     comms_champion::MsgFileMgr::save().
+/// @details The messages are serialised in the calling thread and passed
+///     to the writer thread via bounded single producer / single consumer
+///     queue, so the decoding never waits for disk. The messages that
+///     don't fit into the full queue are dropped and counted.
+///     The writer accumulates the data and writes it in whole blocks,
+///     with the remainder flushed once a second. When rotation is
+///     enabled, every file is closed as valid JSON array and the next
+///     one gets the index inserted before the extension
+///     ("msgs.json", "msgs.1.json", "msgs.2.json", ...).
 class RecordMessageHandler : public comms_champion::MessageHandler
 {
 public:
-    RecordMessageHandler(const QString& filename);
+    /// @param[in] filename Name of the (first) file.
+    /// @param[in] rotateSize Maximal size of single file in bytes, 0 disables.
+    /// @param[in] rotateTime Maximal duration of single file in seconds, 0 disables.
+    RecordMessageHandler(
+        const QString& filename,
+        unsigned long long rotateSize = 0U,
+        unsigned rotateTime = 0U);
 
     virtual ~RecordMessageHandler() noexcept;
 
-    void flush();
+    unsigned long long droppedCount() const;
 
 protected:
     virtual void beginMsgHandlingImpl(comms_champion::Message& msg) override;
 
 private:
-    typedef comms_champion::MsgFileMgr::FileSaveHandler FileSaveHandler;
-    FileSaveHandler m_saveHandler;
-
+    typedef std::chrono::steady_clock Clock;
+
+    void writerLoop();
+    void addEntry(const QByteArray& entry, Clock::time_point now);
+    void writePending(bool all);
+    void openNextFile();
+    void closeFile();
+
+    QString m_filename;
+    unsigned long long m_rotateSize = 0U;
+    Clock::duration m_rotateTime;
+
+    std::vector<QByteArray> m_queue;
+    std::atomic<std::size_t> m_head{0U};
+    std::atomic<std::size_t> m_tail{0U};
+    std::atomic<unsigned long long> m_dropped{0U};
+    std::atomic<bool> m_stopping{false};
+    std::thread m_writer;
+
+    // Accessed by the writer thread only
+    std::unique_ptr<QFile> m_file;
+    QByteArray m_pending;
+    unsigned long long m_fileSize = 0U;
+    unsigned m_fileIdx = 0U;
+    Clock::time_point m_fileOpenTime;
+    bool m_fileEmpty = true;
 };
 
 }  // namespace comms_dump
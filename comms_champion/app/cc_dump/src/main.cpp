@@ -45,6 +45,13 @@ const QString InMsgsOptStr("received-msgs");
 const QString LastWaitOptStr("last-wait");
 const QString RecordSentOptStr("record-sent");
 const QString QuietOptStr("quiet");
+const QString FilterOptStr("filter");
+const QString StatsOptStr("stats");
+const QString DecodeOnlyOptStr("decode-only");
+const QString InputOptStr("input");
+const QString WorkersOptStr("workers");
+const QString RotateSizeOptStr("rotate-size");
+const QString RotateTimeOptStr("rotate-time");
 
 void metaTypesRegisterAll()
 {
@@ -79,6 +86,22 @@ void prepareCommandLineOptions(QCommandLineParser& parser)
     );
     parser.addOption(inMsgsOpt);
 
+    QCommandLineOption rotateSizeOpt(
+        RotateSizeOptStr,
+        QCoreApplication::translate("main", "Start new received messages storage file "
+                                            "when the current one reaches the size."),
+        QCoreApplication::translate("main", "MiB")
+    );
+    parser.addOption(rotateSizeOpt);
+
+    QCommandLineOption rotateTimeOpt(
+        RotateTimeOptStr,
+        QCoreApplication::translate("main", "Start new received messages storage file "
+                                            "every provided period."),
+        QCoreApplication::translate("main", "seconds")
+    );
+    parser.addOption(rotateTimeOpt);
+
     QCommandLineOption lastWaitOpt(
         QStringList() << "w" << LastWaitOptStr,
         QCoreApplication::translate("main", "Wait period (in milliseconds) from "
@@ -100,6 +123,48 @@ void prepareCommandLineOptions(QCommandLineParser& parser)
     );
     parser.addOption(quietOpt);
 
+    QCommandLineOption filterOpt(
+        QStringList() << "f" << FilterOptStr,
+        QCoreApplication::translate("main", "Dump/Record only messages matching the expression, "
+                                            "such as \"id == 5 && value > 10\"."),
+        QCoreApplication::translate("main", "expr")
+    );
+    parser.addOption(filterOpt);
+
+    QCommandLineOption statsOpt(
+        StatsOptStr,
+        QCoreApplication::translate("main", "Periodically print pipeline statistics "
+                                            "as single line JSON object to stderr."),
+        QCoreApplication::translate("main", "seconds")
+    );
+    parser.addOption(statsOpt);
+
+    QCommandLineOption decodeOnlyOpt(
+        DecodeOnlyOptStr,
+        QCoreApplication::translate("main", "Only decode the input and report the throughput "
+                                            "as JSON object to stdout, the messages are not "
+                                            "dumped, recorded or sent.")
+    );
+    parser.addOption(decodeOnlyOpt);
+
+    QCommandLineOption inputOpt(
+        QStringList() << "i" << InputOptStr,
+        QCoreApplication::translate("main", "Raw input file to decode in decode only mode, "
+                                            "\"-\" stands for stdin. The socket plugin is "
+                                            "used when not provided."),
+        QCoreApplication::translate("main", "filename")
+    );
+    parser.addOption(inputOpt);
+
+    QCommandLineOption workersOpt(
+        QStringList() << "j" << WorkersOptStr,
+        QCoreApplication::translate("main", "Number of decoding threads in decode only mode, "
+                                            "the connections are distributed between them, "
+                                            "the input file is decoded by one. Default is 1."),
+        QCoreApplication::translate("main", "count")
+    );
+    parser.addOption(workersOpt);
+
 }
 
 QString getRootDir()
@@ -178,6 +243,30 @@ int main(int argc, char *argv[])
         config.m_inMsgsFile = parser.value(InMsgsOptStr);
     }
 
+    if (parser.isSet(RotateSizeOptStr)) {
+        auto valueStr = parser.value(RotateSizeOptStr);
+        bool ok = false;
+        unsigned value = valueStr.toUInt(&ok);
+        if ((!ok) || (value == 0U)) {
+            std::cerr << "ERROR: Invalid rotation size \"" <<
+                valueStr.toStdString() << "\"" << std::endl;
+            return -1;
+        }
+        config.m_rotateSize = static_cast<unsigned long long>(value) * 1024U * 1024U;
+    }
+
+    if (parser.isSet(RotateTimeOptStr)) {
+        auto valueStr = parser.value(RotateTimeOptStr);
+        bool ok = false;
+        unsigned value = valueStr.toUInt(&ok);
+        if ((!ok) || (value == 0U)) {
+            std::cerr << "ERROR: Invalid rotation period \"" <<
+                valueStr.toStdString() << "\"" << std::endl;
+            return -1;
+        }
+        config.m_rotateTime = value;
+    }
+
     config.m_lastWait = 100;
     if (parser.isSet(LastWaitOptStr)) {
         auto valueStr = parser.value(LastWaitOptStr);
@@ -196,6 +285,42 @@ int main(int argc, char *argv[])
         config.m_quiet = true;
     }
 
+    if (parser.isSet(FilterOptStr)) {
+        config.m_filter = parser.value(FilterOptStr);
+    }
+
+    if (parser.isSet(StatsOptStr)) {
+        auto valueStr = parser.value(StatsOptStr);
+        bool ok = false;
+        unsigned value = valueStr.toUInt(&ok);
+        if ((!ok) || (value == 0U)) {
+            std::cerr << "ERROR: Invalid statistics interval \"" <<
+                valueStr.toStdString() << "\"" << std::endl;
+            return -1;
+        }
+        config.m_statsInterval = value;
+    }
+
+    if (parser.isSet(DecodeOnlyOptStr)) {
+        config.m_decodeOnly = true;
+    }
+
+    if (parser.isSet(InputOptStr)) {
+        config.m_decodeInput = parser.value(InputOptStr);
+    }
+
+    if (parser.isSet(WorkersOptStr)) {
+        auto valueStr = parser.value(WorkersOptStr);
+        bool ok = false;
+        unsigned value = valueStr.toUInt(&ok);
+        if ((!ok) || (value == 0U)) {
+            std::cerr << "ERROR: Invalid number of workers \"" <<
+                valueStr.toStdString() << "\"" << std::endl;
+            return -1;
+        }
+        config.m_decodeWorkers = value;
+    }
+
     comms_dump::AppMgr appMgr;
     if (!appMgr.start(config)) {
         std::cerr << "Failed to start!" << std::endl;
@@ -18,6 +18,7 @@
 #include "DefaultMessageDisplayHandler.h"
 
 #include <cassert>
+#include <typeinfo>
 
 #include <QtWidgets/QApplication>
 
@@ -133,26 +134,16 @@ public:
 
     virtual void handle(field_wrapper::ArrayListWrapper& wrapper) override
     {
-        auto createMembersWidgetsFunc =
-            [](field_wrapper::ArrayListWrapper& wrap) -> std::vector<FieldWidgetPtr>
+        auto createMemberWidgetFunc =
+            [](field_wrapper::FieldWrapper& wrap) -> FieldWidgetPtr
             {
-                std::vector<FieldWidgetPtr> allFieldsWidgets;
                 WidgetCreator otherCreator;
-                auto& memWrappers = wrap.getMembers();
-                allFieldsWidgets.reserve(memWrappers.size());
-                assert(memWrappers.size() == wrap.size());
-
-                for (auto& memWrap : memWrappers) {
-                    memWrap->dispatch(otherCreator);
-                    allFieldsWidgets.push_back(otherCreator.getWidget());
-                }
-
-                assert(allFieldsWidgets.size() == wrap.size());
-                return allFieldsWidgets;
+                wrap.dispatch(otherCreator);
+                return otherCreator.getWidget();
             };
 
         assert(wrapper.size() == wrapper.getMembers().size());
-        m_widget.reset(new ArrayListFieldWidget(wrapper.clone(), std::move(createMembersWidgetsFunc), m_parent));
+        m_widget.reset(new ArrayListFieldWidget(wrapper.clone(), std::move(createMemberWidgetFunc), m_parent));
     }
 
     virtual void handle(field_wrapper::FloatValueWrapper& wrapper) override
@@ -217,25 +208,56 @@ private:
 
 DefaultMessageDisplayHandler::~DefaultMessageDisplayHandler() noexcept = default;
 
-DefaultMessageDisplayHandler::MsgWidgetPtr DefaultMessageDisplayHandler::getMsgWidget()
+MessageWidget* DefaultMessageDisplayHandler::getMsgWidget()
 {
-    return std::move(m_widget);
+    return m_widget;
+}
+
+void DefaultMessageDisplayHandler::clearCache()
+{
+    m_widget = nullptr;
+    m_cache.clear();
 }
 
 void DefaultMessageDisplayHandler::beginMsgHandlingImpl(
     Message& msg)
 {
-    m_widget.reset(new DefaultMessageWidget(msg));
+    m_fieldIdx = 0U;
+    auto& widgetPtr = m_cache[std::type_index(typeid(msg))];
+    m_rebinding = static_cast<bool>(widgetPtr);
+    if (m_rebinding) {
+        widgetPtr->rebindMessage(msg);
+    }
+    else {
+        widgetPtr.reset(new DefaultMessageWidget(msg));
+    }
+
+    m_widget = widgetPtr.get();
 }
 
 void DefaultMessageDisplayHandler::addFieldImpl(FieldWrapperPtr wrapper)
 {
-    assert(m_widget);
+    assert(m_widget != nullptr);
+    if (m_rebinding) {
+        m_widget->rebindFieldWidget(m_fieldIdx, *wrapper);
+        ++m_fieldIdx;
+        return;
+    }
+
     WidgetCreator creator;
     wrapper->dispatch(creator);
     auto fieldWidget = creator.getWidget();
     fieldWidget->hide();
     m_widget->addFieldWidget(fieldWidget.release());
+    ++m_fieldIdx;
+}
+
+void DefaultMessageDisplayHandler::endMsgHandlingImpl()
+{
+    assert(m_widget != nullptr);
+    if (m_rebinding) {
+        m_widget->refresh();
+    }
 }
 
 }  // namespace comms_champion
@@ -20,6 +20,9 @@
 
 #include <cassert>
 #include <type_traits>
+#include <typeindex>
+#include <map>
+#include <memory>
 
 #include "comms/CompileControl.h"
 
@@ -39,21 +42,33 @@ namespace comms_champion
 class DefaultMessageDisplayHandler : public MessageHandler
 {
 public:
-    using MsgWidgetPtr = std::unique_ptr<MessageWidget>;
-
     ~DefaultMessageDisplayHandler() noexcept;
 
-    MsgWidgetPtr getMsgWidget();
+    /// @brief Widget of the last handled message.
+    /// @details The widgets are owned by the handler and cached per message
+    ///     type. Handling of another message of the same type re-binds the
+    ///     existing widget (and its fields' widgets) to the new message
+    ///     instead of creating a new one.
+    MessageWidget* getMsgWidget();
+
+    /// @brief Destroy all the cached widgets.
+    void clearCache();
 
 protected:
 
     virtual void beginMsgHandlingImpl(Message& msg) override;
     virtual void addFieldImpl(FieldWrapperPtr wrapper) override;
+    virtual void endMsgHandlingImpl() override;
 
 private:
 
     using DefaultMsgWidgetPtr = std::unique_ptr<DefaultMessageWidget>;
-    DefaultMsgWidgetPtr m_widget;
+    typedef std::map<std::type_index, DefaultMsgWidgetPtr> WidgetsCache;
+
+    WidgetsCache m_cache;
+    DefaultMessageWidget* m_widget = nullptr;
+    unsigned m_fieldIdx = 0U;
+    bool m_rebinding = false;
 };
 
 }  // namespace comms_champion
@@ -44,6 +44,8 @@ namespace
 {
 
 const QString AppDataStorageFileName("startup_config.json");
+const int RecvLoadPollPeriodMs = 50;
+const std::size_t RecvLoadMaxMsgsPerPoll = 10000U;
 
 QString getConfigPath(const QString& configName)
 {
@@ -105,6 +107,11 @@ void GuiAppMgr::pluginsEditClicked()
     emit sigPluginsEditDialog();
 }
 
+void GuiAppMgr::pipelineStatsClicked()
+{
+    emit sigPipelineStatsDialog();
+}
+
 void GuiAppMgr::recvStartClicked()
 {
     MsgMgrG::instanceRef().setRecvEnabled(true);
@@ -137,9 +144,10 @@ void GuiAppMgr::recvDeleteClicked()
 
     MsgMgrG::instanceRef().deleteMsg(m_clickedMsg);
 
+    auto clickedMsg = m_clickedMsg;
     clearDisplayedMessage();
     emit sigRecvDeleteSelectedMsg();
-    decRecvListCount();
+    decRecvListCount(*clickedMsg);
 }
 
 void GuiAppMgr::recvClearClicked()
@@ -163,6 +171,17 @@ void GuiAppMgr::recvShowGarbageToggled(bool checked)
     updateRecvListMode(RecvListMode_ShowGarbage, checked);
 }
 
+void GuiAppMgr::recvLoadCancelClicked()
+{
+    if (!m_recvLoader) {
+        return;
+    }
+
+    m_recvLoadTimer.stop();
+    m_recvLoader.reset();
+    emit sigRecvLoadFinished();
+}
+
 void GuiAppMgr::sendStartClicked()
 {
     m_sendState = SendState::SendingSingle;
@@ -344,13 +363,39 @@ bool GuiAppMgr::recvListEmpty() const
 
 void GuiAppMgr::recvLoadMsgsFromFile(const QString& filename)
 {
-    auto& msgMgr = MsgMgrG::instanceRef();
-    auto msgs = MsgFileMgrG::instanceRef().load(MsgFileMgr::Type::Recv, filename, *msgMgr.getProtocol());
+    recvLoadCancelClicked();
+
+    // Every decoding thread requires its own protocol object
+    auto loader =
+        MsgFileMgrG::instanceRef().startRecvLoad(
+            filename,
+            []() -> ProtocolPtr
+            {
+                auto& pluginMgr = PluginMgrG::instanceRef();
+                for (auto& info : pluginMgr.getAppliedPlugins()) {
+                    auto* plugin = pluginMgr.loadPlugin(*info);
+                    if (plugin == nullptr) {
+                        continue;
+                    }
+
+                    auto protocol = plugin->createProtocol();
+                    if (protocol) {
+                        return protocol;
+                    }
+                }
+                return ProtocolPtr();
+            });
 
     clearRecvList(false);
-    msgMgr.deleteAllMsgs();
+    MsgMgrG::instanceRef().deleteAllMsgs();
+
+    if (!loader) {
+        return;
+    }
 
-    msgMgr.addMsgs(msgs);
+    m_recvLoader = std::move(loader);
+    m_recvLoadTimer.start(RecvLoadPollPeriodMs);
+    emit sigRecvLoadProgress(0);
 }
 
 void GuiAppMgr::recvSaveMsgsToFile(const QString& filename)
@@ -378,6 +423,50 @@ unsigned GuiAppMgr::recvListModeMask() const
     return m_recvListMode;
 }
 
+const MsgQuery& GuiAppMgr::recvFilter() const
+{
+    return m_recvFilter;
+}
+
+bool GuiAppMgr::recvFilterUpdated(const QString& expr)
+{
+    if (!m_recvFilter.parse(expr)) {
+        return false;
+    }
+
+    if (m_selType == SelectionType::Recv) {
+        assert(m_clickedMsg);
+        if (!m_recvFilter.matches(*m_clickedMsg)) {
+            clearDisplayedMessage();
+            emit sigRecvMsgListSelectOnAddEnabled(true);
+            emitRecvNotSelected();
+        }
+    }
+    else if (m_selType != SelectionType::Send) {
+        emit sigClearDisplayedMsg();
+    }
+
+    // The list reports the matching messages back via recvListFilterApplied()
+    emit sigRecvFilterChanged(m_recvFilter);
+
+    if (!m_clickedMsg) {
+        emit sigRecvMsgListClearSelection();
+    }
+    return true;
+}
+
+void GuiAppMgr::recvListFilterApplied(
+    unsigned receivedCount,
+    unsigned sentCount,
+    unsigned garbageCount)
+{
+    m_recvReceivedCount = receivedCount;
+    m_recvSentCount = sentCount;
+    m_recvGarbageCount = garbageCount;
+    m_recvListCount = recvListVisibleCount();
+    emit sigRecvListCountReport(m_recvListCount);
+}
+
 GuiAppMgr::SendState GuiAppMgr::sendState() const
 {
     return m_sendState;
@@ -471,11 +560,32 @@ GuiAppMgr::ActivityState GuiAppMgr::getActivityState()
     return ActivityState::Active;
 }
 
+bool GuiAppMgr::pipelineStatsEnabled() const
+{
+    return MsgMgrG::instanceRef().isStatsEnabled();
+}
+
+void GuiAppMgr::setPipelineStatsEnabled(bool enabled)
+{
+    MsgMgrG::instanceRef().setStatsEnabled(enabled);
+}
+
+PipelineStats GuiAppMgr::pipelineStats() const
+{
+    return MsgMgrG::instanceRef().getStats();
+}
+
+void GuiAppMgr::resetPipelineStats()
+{
+    MsgMgrG::instanceRef().resetStats();
+}
+
 bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
 {
     auto& pluginMgr = PluginMgrG::instanceRef();
     auto& msgMgr = MsgMgrG::instanceRef();
 
+    recvLoadCancelClicked();
     emit sigClearAllMainToolbarActions();
     bool hasApplied = pluginMgr.hasAppliedPlugins();
     bool needsReload = pluginMgr.needsReload(plugins);
@@ -532,6 +642,7 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
         SocketPtr m_socket;
         ListOfFilters m_filters;
         ProtocolPtr m_protocol;
+        Plugin* m_protocolPlugin = nullptr;
         ListOfGuiActions m_actions;
     };
 
@@ -551,6 +662,7 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
 
         if (!applyInfo.m_protocol) {
             applyInfo.m_protocol = plugin->createProtocol();
+            applyInfo.m_protocolPlugin = plugin;
         }
 
         auto guiActions = plugin->createGuiActions();
@@ -583,6 +695,14 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
 
     msgMgr.setProtocol(std::move(applyInfo.m_protocol));
 
+    // Every decoding thread requires its own protocol object
+    auto* protocolPlugin = applyInfo.m_protocolPlugin;
+    msgMgr.setRecvWorkers(
+        [protocolPlugin]() -> ProtocolPtr
+        {
+            return protocolPlugin->createProtocol();
+        });
+
     msgMgr.start();
     emit sigActivityStateChanged((int)ActivityState::Active);
 
@@ -614,6 +734,10 @@ GuiAppMgr::GuiAppMgr(QObject* parentObj)
         &m_pendingDisplayTimer, SIGNAL(timeout()),
         this, SLOT(pendingDisplayTimeout()));
 
+    connect(
+        &m_recvLoadTimer, SIGNAL(timeout()),
+        this, SLOT(recvLoadTimeout()));
+
     m_sendMgr.setSendMsgsCallbackFunc(
         [this](MessagesList&& msgsToSend)
         {
@@ -675,12 +799,13 @@ void GuiAppMgr::msgAdded(MessagePtr msg)
     std::cout << prefix << msg->name() << std::endl;
 #endif
 
-    if (!canAddToRecvList(*msg, type)) {
+    auto matched = m_recvFilter.matches(*msg);
+    addMsgToRecvList(msg, matched);
+
+    if ((!matched) || (!canAddToRecvList(*msg, type))) {
         return;
     }
 
-    addMsgToRecvList(msg);
-
     if (m_clickedMsg) {
         return;
     }
@@ -715,6 +840,27 @@ void GuiAppMgr::pendingDisplayTimeout()
     }
 }
 
+void GuiAppMgr::recvLoadTimeout()
+{
+    assert(m_recvLoader);
+    auto msgs = m_recvLoader->takeLoaded(RecvLoadMaxMsgsPerPoll);
+    if (!msgs.empty()) {
+        MsgMgrG::instanceRef().addMsgs(msgs);
+    }
+
+    if (m_recvLoader->isComplete()) {
+        recvLoadCancelClicked();
+        return;
+    }
+
+    auto total = m_recvLoader->bytesTotal();
+    int percent = 0;
+    if (0 < total) {
+        percent = static_cast<int>((m_recvLoader->bytesRead() * 100) / total);
+    }
+    emit sigRecvLoadProgress(percent);
+}
+
 void GuiAppMgr::msgClicked(MessagePtr msg, SelectionType selType)
 {
     assert(msg);
@@ -744,46 +890,23 @@ void GuiAppMgr::clearDisplayedMessage()
     emit sigClearDisplayedMsg();
 }
 
-void GuiAppMgr::refreshRecvList()
+void GuiAppMgr::addMsgToRecvList(MessagePtr msg, bool matched)
 {
-    auto clickedMsg = m_clickedMsg;
-    if (m_selType == SelectionType::Recv) {
-        assert(m_clickedMsg);
-        assert(0 < m_recvListCount);
-        recvMsgClicked(m_clickedMsg, m_recvListCount - 1);
-        assert(!m_clickedMsg);
-    }
-    else if (m_selType != SelectionType::Send) {
-        emit sigClearDisplayedMsg();
-    }
-
-    clearRecvList(false);
+    assert(msg);
+    auto type = property::message::Type().getFrom(*msg);
 
-    auto& allMsgs = MsgMgrG::instanceRef().getAllMsgs();
-    for (auto& msg : allMsgs) {
-        assert(msg);
-        auto type = property::message::Type().getFrom(*msg);
-
-        if (canAddToRecvList(*msg, type)) {
-            addMsgToRecvList(msg);
-            if (msg == clickedMsg) {
-                assert(0 < m_recvListCount);
-                recvMsgClicked(msg, m_recvListCount - 1);
-            }
-        }
+    // Hidden messages are also reported, the list keeps them to be
+    // displayed when the relevant mode is enabled or the filter changes.
+    // Only the ones matching the filter are counted.
+    if (matched) {
+        ++recvListModeCount(recvListModeOf(*msg, type));
     }
 
-    if (!m_clickedMsg) {
-        emit sigRecvMsgListClearSelection();
+    if (matched && canAddToRecvList(*msg, type)) {
+        ++m_recvListCount;
+        emit sigRecvListCountReport(m_recvListCount);
     }
-}
-
-void GuiAppMgr::addMsgToRecvList(MessagePtr msg)
-{
-    assert(msg);
-    ++m_recvListCount;
-    emit sigRecvListCountReport(m_recvListCount);
-    emit sigAddRecvMsg(msg);
+    emit sigAddRecvMsg(msg, matched);
 }
 
 void GuiAppMgr::clearRecvList(bool reportDeleted)
@@ -794,6 +917,12 @@ void GuiAppMgr::clearRecvList(bool reportDeleted)
     assert((!sendSelected) || (m_clickedMsg));
 
     m_recvListCount = 0;
+    for (auto mode : {RecvListMode_ShowReceived, RecvListMode_ShowSent, RecvListMode_ShowGarbage}) {
+        // The list retains the hidden messages when the displayed ones are deleted
+        if ((!reportDeleted) || ((m_recvListMode & mode) != 0U)) {
+            recvListModeCount(mode) = 0;
+        }
+    }
 
     if (!sendSelected) {
         clearDisplayedMessage();
@@ -825,8 +954,60 @@ bool GuiAppMgr::canAddToRecvList(
     return recvListShowsGarbage();
 }
 
-void GuiAppMgr::decRecvListCount()
+GuiAppMgr::RecvListMode GuiAppMgr::recvListModeOf(
+    const Message& msg,
+    MsgType type)
 {
+    assert((type == MsgType::Received) || (type == MsgType::Sent));
+
+    if (type == MsgType::Sent) {
+        return RecvListMode_ShowSent;
+    }
+
+    if (!msg.idAsString().isEmpty()) {
+        return RecvListMode_ShowReceived;
+    }
+
+    return RecvListMode_ShowGarbage;
+}
+
+unsigned& GuiAppMgr::recvListModeCount(RecvListMode mode)
+{
+    if (mode == RecvListMode_ShowSent) {
+        return m_recvSentCount;
+    }
+
+    if (mode == RecvListMode_ShowGarbage) {
+        return m_recvGarbageCount;
+    }
+
+    assert(mode == RecvListMode_ShowReceived);
+    return m_recvReceivedCount;
+}
+
+unsigned GuiAppMgr::recvListVisibleCount() const
+{
+    unsigned count = 0U;
+    if (recvListShowsReceived()) {
+        count += m_recvReceivedCount;
+    }
+
+    if (recvListShowsSent()) {
+        count += m_recvSentCount;
+    }
+
+    if (recvListShowsGarbage()) {
+        count += m_recvGarbageCount;
+    }
+    return count;
+}
+
+void GuiAppMgr::decRecvListCount(const Message& msg)
+{
+    auto& modeCount =
+        recvListModeCount(recvListModeOf(msg, property::message::Type().getFrom(msg)));
+    assert(0U < modeCount);
+    --modeCount;
     --m_recvListCount;
     if (recvListEmpty()) {
         emitRecvNotSelected();
@@ -867,7 +1048,28 @@ void GuiAppMgr::updateRecvListMode(RecvListMode mode, bool checked)
     if (mode != RecvListMode_ShowGarbage) {
         emit sigRecvListTitleNeedsUpdate();
     }
-    refreshRecvList();
+
+    if (m_selType == SelectionType::Recv) {
+        assert(m_clickedMsg);
+        auto type = property::message::Type().getFrom(*m_clickedMsg);
+        if (!canAddToRecvList(*m_clickedMsg, type)) {
+            clearDisplayedMessage();
+            emit sigRecvMsgListSelectOnAddEnabled(true);
+            emitRecvNotSelected();
+        }
+    }
+    else if (m_selType != SelectionType::Send) {
+        emit sigClearDisplayedMsg();
+    }
+
+    // The list only updates its view of the messages it already has
+    m_recvListCount = recvListVisibleCount();
+    emit sigRecvListCountReport(m_recvListCount);
+    emit sigRecvListModeChanged(m_recvListMode);
+
+    if (!m_clickedMsg) {
+        emit sigRecvMsgListClearSelection();
+    }
 }
 
 }  // namespace comms_champion
@@ -33,6 +33,9 @@ CC_ENABLE_WARNINGS()
 #include "comms_champion/Message.h"
 #include "comms_champion/PluginMgr.h"
 #include "comms_champion/MsgSendMgr.h"
+#include "comms_champion/MsgQuery.h"
+#include "comms_champion/MsgFileMgr.h"
+#include "comms_champion/PipelineStats.h"
 
 #include "MsgMgrG.h"
 
@@ -93,6 +96,9 @@ public:
     bool recvListShowsSent() const;
     bool recvListShowsGarbage() const;
     unsigned recvListModeMask() const;
+    const MsgQuery& recvFilter() const;
+    bool recvFilterUpdated(const QString& expr);
+    void recvListFilterApplied(unsigned receivedCount, unsigned sentCount, unsigned garbageCount);
 
     SendState sendState() const;
     void sendAddNewMessage(MessagePtr msg);
@@ -108,8 +114,14 @@ public:
     static ActivityState getActivityState();
     bool applyNewPlugins(const ListOfPluginInfos& plugins);
 
+    bool pipelineStatsEnabled() const;
+    void setPipelineStatsEnabled(bool enabled);
+    PipelineStats pipelineStats() const;
+    void resetPipelineStats();
+
 public slots:
     void pluginsEditClicked();
+    void pipelineStatsClicked();
 
     void recvStartClicked();
     void recvStopClicked();
@@ -120,6 +132,7 @@ public slots:
     void recvShowRecvToggled(bool checked);
     void recvShowSentToggled(bool checked);
     void recvShowGarbageToggled(bool checked);
+    void recvLoadCancelClicked();
 
     void sendStartClicked();
     void sendStartAllClicked();
@@ -148,7 +161,7 @@ public slots:
     void disconnectSocketClicked();
 
 signals:
-    void sigAddRecvMsg(MessagePtr msg);
+    void sigAddRecvMsg(MessagePtr msg, bool matched);
     void sigAddSendMsg(MessagePtr msg);
     void sigSendMsgUpdated(MessagePtr msg);
     void sigSetRecvState(int state);
@@ -172,6 +185,8 @@ signals:
     void sigSendMoveSelectedDown();
     void sigSendMoveSelectedBottom();
     void sigRecvListTitleNeedsUpdate();
+    void sigRecvListModeChanged(unsigned mask);
+    void sigRecvFilterChanged(const MsgQuery& filter);
     void sigNewSendMsgDialog(ProtocolPtr protocol);
     void sigSendRawMsgDialog(ProtocolPtr protocol);
     void sigUpdateSendMsgDialog(MessagePtr msg, ProtocolPtr protocol);
@@ -180,6 +195,7 @@ signals:
     void sigLoadSendMsgsDialog(bool askForClear);
     void sigSaveSendMsgsDialog();
     void sigPluginsEditDialog();
+    void sigPipelineStatsDialog();
     void sigActivityStateChanged(int value);
     void sigErrorReported(const QString& msg);
     void sigAddMainToolbarAction(ActionPtr action);
@@ -187,6 +203,8 @@ signals:
     void sigRecvSaveMsgs(const QString& filename);
     void sigSendLoadMsgs(bool clear, const QString& filename, ProtocolPtr protocol);
     void sigSendSaveMsgs(const QString& filename);
+    void sigRecvLoadProgress(int percent);
+    void sigRecvLoadFinished();
     void sigSocketConnected(bool connected);
     void sigSocketConnectEnabled(bool enabled);
 
@@ -207,17 +225,20 @@ private slots:
     void errorReported(const QString& msg);
     void socketDisconnected();
     void pendingDisplayTimeout();
+    void recvLoadTimeout();
 
 private /*data*/:
 
     void msgClicked(MessagePtr msg, SelectionType selType);
     void displayMessage(MessagePtr msg);
     void clearDisplayedMessage();
-    void refreshRecvList();
-    void addMsgToRecvList(MessagePtr msg);
+    void addMsgToRecvList(MessagePtr msg, bool matched);
     void clearRecvList(bool reportDeleted);
     bool canAddToRecvList(const Message& msg, MsgType type) const;
-    void decRecvListCount();
+    static RecvListMode recvListModeOf(const Message& msg, MsgType type);
+    unsigned& recvListModeCount(RecvListMode mode);
+    unsigned recvListVisibleCount() const;
+    void decRecvListCount(const Message& msg);
     void decSendListCount();
     void emitRecvNotSelected();
     void emitSendNotSelected();
@@ -226,10 +247,14 @@ private /*data*/:
     RecvState m_recvState;
     bool m_recvListSelectOnAdd = true;
     unsigned m_recvListCount = 0;
+    unsigned m_recvReceivedCount = 0;
+    unsigned m_recvSentCount = 0;
+    unsigned m_recvGarbageCount = 0;
     unsigned m_recvListMode =
         RecvListMode_ShowReceived |
         RecvListMode_ShowSent |
         RecvListMode_ShowGarbage;
+    MsgQuery m_recvFilter;
 
     SendState m_sendState;
     unsigned m_sendListCount = 0;
@@ -242,6 +267,9 @@ private /*data*/:
     bool m_pendingDisplayWaitInProgress = false;
 
     MsgSendMgr m_sendMgr;
+
+    MsgFileMgr::LoaderPtr m_recvLoader;
+    QTimer m_recvLoadTimer;
 };
 
 }  // namespace comms_champion
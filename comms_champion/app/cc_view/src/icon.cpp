@@ -144,6 +144,12 @@ const QIcon& pluginEdit()
     return iconObj;
 }
 
+const QIcon& stats()
+{
+    static const QIcon iconObj(":/image/settings.png");
+    return iconObj;
+}
+
 const QIcon& errorLog()
 {
     static const QIcon iconObj(":/image/error_log.png");
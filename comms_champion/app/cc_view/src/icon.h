@@ -50,6 +50,7 @@ const QIcon& edit();
 const QIcon& showRecv();
 const QIcon& showSent();
 const QIcon& pluginEdit();
+const QIcon& stats();
 const QIcon& errorLog();
 const QIcon& connect();
 const QIcon& disconnect();
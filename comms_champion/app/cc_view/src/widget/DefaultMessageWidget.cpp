@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <cassert>
+#include <algorithm>
 
 #include "comms/CompileControl.h"
 
@@ -35,7 +36,7 @@ DefaultMessageWidget::DefaultMessageWidget(
     Message& msg,
     QWidget* parentObj)
   : Base(parentObj),
-    m_msg(msg),
+    m_msg(&msg),
     m_layout(new LayoutType())
 {
     setLayout(m_layout);
@@ -51,13 +52,11 @@ void DefaultMessageWidget::addFieldWidget(FieldWidget* field)
         return;
     }
 
-    auto& props = m_msg.fieldsProperties();
-    if (m_curFieldIdx < static_cast<decltype(m_curFieldIdx)>(props.size())) {
-        auto& propsMapVar = props.at(m_curFieldIdx);
-        if (propsMapVar.isValid() && propsMapVar.canConvert<QVariantMap>()) {
-            auto propsMap = propsMapVar.value<QVariantMap>();
-            field->updateProperties(propsMap);
-        }
+    auto& descs = m_msg->fieldsDescriptors();
+    auto descIdx = static_cast<std::size_t>(m_curFieldIdx);
+    if (descIdx < descs.size()) {
+        assert(descs[descIdx]);
+        field->updateProperties(*descs[descIdx]);
     }
 
     if (m_curFieldIdx != 0) {
@@ -65,6 +64,7 @@ void DefaultMessageWidget::addFieldWidget(FieldWidget* field)
     }
     m_layout->insertWidget(m_layout->count() - 1, field);
     connectFieldSignals(field);
+    m_fields.push_back(field);
 
     ++m_curFieldIdx;
 }
@@ -85,6 +85,8 @@ void DefaultMessageWidget::insertFieldWidget(int idx, FieldWidget* field)
 
     m_layout->insertWidget(adjustedIdx, field);
     connectFieldSignals(field);
+    auto fieldsIdx = std::min(static_cast<std::size_t>(idx), m_fields.size());
+    m_fields.insert(m_fields.begin() + fieldsIdx, field);
 
     if (m_layout->count() <= 2) {
         return;
@@ -100,6 +102,24 @@ void DefaultMessageWidget::insertFieldWidget(int idx, FieldWidget* field)
     m_layout->insertWidget(adjustedIdx + 1, sep.release());
 }
 
+void DefaultMessageWidget::rebindMessage(Message& msg)
+{
+    m_msg = &msg;
+}
+
+void DefaultMessageWidget::rebindFieldWidget(
+    unsigned fieldIdx,
+    field_wrapper::FieldWrapper& wrapper)
+{
+    if (m_fields.size() <= fieldIdx) {
+        assert(!"Unexpected field index");
+        return;
+    }
+
+    assert(m_fields[fieldIdx] != nullptr);
+    m_fields[fieldIdx]->rebind(wrapper);
+}
+
 void DefaultMessageWidget::refreshImpl()
 {
     emit sigRefreshFields();
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "comms/CompileControl.h"
 
@@ -45,6 +46,11 @@ public:
     void addFieldWidget(FieldWidget* field);
     void insertFieldWidget(int fieldIdx, FieldWidget* field);
 
+    /// @brief Reuse the widget to display another message of the same type.
+    /// @details Followed by rebindFieldWidget() for every field and refresh().
+    void rebindMessage(Message& msg);
+    void rebindFieldWidget(unsigned fieldIdx, field_wrapper::FieldWrapper& wrapper);
+
 protected:
     virtual void refreshImpl() override;
     virtual void setEditEnabledImpl(bool enabled) override;
@@ -58,9 +64,10 @@ private:
     void connectFieldSignals(FieldWidget* field);
 
     using LayoutType = QVBoxLayout;
-    Message& m_msg;
+    Message* m_msg = nullptr;
     LayoutType* m_layout;
     uint m_curFieldIdx = 0;
+    std::vector<FieldWidget*> m_fields;
 };
 
 }  // namespace comms_champion
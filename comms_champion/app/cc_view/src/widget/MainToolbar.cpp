@@ -30,6 +30,11 @@ MainToolbar::MainToolbar()
         config, SIGNAL(triggered()),
         GuiAppMgr::instance(), SLOT(pluginsEditClicked()));
 
+    auto* stats = addAction(icon::stats(), "Pipeline statistics");
+    QObject::connect(
+        stats, SIGNAL(triggered()),
+        GuiAppMgr::instance(), SLOT(pipelineStatsClicked()));
+
     m_socketConnect = addAction(icon::connect(), "Connect socket");
     QObject::connect(
         m_socketConnect, SIGNAL(triggered()),
@@ -36,6 +36,7 @@ CC_ENABLE_WARNINGS()
 #include "MessageUpdateDialog.h"
 #include "RawHexDataDialog.h"
 #include "PluginConfigDialog.h"
+#include "PipelineStatsDialog.h"
 #include "GuiAppMgr.h"
 #include "MsgFileMgrG.h"
 #include "icon.h"
@@ -77,6 +78,9 @@ MainWindowWidget::MainWindowWidget(QWidget* parentObj)
     connect(
         guiAppMgr, SIGNAL(sigPluginsEditDialog()),
         this, SLOT(pluginsEditDialog()));
+    connect(
+        guiAppMgr, SIGNAL(sigPipelineStatsDialog()),
+        this, SLOT(pipelineStatsDialog()));
     connect(
         guiAppMgr, SIGNAL(sigErrorReported(const QString&)),
         this, SLOT(displayErrorMsg(const QString&)));
@@ -101,6 +105,12 @@ MainWindowWidget::MainWindowWidget(QWidget* parentObj)
     connect(
         guiAppMgr, SIGNAL(sigSaveSendMsgsDialog()),
         this, SLOT(saveSendMsgsDialog()));
+    connect(
+        guiAppMgr, SIGNAL(sigRecvLoadProgress(int)),
+        this, SLOT(recvLoadProgress(int)));
+    connect(
+        guiAppMgr, SIGNAL(sigRecvLoadFinished()),
+        this, SLOT(recvLoadFinished()));
     connect(
         m_ui.m_actionQuit, SIGNAL(triggered()),
         this, SLOT(close()));
@@ -167,6 +177,17 @@ void MainWindowWidget::pluginsEditDialog()
     }
 }
 
+void MainWindowWidget::pipelineStatsDialog()
+{
+    if (m_statsDialog == nullptr) {
+        m_statsDialog = new PipelineStatsDialog(this);
+    }
+
+    m_statsDialog->show();
+    m_statsDialog->raise();
+    m_statsDialog->activateWindow();
+}
+
 void MainWindowWidget::displayErrorMsg(const QString& msg)
 {
     QMessageBox::critical(
@@ -250,6 +271,36 @@ void MainWindowWidget::saveSendMsgsDialog()
     GuiAppMgr::instance()->sendSaveMsgsToFile(filename);
 }
 
+void MainWindowWidget::recvLoadProgress(int percent)
+{
+    if (m_loadProgressDialog == nullptr) {
+        // Non modal to allow browsing the messages loaded so far
+        m_loadProgressDialog =
+            new QProgressDialog(
+                tr("Loading messages..."), tr("Cancel"), 0, 100, this);
+        m_loadProgressDialog->setWindowModality(Qt::NonModal);
+        m_loadProgressDialog->setAutoClose(false);
+        m_loadProgressDialog->setAutoReset(false);
+        connect(
+            m_loadProgressDialog, SIGNAL(canceled()),
+            GuiAppMgr::instance(), SLOT(recvLoadCancelClicked()));
+    }
+
+    m_loadProgressDialog->setValue(percent);
+}
+
+void MainWindowWidget::recvLoadFinished()
+{
+    if (m_loadProgressDialog == nullptr) {
+        return;
+    }
+
+    auto* dialog = m_loadProgressDialog;
+    m_loadProgressDialog = nullptr;
+    dialog->disconnect(GuiAppMgr::instance());
+    dialog->deleteLater();
+}
+
 void MainWindowWidget::aboutInfo()
 {
     static const QString AboutTxt(
@@ -25,7 +25,9 @@
 
 CC_DISABLE_WARNINGS()
 #include <QtWidgets/QMainWindow>
+#include <QtWidgets/QDialog>
 #include <QtWidgets/QToolBar>
+#include <QtWidgets/QProgressDialog>
 
 #include "ui_MainWindowWidget.h"
 CC_ENABLE_WARNINGS()
@@ -53,6 +55,7 @@ private slots:
     void sendRawMsgDialog(ProtocolPtr protocol);
     void updateSendMsgDialog(MessagePtr msg, ProtocolPtr protocol);
     void pluginsEditDialog();
+    void pipelineStatsDialog();
     void displayErrorMsg(const QString& msg);
     void addMainToolbarAction(ActionPtr action);
     void clearAllMainToolbarActions();
@@ -61,6 +64,8 @@ private slots:
     void saveRecvMsgsDialog();
     void loadSendMsgsDialog(bool askForClear);
     void saveSendMsgsDialog();
+    void recvLoadProgress(int percent);
+    void recvLoadFinished();
     void aboutInfo();
 
 private:
@@ -71,6 +76,8 @@ private:
     Ui::MainWindowWidget m_ui;
     QToolBar* m_toolbar = nullptr;
     std::list<ActionPtr> m_customActions;
+    QDialog* m_statsDialog = nullptr;
+    QProgressDialog* m_loadProgressDialog = nullptr;
 };
 
 }  // namespace comms_champion
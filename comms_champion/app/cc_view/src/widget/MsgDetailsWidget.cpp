@@ -63,20 +63,24 @@ void MsgDetailsWidget::displayMessage(MessagePtr msg)
 {
     assert(msg);
     msg->dispatch(m_msgDisplayHandler);
-    auto msgWidget = m_msgDisplayHandler.getMsgWidget();
-    assert(msgWidget);
+    auto* msgWidget = m_msgDisplayHandler.getMsgWidget();
+    assert(msgWidget != nullptr);
     msgWidget->setEditEnabled(m_editEnabled);
 
     connect(
-        msgWidget.get(), SIGNAL(sigMsgUpdated()),
-        this, SIGNAL(sigMsgUpdated()));
-
-    m_displayedMsgWidget = msgWidget.get();
+        msgWidget, SIGNAL(sigMsgUpdated()),
+        this, SIGNAL(sigMsgUpdated()),
+        Qt::UniqueConnection);
 
     auto* scrollBar = m_ui.m_scrollArea->verticalScrollBar();
     assert(scrollBar != nullptr);
     scrollBar->blockSignals(true);
-    m_ui.m_scrollArea->setWidget(msgWidget.release());
+    if (msgWidget != m_displayedMsgWidget) {
+        // The widgets are owned (cached) by the display handler
+        releaseDisplayedWidget();
+        m_ui.m_scrollArea->setWidget(msgWidget);
+        m_displayedMsgWidget = msgWidget;
+    }
     m_displayedMsgWidget->show();
     scrollBar->blockSignals(false);
 
@@ -101,8 +105,8 @@ void MsgDetailsWidget::updateTitle(MessagePtr msg)
 
 void MsgDetailsWidget::clear()
 {
-    delete m_displayedMsgWidget;
-    m_displayedMsgWidget = nullptr;
+    releaseDisplayedWidget();
+    m_msgDisplayHandler.clearCache();
     m_displayedMsg.reset();
     m_ui.m_scrollArea->setWidget(new QWidget());
     m_ui.m_groupBox->setTitle(getTitlePrefix());
@@ -115,6 +119,18 @@ void MsgDetailsWidget::refresh()
     }
 }
 
+void MsgDetailsWidget::releaseDisplayedWidget()
+{
+    if (m_displayedMsgWidget == nullptr) {
+        return;
+    }
+
+    auto* widget = m_ui.m_scrollArea->takeWidget();
+    static_cast<void>(widget);
+    assert(widget == m_displayedMsgWidget);
+    m_displayedMsgWidget = nullptr;
+}
+
 void MsgDetailsWidget::widgetScrolled(int value)
 {
     if (m_displayedMsg == nullptr) {
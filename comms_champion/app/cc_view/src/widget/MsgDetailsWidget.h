@@ -54,6 +54,8 @@ private slots:
     void widgetScrolled(int value);
 
 private:
+    void releaseDisplayedWidget();
+
     Ui::MsgDetailsWidget m_ui;
     DefaultMessageDisplayHandler m_msgDisplayHandler;
     MessageWidget* m_displayedMsgWidget = nullptr;
@@ -0,0 +1,499 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MsgListModel.h"
+
+#include <cassert>
+#include <algorithm>
+#include <bitset>
+
+#include "comms_champion/MsgMgr.h"
+#include "comms_champion/property/message.h"
+
+namespace comms_champion
+{
+
+namespace
+{
+
+std::size_t wordsCount(std::size_t bitsCount)
+{
+    return (bitsCount + 63U) / 64U;
+}
+
+}  // namespace
+
+MsgListModel::MsgListModel(QObject* parentObj)
+  : Base(parentObj)
+{
+}
+
+MsgListModel::~MsgListModel() noexcept = default;
+
+int MsgListModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return static_cast<int>(m_visibleCount);
+}
+
+QVariant MsgListModel::data(const QModelIndex& index, int role) const
+{
+    if ((!index.isValid()) || (rowCount() <= index.row())) {
+        return QVariant();
+    }
+
+    auto& msg = m_msgs[historyIdx(index.row())];
+    assert(msg);
+    if (role == Qt::UserRole) {
+        return QVariant::fromValue(msg);
+    }
+
+    if (!m_dataFunc) {
+        return QVariant();
+    }
+
+    return m_dataFunc(*msg, role);
+}
+
+int MsgListModel::addMessage(MessagePtr msg, bool matched)
+{
+    assert(msg);
+    auto category = msgCategory(*msg);
+    auto idx = m_msgs.size();
+    m_index.append(msg);
+    m_msgs.push_back(std::move(msg));
+
+    auto words = wordsCount(m_msgs.size());
+    for (auto& bitmap : m_categories) {
+        bitmap.resize(words);
+    }
+    setBit(m_categories[category], idx, true);
+    m_matched.resize(words);
+    setBit(m_matched, idx, matched);
+
+    if (m_visible.size() < words) {
+        m_visible.resize(words);
+        m_visiblePrefix.resize(words, m_visibleCount);
+    }
+
+    if (!isShown(category, matched)) {
+        return -1;
+    }
+
+    auto row = static_cast<int>(m_visibleCount);
+    beginInsertRows(QModelIndex(), row, row);
+    setBit(m_visible, idx, true);
+    ++m_visibleCount;
+    endInsertRows();
+    return row;
+}
+
+MessagePtr MsgListModel::msgAt(int row) const
+{
+    if ((row < 0) || (rowCount() <= row)) {
+        return MessagePtr();
+    }
+
+    return m_msgs[historyIdx(row)];
+}
+
+void MsgListModel::updateMessage(int row, MessagePtr msg)
+{
+    assert(msg);
+    assert((0 <= row) && (row < rowCount()));
+    auto idx = historyIdx(row);
+    auto category = msgCategory(*msg);
+    auto matched = m_query.matches(*msg);
+    m_index.erase(idx);
+    m_index.insert(idx, msg);
+    m_msgs[idx] = std::move(msg);
+
+    auto prevCategory = categoryOf(idx);
+    setBit(m_categories[prevCategory], idx, false);
+    setBit(m_categories[category], idx, true);
+    setBit(m_matched, idx, matched);
+    if (isShown(category, matched)) {
+        auto modelIdx = index(row);
+        emit dataChanged(modelIdx, modelIdx);
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), row, row);
+    setBit(m_visible, idx, false);
+    updateVisiblePrefix(idx / WordBits);
+    endRemoveRows();
+}
+
+void MsgListModel::removeMessage(int row)
+{
+    assert((0 <= row) && (row < rowCount()));
+    beginRemoveRows(QModelIndex(), row, row);
+    eraseAt(historyIdx(row));
+    endRemoveRows();
+}
+
+void MsgListModel::moveMessage(int fromRow, int toRow)
+{
+    assert((0 <= fromRow) && (fromRow < rowCount()));
+    assert((0 <= toRow) && (toRow < rowCount()));
+    if (fromRow == toRow) {
+        return;
+    }
+
+    auto destRow = toRow;
+    if (fromRow < toRow) {
+        ++destRow;
+    }
+
+    beginMoveRows(QModelIndex(), fromRow, fromRow, QModelIndex(), destRow);
+    auto fromIdx = historyIdx(fromRow);
+    auto msg = m_msgs[fromIdx];
+    auto category = categoryOf(fromIdx);
+    auto matched = testBit(m_matched, fromIdx);
+    eraseAt(fromIdx);
+
+    auto toIdx = m_msgs.size();
+    if (static_cast<std::size_t>(toRow) < m_visibleCount) {
+        toIdx = historyIdx(toRow);
+    }
+    insertAt(toIdx, std::move(msg), category, matched);
+    endMoveRows();
+}
+
+MsgListModel::MessagesList MsgListModel::removeVisible()
+{
+    MessagesList removed;
+    if (m_visibleCount == 0U) {
+        return removed;
+    }
+
+    beginResetModel();
+    std::vector<MessagePtr> msgs;
+    Bitmap categories[Category_NumOfValues];
+    Bitmap matched;
+    msgs.reserve(m_msgs.size() - m_visibleCount);
+    m_index.clear();
+    for (auto idx = 0U; idx < m_msgs.size(); ++idx) {
+        if (testBit(m_visible, idx)) {
+            removed.push_back(std::move(m_msgs[idx]));
+            continue;
+        }
+
+        auto category = categoryOf(idx);
+        auto newIdx = msgs.size();
+        m_index.append(m_msgs[idx]);
+        msgs.push_back(std::move(m_msgs[idx]));
+        auto words = wordsCount(msgs.size());
+        categories[category].resize(words);
+        setBit(categories[category], newIdx, true);
+        matched.resize(words);
+        setBit(matched, newIdx, testBit(m_matched, idx));
+    }
+
+    m_msgs.swap(msgs);
+    for (auto idx = 0U; idx < Category_NumOfValues; ++idx) {
+        m_categories[idx].swap(categories[idx]);
+        m_categories[idx].resize(wordsCount(m_msgs.size()));
+    }
+    m_matched.swap(matched);
+    m_matched.resize(wordsCount(m_msgs.size()));
+    rebuildVisible();
+    endResetModel();
+    return removed;
+}
+
+void MsgListModel::clear()
+{
+    beginResetModel();
+    m_msgs.clear();
+    m_index.clear();
+    for (auto& bitmap : m_categories) {
+        bitmap.clear();
+    }
+    m_matched.clear();
+    m_visible.clear();
+    m_visiblePrefix.clear();
+    m_visibleCount = 0U;
+    endResetModel();
+}
+
+MsgListModel::MessagesList MsgListModel::visibleMsgs() const
+{
+    MessagesList result;
+    for (auto wordIdx = 0U; wordIdx < m_visible.size(); ++wordIdx) {
+        auto word = m_visible[wordIdx];
+        while (word != 0U) {
+            auto bitIdx = selectInWord(word, 0U);
+            word &= (word - 1);
+            result.push_back(m_msgs[(wordIdx * WordBits) + bitIdx]);
+        }
+    }
+    return result;
+}
+
+void MsgListModel::setVisibleMask(unsigned mask)
+{
+    mask &= AllCategoriesMask;
+    if (mask == m_visibleMask) {
+        return;
+    }
+
+    beginResetModel();
+    m_visibleMask = mask;
+    rebuildVisible();
+    endResetModel();
+}
+
+void MsgListModel::setQuery(const MsgQuery& query)
+{
+    if (query.isEmpty() && m_query.isEmpty()) {
+        return;
+    }
+
+    beginResetModel();
+    m_query = query;
+    rebuildMatched();
+    rebuildVisible();
+    endResetModel();
+}
+
+std::size_t MsgListModel::matchedCount(Category category) const
+{
+    auto& bitmap = m_categories[category];
+    assert(bitmap.size() == m_matched.size());
+    std::size_t count = 0U;
+    for (auto idx = 0U; idx < bitmap.size(); ++idx) {
+        count += popCount(bitmap[idx] & m_matched[idx]);
+    }
+    return count;
+}
+
+std::size_t MsgListModel::historyIdx(int row) const
+{
+    assert((0 <= row) && (static_cast<std::size_t>(row) < m_visibleCount));
+    auto rowTmp = static_cast<std::size_t>(row);
+    auto iter =
+        std::upper_bound(m_visiblePrefix.begin(), m_visiblePrefix.end(), rowTmp);
+    assert(iter != m_visiblePrefix.begin());
+    auto wordIdx = static_cast<std::size_t>(std::distance(m_visiblePrefix.begin(), iter)) - 1;
+    auto rank = static_cast<unsigned>(rowTmp - m_visiblePrefix[wordIdx]);
+    return (wordIdx * WordBits) + selectInWord(m_visible[wordIdx], rank);
+}
+
+int MsgListModel::historyIdxToRow(std::size_t idx) const
+{
+    if ((m_msgs.size() <= idx) || (!testBit(m_visible, idx))) {
+        return -1;
+    }
+
+    auto wordIdx = idx / WordBits;
+    auto bitIdx = idx % WordBits;
+    auto lowerMask = (static_cast<Word>(1U) << bitIdx) - 1;
+    return static_cast<int>(m_visiblePrefix[wordIdx] + popCount(m_visible[wordIdx] & lowerMask));
+}
+
+MsgListModel::Category MsgListModel::msgCategory(const Message& msg)
+{
+    if (property::message::Type().getFrom(msg) == MsgMgr::MsgType::Sent) {
+        return Category_Sent;
+    }
+
+    if (msg.idAsString().isEmpty()) {
+        return Category_Garbage;
+    }
+
+    return Category_Received;
+}
+
+bool MsgListModel::testBit(const Bitmap& bitmap, std::size_t idx)
+{
+    auto wordIdx = idx / WordBits;
+    assert(wordIdx < bitmap.size());
+    return (bitmap[wordIdx] & (static_cast<Word>(1U) << (idx % WordBits))) != 0U;
+}
+
+void MsgListModel::setBit(Bitmap& bitmap, std::size_t idx, bool value)
+{
+    auto wordIdx = idx / WordBits;
+    assert(wordIdx < bitmap.size());
+    auto mask = static_cast<Word>(1U) << (idx % WordBits);
+    if (value) {
+        bitmap[wordIdx] |= mask;
+    }
+    else {
+        bitmap[wordIdx] &= ~mask;
+    }
+}
+
+void MsgListModel::insertBit(Bitmap& bitmap, std::size_t idx, bool value, std::size_t count)
+{
+    bitmap.resize(wordsCount(count));
+    auto wordIdx = idx / WordBits;
+    assert(wordIdx < bitmap.size());
+    for (auto w = bitmap.size() - 1; wordIdx < w; --w) {
+        bitmap[w] = (bitmap[w] << 1) | (bitmap[w - 1] >> (WordBits - 1));
+    }
+
+    auto bitIdx = idx % WordBits;
+    auto lowerMask = (static_cast<Word>(1U) << bitIdx) - 1;
+    auto word = bitmap[wordIdx];
+    bitmap[wordIdx] = (word & lowerMask) | ((word & ~lowerMask) << 1);
+    setBit(bitmap, idx, value);
+}
+
+void MsgListModel::eraseBit(Bitmap& bitmap, std::size_t idx, std::size_t count)
+{
+    auto wordIdx = idx / WordBits;
+    assert(wordIdx < bitmap.size());
+    auto bitIdx = idx % WordBits;
+    auto lowerMask = (static_cast<Word>(1U) << bitIdx) - 1;
+    auto word = bitmap[wordIdx];
+    bitmap[wordIdx] = (word & lowerMask) | ((word >> 1) & ~lowerMask);
+    for (auto w = wordIdx; w < bitmap.size(); ++w) {
+        if (wordIdx < w) {
+            bitmap[w] >>= 1;
+        }
+
+        if ((w + 1) < bitmap.size()) {
+            bitmap[w] |= (bitmap[w + 1] & 1U) << (WordBits - 1);
+        }
+    }
+    bitmap.resize(wordsCount(count));
+}
+
+unsigned MsgListModel::popCount(Word word)
+{
+    return static_cast<unsigned>(std::bitset<WordBits>(word).count());
+}
+
+unsigned MsgListModel::selectInWord(Word word, unsigned rank)
+{
+    for (auto idx = 0U; idx < rank; ++idx) {
+        word &= (word - 1);
+    }
+
+    assert(word != 0U);
+    unsigned pos = 0U;
+    while ((word & 1U) == 0U) {
+        word >>= 1;
+        ++pos;
+    }
+    return pos;
+}
+
+MsgListModel::Category MsgListModel::categoryOf(std::size_t idx) const
+{
+    for (auto category = 0U; category < Category_NumOfValues; ++category) {
+        if (testBit(m_categories[category], idx)) {
+            return static_cast<Category>(category);
+        }
+    }
+
+    assert(!"Category must be known");
+    return Category_Received;
+}
+
+bool MsgListModel::isShown(Category category, bool matched) const
+{
+    return matched && ((m_visibleMask & (1U << category)) != 0U);
+}
+
+void MsgListModel::insertAt(std::size_t idx, MessagePtr msg, Category category, bool matched)
+{
+    assert(idx <= m_msgs.size());
+    m_index.insert(idx, msg);
+    m_msgs.insert(m_msgs.begin() + static_cast<std::ptrdiff_t>(idx), std::move(msg));
+    for (auto cat = 0U; cat < Category_NumOfValues; ++cat) {
+        insertBit(m_categories[cat], idx, cat == static_cast<unsigned>(category), m_msgs.size());
+    }
+
+    insertBit(m_matched, idx, matched, m_msgs.size());
+    insertBit(m_visible, idx, isShown(category, matched), m_msgs.size());
+    updateVisiblePrefix(idx / WordBits);
+}
+
+void MsgListModel::eraseAt(std::size_t idx)
+{
+    assert(idx < m_msgs.size());
+    m_msgs.erase(m_msgs.begin() + static_cast<std::ptrdiff_t>(idx));
+    m_index.erase(idx);
+    for (auto& bitmap : m_categories) {
+        eraseBit(bitmap, idx, m_msgs.size());
+    }
+    eraseBit(m_matched, idx, m_msgs.size());
+    eraseBit(m_visible, idx, m_msgs.size());
+    updateVisiblePrefix(idx / WordBits);
+}
+
+void MsgListModel::rebuildMatched()
+{
+    auto words = wordsCount(m_msgs.size());
+    if (m_query.isEmpty()) {
+        m_matched.assign(words, ~static_cast<Word>(0U));
+        return;
+    }
+
+    m_matched.assign(words, 0U);
+    auto positions = m_index.select(m_query);
+    for (auto idx : positions) {
+        setBit(m_matched, idx, true);
+    }
+}
+
+void MsgListModel::rebuildVisible()
+{
+    m_visible.assign(wordsCount(m_msgs.size()), 0U);
+    for (auto category = 0U; category < Category_NumOfValues; ++category) {
+        if ((m_visibleMask & (1U << category)) == 0U) {
+            continue;
+        }
+
+        auto& bitmap = m_categories[category];
+        assert(bitmap.size() == m_visible.size());
+        for (auto idx = 0U; idx < m_visible.size(); ++idx) {
+            m_visible[idx] |= bitmap[idx];
+        }
+    }
+
+    assert(m_matched.size() == m_visible.size());
+    for (auto idx = 0U; idx < m_visible.size(); ++idx) {
+        m_visible[idx] &= m_matched[idx];
+    }
+    updateVisiblePrefix(0U);
+}
+
+void MsgListModel::updateVisiblePrefix(std::size_t fromWord)
+{
+    m_visiblePrefix.resize(m_visible.size());
+    fromWord = std::min(fromWord, m_visible.size());
+    std::size_t count = 0U;
+    if (0U < fromWord) {
+        count = m_visiblePrefix[fromWord - 1] + popCount(m_visible[fromWord - 1]);
+    }
+
+    for (auto idx = fromWord; idx < m_visible.size(); ++idx) {
+        m_visiblePrefix[idx] = count;
+        count += popCount(m_visible[idx]);
+    }
+    m_visibleCount = count;
+}
+
+}  // namespace comms_champion
+
+
@@ -0,0 +1,165 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <vector>
+#include <list>
+#include <cstdint>
+#include <functional>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QAbstractListModel>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Message.h"
+#include "comms_champion/MsgQuery.h"
+#include "comms_champion/MsgHistoryIndex.h"
+
+namespace comms_champion
+{
+
+/// @brief Model of messages list.
+/// @details Keeps all the added messages (including hidden ones) in order
+///     they were added. Every message belongs to one of the categories
+///     (see @ref Category), and membership of every category is recorded in
+///     separate bitmap. Visible rows are defined by OR-ed bitmaps of the
+///     visible categories and mapped to message index using per-word
+///     prefix counts, so changing the visible categories costs O(n/64)
+///     and the view requests only the data of the rows it paints.
+///     The messages, that don't match the applied query (filter), are
+///     excluded using another bitmap, which is evaluated over indexed
+///     history (see @ref MsgHistoryIndex) when the query changes.
+class MsgListModel : public QAbstractListModel
+{
+    using Base = QAbstractListModel;
+public:
+    enum Category
+    {
+        Category_Received,
+        Category_Sent,
+        Category_Garbage,
+        Category_NumOfValues
+    };
+
+    typedef std::list<MessagePtr> MessagesList;
+    typedef std::function<QVariant (const Message& msg, int role)> DataFunc;
+
+    static const unsigned AllCategoriesMask = (1U << Category_NumOfValues) - 1;
+
+    explicit MsgListModel(QObject* parentObj = nullptr);
+    ~MsgListModel() noexcept;
+
+    template <typename TFunc>
+    void setDataFunc(TFunc&& func)
+    {
+        m_dataFunc = std::forward<TFunc>(func);
+    }
+
+    virtual int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    virtual QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    /// @brief Add message to the end of the list.
+    /// @param[in] msg Message to add.
+    /// @param[in] matched Whether the message matches current query,
+    ///     allows the caller to avoid repeated evaluation.
+    /// @return Row of the new message, -1 if it's hidden.
+    int addMessage(MessagePtr msg, bool matched = true);
+
+    /// @brief Message displayed at the provided row.
+    MessagePtr msgAt(int row) const;
+
+    /// @brief Replace message displayed at the provided row.
+    void updateMessage(int row, MessagePtr msg);
+
+    /// @brief Remove message displayed at the provided row.
+    void removeMessage(int row);
+
+    /// @brief Move message displayed at one row to another.
+    void moveMessage(int fromRow, int toRow);
+
+    /// @brief Remove all visible messages, the hidden ones are retained.
+    MessagesList removeVisible();
+
+    /// @brief Remove all the messages.
+    void clear();
+
+    /// @brief Visible messages in order of their display.
+    MessagesList visibleMsgs() const;
+
+    /// @brief Update mask of visible categories.
+    void setVisibleMask(unsigned mask);
+
+    /// @brief Retrieve mask of visible categories.
+    unsigned visibleMask() const
+    {
+        return m_visibleMask;
+    }
+
+    /// @brief Display only the messages matching the query.
+    void setQuery(const MsgQuery& query);
+
+    /// @brief Number of messages in the category, that match current query.
+    std::size_t matchedCount(Category category) const;
+
+    /// @brief Index of the message in the history given the row.
+    std::size_t historyIdx(int row) const;
+
+    /// @brief Row of the message given its index in the history.
+    /// @return Row or -1 if the message is hidden
+    int historyIdxToRow(std::size_t idx) const;
+
+    static Category msgCategory(const Message& msg);
+
+private:
+    typedef std::uint64_t Word;
+    typedef std::vector<Word> Bitmap;
+    static const std::size_t WordBits = sizeof(Word) * 8;
+
+    static bool testBit(const Bitmap& bitmap, std::size_t idx);
+    static void setBit(Bitmap& bitmap, std::size_t idx, bool value);
+    static void insertBit(Bitmap& bitmap, std::size_t idx, bool value, std::size_t count);
+    static void eraseBit(Bitmap& bitmap, std::size_t idx, std::size_t count);
+    static unsigned popCount(Word word);
+    static unsigned selectInWord(Word word, unsigned rank);
+
+    Category categoryOf(std::size_t idx) const;
+    bool isShown(Category category, bool matched) const;
+    void insertAt(std::size_t idx, MessagePtr msg, Category category, bool matched);
+    void eraseAt(std::size_t idx);
+    void rebuildMatched();
+    void rebuildVisible();
+    void updateVisiblePrefix(std::size_t fromWord);
+
+    std::vector<MessagePtr> m_msgs;
+    Bitmap m_categories[Category_NumOfValues];
+    Bitmap m_matched;
+    Bitmap m_visible;
+    std::vector<std::size_t> m_visiblePrefix;
+    std::size_t m_visibleCount = 0U;
+    unsigned m_visibleMask = AllCategoriesMask;
+    DataFunc m_dataFunc;
+    MsgHistoryIndex m_index;
+    MsgQuery m_query;
+};
+
+}  // namespace comms_champion
+
+
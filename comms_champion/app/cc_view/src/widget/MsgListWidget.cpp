@@ -18,12 +18,15 @@
 #include "MsgListWidget.h"
 
 #include <cassert>
+#include <functional>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
 #include <QtCore/QVariant>
 #include <QtCore/QDateTime>
+#include <QtGui/QBrush>
+#include <QtCore/QItemSelectionModel>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Message.h"
@@ -48,50 +51,48 @@ MsgListWidget::MsgListWidget(
 {
     m_ui.setupUi(this);
     m_ui.m_groupBoxLayout->insertWidget(0, toolbar);
+
+    m_model.setDataFunc(
+        [this](const Message& msg, int role) -> QVariant
+        {
+            return getItemData(msg, role);
+        });
+
+    m_ui.m_listView->setUniformItemSizes(true);
+    m_ui.m_listView->setModel(&m_model);
     updateTitle();
 
-    m_ui.m_listWidget->setUniformItemSizes(true);
     connect(
-        m_ui.m_listWidget, SIGNAL(itemClicked(QListWidgetItem*)),
-        this, SLOT(itemClicked(QListWidgetItem*)));
+        m_ui.m_listView, SIGNAL(clicked(const QModelIndex&)),
+        this, SLOT(itemClicked(const QModelIndex&)));
     connect(
-        m_ui.m_listWidget, SIGNAL(currentItemChanged(QListWidgetItem*, QListWidgetItem*)),
-        this, SLOT(currentItemChanged(QListWidgetItem*, QListWidgetItem*)));
+        m_ui.m_listView->selectionModel(), SIGNAL(currentChanged(const QModelIndex&, const QModelIndex&)),
+        this, SLOT(currentItemChanged(const QModelIndex&, const QModelIndex&)));
     connect(
-        m_ui.m_listWidget, SIGNAL(itemDoubleClicked(QListWidgetItem*)),
-        this, SLOT(itemDoubleClicked(QListWidgetItem*)));
+        m_ui.m_listView, SIGNAL(doubleClicked(const QModelIndex&)),
+        this, SLOT(itemDoubleClicked(const QModelIndex&)));
 }
 
 void MsgListWidget::addMessage(MessagePtr msg)
 {
-    assert(msg);
-    m_ui.m_listWidget->addItem(getMsgNameText(msg));
-    auto* item = m_ui.m_listWidget->item(m_ui.m_listWidget->count() - 1);
-    item->setToolTip(msgTooltipImpl());
-
-    bool valid = msg->isValid();
+    addMessage(std::move(msg), true);
+}
 
-    auto type = property::message::Type().getFrom(*msg);
-    if ((type != MsgType::Invalid) && (!msg->idAsString().isEmpty())) {
-        item->setForeground(getItemColourImpl(type, valid));
-    }
-    else {
-        item->setForeground(defaultItemColour(valid));
+void MsgListWidget::addMessage(MessagePtr msg, bool matched)
+{
+    assert(msg);
+    auto row = m_model.addMessage(std::move(msg), matched);
+    if (row < 0) {
+        return;
     }
 
-    item->setData(
-        Qt::UserRole,
-        QVariant::fromValue(msg));
-
     if (m_selectOnAdd) {
-        m_ui.m_listWidget->blockSignals(true);
-        m_ui.m_listWidget->setCurrentRow(m_ui.m_listWidget->count() - 1);
-        m_ui.m_listWidget->blockSignals(false);
-        assert(m_ui.m_listWidget->currentItem() == item);
+        setCurrentRow(row);
+        assert(currentRow() == row);
     }
 
-    if (m_ui.m_listWidget->currentRow() < 0) {
-        m_ui.m_listWidget->scrollToBottom();
+    if (currentRow() < 0) {
+        m_ui.m_listView->scrollToBottom();
     }
 
     updateTitle();
@@ -99,52 +100,32 @@ void MsgListWidget::addMessage(MessagePtr msg)
 
 void MsgListWidget::updateCurrentMessage(MessagePtr msg)
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    if (item == nullptr) {
+    auto row = currentRow();
+    if (row < 0) {
         assert(!"No item is selected for update");
         return;
     }
 
-    item->setData(
-        Qt::UserRole,
-        QVariant::fromValue(msg));
-
-    item->setText(getMsgNameText(msg));
-
-    if ((!msg) || (msg->idAsString().isEmpty())) {
-        item->setForeground(defaultItemColour(false));
-        return;
-    }
-
-    bool valid = msg->isValid();
-
-    auto type = property::message::Type().getFrom(*msg);
-    if (type != MsgType::Invalid) {
-        item->setForeground(getItemColourImpl(type, valid));
-    }
-    else {
-        item->setForeground(defaultItemColour(valid));
-    }
+    m_model.updateMessage(row, std::move(msg));
 }
 
 void MsgListWidget::deleteCurrentMessage()
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    if (item == nullptr) {
+    auto row = currentRow();
+    if (row < 0) {
         assert(!"No item is selected for deletion");
         return;
     }
 
-    m_ui.m_listWidget->blockSignals(true);
-    delete item; // will remove from the list
-    m_ui.m_listWidget->blockSignals(false);
-
+    m_ignoreCurrentChange = true;
+    m_model.removeMessage(row);
+    m_ignoreCurrentChange = false;
 
     updateTitle();
 
-    auto* nextItem = m_ui.m_listWidget->currentItem();
-    if (nextItem != nullptr) {
-        processClick(nextItem);
+    auto nextRow = currentRow();
+    if (0 <= nextRow) {
+        processClick(nextRow);
     }
 }
 
@@ -155,32 +136,33 @@ void MsgListWidget::selectOnAdd(bool enabled)
 
 void MsgListWidget::clearSelection()
 {
-    m_ui.m_listWidget->clearSelection();
-    m_ui.m_listWidget->setCurrentRow(-1);
+    m_ui.m_listView->clearSelection();
+    m_ui.m_listView->setCurrentIndex(QModelIndex());
 }
 
 void MsgListWidget::clearList(bool reportDeleted)
 {
-    MessagesList msgsList;
-    if (reportDeleted) {
-        auto count = m_ui.m_listWidget->count();
-        for (auto idx = 0; idx < count; ++idx) {
-            auto* item = m_ui.m_listWidget->item(idx);
-            auto msg = getMsgFromItem(item);
-            msgsList.push_back(std::move(msg));
-        }
+    if (!reportDeleted) {
+        clearList();
+        return;
     }
 
-    clearList();
-
-    if (reportDeleted) {
-        msgListClearedImpl(std::move(msgsList));
-    }
+    // Only the displayed messages are removed, the hidden ones
+    // stay in the history.
+    m_ignoreCurrentChange = true;
+    auto msgsList = m_model.removeVisible();
+    m_ignoreCurrentChange = false;
+    m_selectedMsg = nullptr;
+    updateTitle();
+    msgListClearedImpl(std::move(msgsList));
 }
 
 void MsgListWidget::clearList()
 {
-    m_ui.m_listWidget->clear();
+    m_ignoreCurrentChange = true;
+    m_model.clear();
+    m_ignoreCurrentChange = false;
+    m_selectedMsg = nullptr;
     updateTitle();
 }
 
@@ -191,7 +173,7 @@ void MsgListWidget::stateChanged(int state)
 
 void MsgListWidget::moveSelectedTop()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
+    auto curRow = currentRow();
     if (curRow <= 0) {
         assert(!"No item is selected or moving up top item");
         return;
@@ -202,7 +184,7 @@ void MsgListWidget::moveSelectedTop()
 
 void MsgListWidget::moveSelectedUp()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
+    auto curRow = currentRow();
     if (curRow <= 0) {
         assert(!"No item is selected or moving up top item");
         return;
@@ -213,8 +195,8 @@ void MsgListWidget::moveSelectedUp()
 
 void MsgListWidget::moveSelectedDown()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
-    if ((m_ui.m_listWidget->count() - 1) <= curRow) {
+    auto curRow = currentRow();
+    if ((m_model.rowCount() - 1) <= curRow) {
         assert(!"No item is selected or moving down bottom item");
         return;
     }
@@ -224,13 +206,13 @@ void MsgListWidget::moveSelectedDown()
 
 void MsgListWidget::moveSelectedBottom()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
-    if ((m_ui.m_listWidget->count() - 1) <= curRow) {
+    auto curRow = currentRow();
+    if ((m_model.rowCount() - 1) <= curRow) {
         assert(!"No item is selected or moving down bottom item");
         return;
     }
 
-    moveItem(curRow, m_ui.m_listWidget->count() - 1);
+    moveItem(curRow, m_model.rowCount() - 1);
 }
 
 void MsgListWidget::titleNeedsUpdate()
@@ -258,10 +240,8 @@ void MsgListWidget::saveMessages(const QString& filename)
 
 void MsgListWidget::selectMsg(int idx)
 {
-    assert(idx < m_ui.m_listWidget->count());
-    m_ui.m_listWidget->blockSignals(true);
-    m_ui.m_listWidget->setCurrentRow(idx);
-    m_ui.m_listWidget->blockSignals(false);
+    assert(idx < m_model.rowCount());
+    setCurrentRow(idx);
 }
 
 void MsgListWidget::msgClickedImpl(MessagePtr msg, int idx)
@@ -325,29 +305,55 @@ void MsgListWidget::saveMessagesImpl(const QString& filename)
     static_cast<void>(filename);
 }
 
+void MsgListWidget::filterAppliedImpl()
+{
+}
+
 MessagePtr MsgListWidget::currentMsg() const
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    assert(item != nullptr);
-    return getMsgFromItem(item);
+    auto row = currentRow();
+    assert(0 <= row);
+    return m_model.msgAt(row);
 }
 
 MsgListWidget::MessagesList MsgListWidget::allMsgs() const
 {
-    MessagesList allMsgsList;
-    for (auto idx = 0; idx < m_ui.m_listWidget->count(); ++idx) {
-        auto* item = m_ui.m_listWidget->item(idx);
-        auto msgPtr = getMsgFromItem(item);
-        assert(msgPtr);
-        allMsgsList.push_back(std::move(msgPtr));
+    return m_model.visibleMsgs();
+}
+
+std::size_t MsgListWidget::matchedCount(MsgListModel::Category category) const
+{
+    return m_model.matchedCount(category);
+}
+
+void MsgListWidget::setVisibleCategories(unsigned mask)
+{
+    if (mask == m_model.visibleMask()) {
+        return;
     }
-    return allMsgsList;
+
+    updateVisible(
+        [this, mask]()
+        {
+            m_model.setVisibleMask(mask);
+        });
 }
 
-void MsgListWidget::itemClicked(QListWidgetItem* item)
+void MsgListWidget::setFilter(const MsgQuery& filter)
 {
-    assert(item != nullptr);
-    if (m_selectedItem == item) {
+    updateVisible(
+        [this, &filter]()
+        {
+            m_model.setQuery(filter);
+        });
+    filterAppliedImpl();
+}
+
+void MsgListWidget::itemClicked(const QModelIndex& index)
+{
+    assert(index.isValid());
+    auto msg = m_model.msgAt(index.row());
+    if (m_selectedMsg == msg.get()) {
         assert(0 < m_lastSelectionTimestamp);
         auto timestamp = QDateTime::currentMSecsSinceEpoch();
         static const decltype(timestamp) MinThreshold = 250;
@@ -356,46 +362,65 @@ void MsgListWidget::itemClicked(QListWidgetItem* item)
         }
     }
 
-    processClick(item);
+    processClick(index.row());
 }
 
-void MsgListWidget::currentItemChanged(QListWidgetItem* current, QListWidgetItem* prev)
+void MsgListWidget::currentItemChanged(const QModelIndex& current, const QModelIndex& prev)
 {
     static_cast<void>(prev);
 
-    m_selectedItem = current;
-    if (current != nullptr) {
+    if (m_ignoreCurrentChange) {
+        return;
+    }
+
+    if (current.isValid()) {
+        m_selectedMsg = m_model.msgAt(current.row()).get();
         m_lastSelectionTimestamp = QDateTime::currentMSecsSinceEpoch();
-        processClick(current);
+        processClick(current.row());
         return;
     }
 
+    m_selectedMsg = nullptr;
     m_lastSelectionTimestamp = 0;
     return;
 }
 
-void MsgListWidget::itemDoubleClicked(QListWidgetItem* item)
+void MsgListWidget::itemDoubleClicked(const QModelIndex& index)
 {
     msgDoubleClickedImpl(
-        getMsgFromItem(item),
-        m_ui.m_listWidget->row(item));
+        m_model.msgAt(index.row()),
+        index.row());
 }
 
-MessagePtr MsgListWidget::getMsgFromItem(QListWidgetItem* item) const
+QVariant MsgListWidget::getItemData(const Message& msg, int role) const
 {
-    auto var = item->data(Qt::UserRole);
-    assert(var.canConvert<MessagePtr>());
-    return var.value<MessagePtr>();
+    if (role == Qt::DisplayRole) {
+        return getMsgNameText(msg);
+    }
+
+    if (role == Qt::ToolTipRole) {
+        return msgTooltipImpl();
+    }
+
+    if (role == Qt::ForegroundRole) {
+        bool valid = msg.isValid();
+        auto type = property::message::Type().getFrom(msg);
+        if ((type != MsgType::Invalid) && (!msg.idAsString().isEmpty())) {
+            return QBrush(getItemColourImpl(type, valid));
+        }
+        return QBrush(defaultItemColour(valid));
+    }
+
+    return QVariant();
 }
 
-QString MsgListWidget::getMsgNameText(MessagePtr msg)
+QString MsgListWidget::getMsgNameText(const Message& msg) const
 {
-    assert(msg);
-    auto itemStr = msgPrefixImpl(*msg);
+    auto itemStr = msgPrefixImpl(msg);
     if (!itemStr.isEmpty()) {
         itemStr.append(": ");
     }
-    itemStr.append(msg->name());
+    itemStr.append(msg.nameAsString());
     return itemStr;
 }
 
@@ -407,13 +432,30 @@ Qt::GlobalColor MsgListWidget::defaultItemColour(bool valid) const
     return Qt::red;
 }
 
+int MsgListWidget::currentRow() const
+{
+    auto index = m_ui.m_listView->currentIndex();
+    if (!index.isValid()) {
+        return -1;
+    }
+    return index.row();
+}
+
+void MsgListWidget::setCurrentRow(int row)
+{
+    m_ignoreCurrentChange = true;
+    m_ui.m_listView->setCurrentIndex(m_model.index(row));
+    m_ignoreCurrentChange = false;
+}
+
 void MsgListWidget::moveItem(int fromRow, int toRow)
 {
-    assert(fromRow < m_ui.m_listWidget->count());
-    auto* item = m_ui.m_listWidget->takeItem(fromRow);
-    assert(toRow <= m_ui.m_listWidget->count());
-    m_ui.m_listWidget->insertItem(toRow, item);
-    m_ui.m_listWidget->setCurrentRow(toRow);
+    assert(fromRow < m_model.rowCount());
+    assert(toRow < m_model.rowCount());
+    m_ignoreCurrentChange = true;
+    m_model.moveMessage(fromRow, toRow);
+    m_ignoreCurrentChange = false;
+    setCurrentRow(toRow);
     msgMovedImpl(toRow);
 }
 
@@ -421,15 +463,42 @@ void MsgListWidget::updateTitle()
 {
     auto title =
         m_title +
-        QString(" [%1]").arg(m_ui.m_listWidget->count(), 1, 10, QChar('0'));
+        QString(" [%1]").arg(m_model.rowCount(), 1, 10, QChar('0'));
     m_ui.m_groupBox->setTitle(title);
 }
 
-void MsgListWidget::processClick(QListWidgetItem* item)
+void MsgListWidget::processClick(int row)
 {
     msgClickedImpl(
-        getMsgFromItem(item),
-        m_ui.m_listWidget->row(item));
+        m_model.msgAt(row),
+        row);
+}
+
+void MsgListWidget::updateVisible(const std::function<void ()>& func)
+{
+    // Keep the selection if the selected message remains visible
+    std::size_t selectedIdx = 0U;
+    auto selectedRow = currentRow();
+    if (0 <= selectedRow) {
+        selectedIdx = m_model.historyIdx(selectedRow);
+    }
+
+    m_ignoreCurrentChange = true;
+    func();
+    if (0 <= selectedRow) {
+        selectedRow = m_model.historyIdxToRow(selectedIdx);
+    }
+
+    if (0 <= selectedRow) {
+        m_ui.m_listView->setCurrentIndex(m_model.index(selectedRow));
+        m_ui.m_listView->scrollTo(m_model.index(selectedRow));
+    }
+    else {
+        m_selectedMsg = nullptr;
+        m_ui.m_listView->scrollToBottom();
+    }
+    m_ignoreCurrentChange = false;
+    updateTitle();
 }
 
 
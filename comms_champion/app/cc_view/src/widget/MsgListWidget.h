@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
@@ -30,8 +32,10 @@ CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Message.h"
 #include "comms_champion/Protocol.h"
+#include "comms_champion/MsgQuery.h"
 
 #include "GuiAppMgr.h"
+#include "MsgListModel.h"
 
 namespace comms_champion
 {
@@ -53,6 +57,7 @@ public:
 
 protected slots:
     void addMessage(MessagePtr msg);
+    void addMessage(MessagePtr msg, bool matched);
     void updateCurrentMessage(MessagePtr msg);
     void deleteCurrentMessage();
     void selectOnAdd(bool enabled);
@@ -68,6 +73,8 @@ protected slots:
     void loadMessages(bool clearExisting, const QString& filename, ProtocolPtr protocol);
     void saveMessages(const QString& filename);
     void selectMsg(int idx);
+    void setVisibleCategories(unsigned mask);
+    void setFilter(const MsgQuery& filter);
 
 protected:
     virtual void msgClickedImpl(MessagePtr msg, int idx);
@@ -81,28 +88,35 @@ protected:
     virtual QString getTitleImpl() const;
     virtual void loadMessagesImpl(const QString& filename, Protocol& protocol);
     virtual void saveMessagesImpl(const QString& filename);
+    virtual void filterAppliedImpl();
 
     MessagePtr currentMsg() const;
     MessagesList allMsgs() const;
+    std::size_t matchedCount(MsgListModel::Category category) const;
 
 private slots:
-    void itemClicked(QListWidgetItem* item);
-    void currentItemChanged(QListWidgetItem* current, QListWidgetItem* prev);
-    void itemDoubleClicked(QListWidgetItem* item);
+    void itemClicked(const QModelIndex& index);
+    void currentItemChanged(const QModelIndex& current, const QModelIndex& prev);
+    void itemDoubleClicked(const QModelIndex& index);
 
 private:
-    MessagePtr getMsgFromItem(QListWidgetItem* item) const;
-    QString getMsgNameText(MessagePtr msg);
+    QVariant getItemData(const Message& msg, int role) const;
+    QString getMsgNameText(const Message& msg) const;
     Qt::GlobalColor defaultItemColour(bool valid) const;
+    int currentRow() const;
+    void setCurrentRow(int row);
     void moveItem(int fromRow, int toRow);
     void updateTitle();
-    void processClick(QListWidgetItem* item);
+    void processClick(int row);
+    void updateVisible(const std::function<void ()>& func);
 
     Ui::MsgListWidget m_ui;
+    MsgListModel m_model;
     bool m_selectOnAdd = false;
+    bool m_ignoreCurrentChange = false;
     QString m_title;
     qint64 m_lastSelectionTimestamp = 0;
-    QListWidgetItem* m_selectedItem = nullptr;
+    const Message* m_selectedMsg = nullptr;
 };
 
 }  // namespace comms_champion
@@ -0,0 +1,238 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "PipelineStatsDialog.h"
+
+#include <cassert>
+#include <utility>
+#include <type_traits>
+
+CC_DISABLE_WARNINGS()
+#include <QtWidgets/QCheckBox>
+#include <QtWidgets/QPushButton>
+#include <QtWidgets/QTreeWidget>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QVBoxLayout>
+#include <QtWidgets/QHBoxLayout>
+#include <QtWidgets/QDialogButtonBox>
+CC_ENABLE_WARNINGS()
+
+#include "GuiAppMgr.h"
+
+namespace comms_champion
+{
+
+namespace
+{
+
+const int RefreshInterval = 1000;
+
+QTreeWidget* createTable(const QStringList& headers)
+{
+    auto* table = new QTreeWidget();
+    table->setColumnCount(headers.size());
+    table->setHeaderLabels(headers);
+    table->setRootIsDecorated(false);
+    table->setUniformRowHeights(true);
+    table->setSelectionMode(QAbstractItemView::NoSelection);
+    table->header()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    return table;
+}
+
+void setRowsCount(QTreeWidget& table, int count)
+{
+    while (count < table.topLevelItemCount()) {
+        delete table.takeTopLevelItem(table.topLevelItemCount() - 1);
+    }
+
+    while (table.topLevelItemCount() < count) {
+        table.addTopLevelItem(new QTreeWidgetItem());
+    }
+}
+
+QString numStr(unsigned long long value)
+{
+    return QString::number(value);
+}
+
+QString usStr(unsigned long long ns)
+{
+    return QString::number(static_cast<double>(ns) / 1000.0, 'f', 1);
+}
+
+}  // namespace
+
+PipelineStatsDialog::PipelineStatsDialog(QWidget* parentObj)
+  : Base(parentObj)
+{
+    setWindowTitle(tr("Pipeline Statistics"));
+
+    m_enableCheckBox = new QCheckBox(tr("Collect statistics"));
+    m_enableCheckBox->setChecked(GuiAppMgr::instanceRef().pipelineStatsEnabled());
+    connect(
+        m_enableCheckBox, SIGNAL(toggled(bool)),
+        this, SLOT(enableToggled(bool)));
+
+    auto* resetButton = new QPushButton(tr("Reset"));
+    connect(
+        resetButton, SIGNAL(clicked()),
+        this, SLOT(resetClicked()));
+
+    m_durationLabel = new QLabel();
+
+    auto* controlsLayout = new QHBoxLayout();
+    controlsLayout->addWidget(m_enableCheckBox);
+    controlsLayout->addWidget(resetButton);
+    controlsLayout->addStretch();
+    controlsLayout->addWidget(m_durationLabel);
+
+    m_summary = createTable(QStringList() << tr("Counter") << tr("Value"));
+    m_stages =
+        createTable(
+            QStringList() << tr("Stage") << tr("Count") << tr("Avg (us)") <<
+                tr("P50 (us)") << tr("P99 (us)") << tr("Max (us)"));
+    m_msgTypes =
+        createTable(
+            QStringList() << tr("ID") << tr("Name") << tr("Count") <<
+                tr("Rate (msg/s)") << tr("Bytes") << tr("Min Size") << tr("Max Size"));
+
+    auto* buttons = new QDialogButtonBox(QDialogButtonBox::Close);
+    connect(
+        buttons, SIGNAL(rejected()),
+        this, SLOT(reject()));
+
+    auto* mainLayout = new QVBoxLayout();
+    mainLayout->addLayout(controlsLayout);
+    mainLayout->addWidget(m_summary);
+    mainLayout->addWidget(m_stages);
+    mainLayout->addWidget(m_msgTypes, 1);
+    mainLayout->addWidget(buttons);
+    setLayout(mainLayout);
+
+    resize(640, 600);
+
+    connect(
+        &m_refreshTimer, SIGNAL(timeout()),
+        this, SLOT(refresh()));
+}
+
+PipelineStatsDialog::~PipelineStatsDialog() noexcept = default;
+
+void PipelineStatsDialog::showEvent(QShowEvent* event)
+{
+    Base::showEvent(event);
+    m_enableCheckBox->setChecked(GuiAppMgr::instanceRef().pipelineStatsEnabled());
+    refresh();
+    m_refreshTimer.start(RefreshInterval);
+}
+
+void PipelineStatsDialog::hideEvent(QHideEvent* event)
+{
+    m_refreshTimer.stop();
+    Base::hideEvent(event);
+}
+
+void PipelineStatsDialog::enableToggled(bool checked)
+{
+    GuiAppMgr::instanceRef().setPipelineStatsEnabled(checked);
+    refresh();
+}
+
+void PipelineStatsDialog::resetClicked()
+{
+    GuiAppMgr::instanceRef().resetPipelineStats();
+    refresh();
+}
+
+void PipelineStatsDialog::refresh()
+{
+    auto stats = GuiAppMgr::instanceRef().pipelineStats();
+    m_durationLabel->setText(
+        tr("Collected during %1 s").arg(
+            static_cast<double>(stats.m_durationMs) / 1000.0, 0, 'f', 1));
+    updateSummary(stats);
+    updateStages(stats);
+    updateMsgTypes(stats);
+}
+
+void PipelineStatsDialog::updateSummary(const PipelineStats& stats)
+{
+    const std::pair<QString, QString> Rows[] = {
+        std::make_pair(tr("Received data chunks"), numStr(stats.m_recvChunks)),
+        std::make_pair(tr("Received bytes"), numStr(stats.m_recvBytes)),
+        std::make_pair(tr("Received bytes rate (bytes/s)"), QString::number(stats.rate(stats.m_recvBytes), 'f', 1)),
+        std::make_pair(tr("Received messages"), numStr(stats.m_recvMsgs)),
+        std::make_pair(tr("Received messages rate (msg/s)"), QString::number(stats.rate(stats.m_recvMsgs), 'f', 1)),
+        std::make_pair(tr("Sent messages"), numStr(stats.m_sentMsgs)),
+        std::make_pair(tr("Sent bytes"), numStr(stats.m_sentBytes)),
+        std::make_pair(tr("Invalid messages"), numStr(stats.m_invalidMsgs)),
+        std::make_pair(tr("Garbage bytes"), numStr(stats.m_garbageBytes)),
+        std::make_pair(tr("Errors"), numStr(stats.m_errors)),
+        std::make_pair(tr("Max queue depth"), numStr(stats.m_maxQueueDepth)),
+        std::make_pair(tr("Messages in history"), numStr(stats.m_historySize))
+    };
+
+    setRowsCount(*m_summary, static_cast<int>(std::extent<decltype(Rows)>::value));
+    auto idx = 0;
+    for (auto& row : Rows) {
+        auto* item = m_summary->topLevelItem(idx);
+        assert(item != nullptr);
+        item->setText(0, row.first);
+        item->setText(1, row.second);
+        ++idx;
+    }
+}
+
+void PipelineStatsDialog::updateStages(const PipelineStats& stats)
+{
+    auto count = static_cast<int>(PipelineStats::Stage::NumOfValues);
+    setRowsCount(*m_stages, count);
+    for (auto idx = 0; idx < count; ++idx) {
+        auto stage = static_cast<PipelineStats::Stage>(idx);
+        auto& hist = stats.stage(stage);
+        auto* item = m_stages->topLevelItem(idx);
+        assert(item != nullptr);
+        item->setText(0, PipelineStats::stageName(stage));
+        item->setText(1, numStr(hist.m_count));
+        item->setText(2, usStr(hist.averageNs()));
+        item->setText(3, numStr(hist.percentileUs(50)));
+        item->setText(4, numStr(hist.percentileUs(99)));
+        item->setText(5, usStr(hist.m_maxNs));
+    }
+}
+
+void PipelineStatsDialog::updateMsgTypes(const PipelineStats& stats)
+{
+    setRowsCount(*m_msgTypes, static_cast<int>(stats.m_msgTypes.size()));
+    auto idx = 0;
+    for (auto& info : stats.m_msgTypes) {
+        auto* item = m_msgTypes->topLevelItem(idx);
+        assert(item != nullptr);
+        item->setText(0, info.m_id);
+        item->setText(1, info.m_name);
+        item->setText(2, numStr(info.m_count));
+        item->setText(3, QString::number(stats.rate(info.m_count), 'f', 1));
+        item->setText(4, numStr(info.m_bytes));
+        item->setText(5, numStr(info.m_minSize));
+        item->setText(6, numStr(info.m_maxSize));
+        ++idx;
+    }
+}
+
+}  // namespace comms_champion
+
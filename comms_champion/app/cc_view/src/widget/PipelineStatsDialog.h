@@ -0,0 +1,67 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtWidgets/QDialog>
+#include <QtCore/QTimer>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/PipelineStats.h"
+
+class QCheckBox;
+class QTreeWidget;
+class QLabel;
+
+namespace comms_champion
+{
+
+class PipelineStatsDialog : public QDialog
+{
+    Q_OBJECT
+    using Base = QDialog;
+public:
+    PipelineStatsDialog(QWidget* parentObj = nullptr);
+    ~PipelineStatsDialog() noexcept;
+
+protected:
+    virtual void showEvent(QShowEvent* event) override;
+    virtual void hideEvent(QHideEvent* event) override;
+
+private slots:
+    void enableToggled(bool checked);
+    void resetClicked();
+    void refresh();
+
+private:
+    void updateSummary(const PipelineStats& stats);
+    void updateStages(const PipelineStats& stats);
+    void updateMsgTypes(const PipelineStats& stats);
+
+    QCheckBox* m_enableCheckBox = nullptr;
+    QLabel* m_durationLabel = nullptr;
+    QTreeWidget* m_summary = nullptr;
+    QTreeWidget* m_stages = nullptr;
+    QTreeWidget* m_msgTypes = nullptr;
+    QTimer m_refreshTimer;
+};
+
+} // namespace comms_champion
+
@@ -24,6 +24,7 @@
 CC_DISABLE_WARNINGS()
 #include <QtCore/QObject>
 #include <QtWidgets/QAction>
+#include <QtWidgets/QLineEdit>
 #include <QtGui/QIcon>
 CC_ENABLE_WARNINGS()
 
@@ -37,6 +38,11 @@ namespace
 
 const QString StartTooltip("Start Reception");
 const QString StopTooltip("Stop Reception");
+const QString FilterTooltip(
+    "Display only messages matching the expression, for example:\n"
+    "id == 5 && (value > 10 || name == \"abc\")\n"
+    "Use \"id\", \"time\", \"dir\" or field names on the left side.");
+const QString InvalidFilterStyle("QLineEdit { background-color: #ffd0d0; }");
 
 QAction* createStartButton(QToolBar& bar)
 {
@@ -116,7 +122,15 @@ QAction* createShowSent(QToolBar& bar)
     return action;
 }
 
-
+QLineEdit* createFilterEdit()
+{
+    auto* edit = new QLineEdit();
+    edit->setPlaceholderText("Filter");
+    edit->setToolTip(FilterTooltip);
+    edit->setClearButtonEnabled(true);
+    edit->setMinimumWidth(200);
+    return edit;
+}
 
 }  // namespace
 
@@ -130,6 +144,7 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
     m_showGarbageButton(createShowGarbage(*this)),
     m_showRecvButton(createShowReceived(*this)),
     m_showSentButton(createShowSent(*this)),
+    m_filterEdit(createFilterEdit()),
     m_state(GuiAppMgr::instance()->recvState()),
     m_sendState(GuiAppMgr::instance()->sendState()),
     m_activeState(GuiAppMgr::instance()->getActivityState())
@@ -138,6 +153,14 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
     auto empty = new QWidget();
     empty->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
     insertWidget(m_showGarbageButton, empty);
+    insertWidget(m_showGarbageButton, m_filterEdit);
+
+    connect(
+        m_filterEdit, SIGNAL(returnPressed()),
+        this, SLOT(filterEntered()));
+    connect(
+        m_filterEdit, SIGNAL(textChanged(const QString&)),
+        this, SLOT(filterTextChanged(const QString&)));
 
     connect(
         m_startStopButton, SIGNAL(triggered()),
@@ -225,6 +248,27 @@ void RecvAreaToolBar::activeStateChanged(int state)
     refresh();
 }
 
+void RecvAreaToolBar::filterEntered()
+{
+    auto* guiAppMgr = GuiAppMgr::instance();
+    if (!guiAppMgr->recvFilterUpdated(m_filterEdit->text())) {
+        m_filterEdit->setStyleSheet(InvalidFilterStyle);
+        m_filterEdit->setToolTip(guiAppMgr->recvFilter().errorString());
+        return;
+    }
+
+    m_filterEdit->setStyleSheet(QString());
+    m_filterEdit->setToolTip(FilterTooltip);
+}
+
+void RecvAreaToolBar::filterTextChanged(const QString& text)
+{
+    // Cleared filter is applied immediately, the rest on "Enter"
+    if (text.isEmpty()) {
+        filterEntered();
+    }
+}
+
 void RecvAreaToolBar::refresh()
 {
     refreshStartStopButton();
@@ -30,6 +30,7 @@ CC_ENABLE_WARNINGS()
 #include "GuiAppMgr.h"
 
 class QAction;
+class QLineEdit;
 
 namespace comms_champion
 {
@@ -52,6 +53,8 @@ private slots:
     void recvStateChanged(int state);
     void sendStateChanged(int state);
     void activeStateChanged(int state);
+    void filterEntered();
+    void filterTextChanged(const QString& text);
 
 private:
     void refresh();
@@ -72,6 +75,7 @@ private:
     QAction* m_showGarbageButton = nullptr;
     QAction* m_showRecvButton = nullptr;
     QAction* m_showSentButton = nullptr;
+    QLineEdit* m_filterEdit = nullptr;
     State m_state = State::Idle;
     SendState m_sendState = SendState::Idle;
     ActivityState m_activeState = ActivityState::Inactive;
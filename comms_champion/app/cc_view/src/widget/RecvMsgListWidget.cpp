@@ -34,6 +34,12 @@ CC_ENABLE_WARNINGS()
 namespace comms_champion
 {
 
+static_assert(
+    (GuiAppMgr::RecvListMode_ShowReceived == (1U << MsgListModel::Category_Received)) &&
+    (GuiAppMgr::RecvListMode_ShowSent == (1U << MsgListModel::Category_Sent)) &&
+    (GuiAppMgr::RecvListMode_ShowGarbage == (1U << MsgListModel::Category_Garbage)),
+    "Receive list modes must match the categories of the list model");
+
 RecvMsgListWidget::RecvMsgListWidget(QWidget* parentObj)
   : Base(getTitlePrefix(), new RecvAreaToolBar(), parentObj)
 {
@@ -41,10 +47,11 @@ RecvMsgListWidget::RecvMsgListWidget(QWidget* parentObj)
     assert(guiMgr != nullptr);
 
     selectOnAdd(guiMgr->recvMsgListSelectOnAddEnabled());
+    setVisibleCategories(guiMgr->recvListModeMask());
 
     connect(
-        guiMgr, SIGNAL(sigAddRecvMsg(MessagePtr)),
-        this, SLOT(addMessage(MessagePtr)));
+        guiMgr, SIGNAL(sigAddRecvMsg(MessagePtr, bool)),
+        this, SLOT(addMessage(MessagePtr, bool)));
     connect(
         guiMgr, SIGNAL(sigRecvMsgListSelectOnAddEnabled(bool)),
         this, SLOT(selectOnAdd(bool)));
@@ -63,6 +70,12 @@ RecvMsgListWidget::RecvMsgListWidget(QWidget* parentObj)
     connect(
         guiMgr, SIGNAL(sigRecvSaveMsgs(const QString&)),
         this, SLOT(saveMessages(const QString&)));
+    connect(
+        guiMgr, SIGNAL(sigRecvListModeChanged(unsigned)),
+        this, SLOT(setVisibleCategories(unsigned)));
+    connect(
+        guiMgr, SIGNAL(sigRecvFilterChanged(const MsgQuery&)),
+        this, SLOT(setFilter(const MsgQuery&)));
 
 }
 
@@ -116,6 +129,14 @@ void RecvMsgListWidget::saveMessagesImpl(const QString& filename)
     MsgFileMgrG::instanceRef().save(MsgFileMgr::Type::Recv, filename, allMsgs());
 }
 
+void RecvMsgListWidget::filterAppliedImpl()
+{
+    GuiAppMgr::instance()->recvListFilterApplied(
+        static_cast<unsigned>(matchedCount(MsgListModel::Category_Received)),
+        static_cast<unsigned>(matchedCount(MsgListModel::Category_Sent)),
+        static_cast<unsigned>(matchedCount(MsgListModel::Category_Garbage)));
+}
+
 QString RecvMsgListWidget::getTitlePrefix()
 {
     auto* guiAppMgr = GuiAppMgr::instance();
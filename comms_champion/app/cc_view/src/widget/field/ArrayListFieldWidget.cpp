@@ -20,11 +20,126 @@
 #include <algorithm>
 #include <cassert>
 
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QAbstractListModel>
+#include <QtGui/QBrush>
+CC_ENABLE_WARNINGS()
+
 #include "comms_champion/property/field.h"
 
 namespace comms_champion
 {
 
+/// @brief Model of the list elements displayed by the list view.
+/// @details Every element is displayed (and can be edited) as its
+///     serialised value, the data is requested only for the visible rows.
+class ArrayListFieldWidget::ElementsModel : public QAbstractListModel
+{
+    using Base = QAbstractListModel;
+public:
+    typedef std::function<void ()> ElementUpdatedFunc;
+
+    ElementsModel() = default;
+
+    template <typename TFunc>
+    void setElementUpdatedCallback(TFunc&& func)
+    {
+        m_elementUpdatedCallback = std::forward<TFunc>(func);
+    }
+
+    void setWrapper(Wrapper* wrapper)
+    {
+        beginResetModel();
+        m_wrapper = wrapper;
+        endResetModel();
+    }
+
+    void setEditEnabled(bool enabled)
+    {
+        m_editEnabled = enabled;
+    }
+
+    virtual int rowCount(const QModelIndex& parent = QModelIndex()) const override
+    {
+        if (parent.isValid() || (m_wrapper == nullptr)) {
+            return 0;
+        }
+
+        return static_cast<int>(m_wrapper->getMembers().size());
+    }
+
+    virtual QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override
+    {
+        auto* mem = memberAt(index);
+        if (mem == nullptr) {
+            return QVariant();
+        }
+
+        if (role == Qt::DisplayRole) {
+            return QString("%1: %2").arg(index.row()).arg(mem->getSerialisedString());
+        }
+
+        if (role == Qt::EditRole) {
+            return mem->getSerialisedString();
+        }
+
+        if ((role == Qt::ForegroundRole) && (!mem->valid())) {
+            return QBrush(Qt::red);
+        }
+
+        return QVariant();
+    }
+
+    virtual Qt::ItemFlags flags(const QModelIndex& index) const override
+    {
+        auto result = Base::flags(index);
+        if (m_editEnabled && index.isValid()) {
+            result |= Qt::ItemIsEditable;
+        }
+        return result;
+    }
+
+    virtual bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override
+    {
+        auto* mem = memberAt(index);
+        if ((mem == nullptr) || (role != Qt::EditRole) || (!m_editEnabled)) {
+            return false;
+        }
+
+        if (!mem->setSerialisedString(value.toString())) {
+            return false;
+        }
+
+        emit dataChanged(index, index);
+        if (m_elementUpdatedCallback) {
+            m_elementUpdatedCallback();
+        }
+        return true;
+    }
+
+private:
+    field_wrapper::FieldWrapper* memberAt(const QModelIndex& index) const
+    {
+        if ((!index.isValid()) || (m_wrapper == nullptr)) {
+            return nullptr;
+        }
+
+        auto& mems = m_wrapper->getMembers();
+        auto row = static_cast<std::size_t>(index.row());
+        if (mems.size() <= row) {
+            return nullptr;
+        }
+
+        return mems[row].get();
+    }
+
+    Wrapper* m_wrapper = nullptr;
+    ElementUpdatedFunc m_elementUpdatedCallback;
+    bool m_editEnabled = true;
+};
+
 ArrayListElementWidget::ArrayListElementWidget(
     FieldWidget* fieldWidget,
     QWidget* parentObj)
@@ -50,6 +165,11 @@ void ArrayListElementWidget::refresh()
     m_fieldWidget->refresh();
 }
 
+void ArrayListElementWidget::rebind(field_wrapper::FieldWrapper& wrapper)
+{
+    m_fieldWidget->rebind(wrapper);
+}
+
 void ArrayListElementWidget::setEditEnabled(bool enabled)
 {
     m_editEnabled = enabled;
@@ -63,10 +183,10 @@ void ArrayListElementWidget::setDeletable(bool deletable)
     updateUi();
 }
 
-void ArrayListElementWidget::updateProperties(const QVariantMap& props)
+void ArrayListElementWidget::updateProperties(const FieldDescriptor& desc)
 {
     assert(m_fieldWidget != nullptr);
-    m_fieldWidget->updateProperties(props);
+    m_fieldWidget->updateProperties(desc);
 }
 
 void ArrayListElementWidget::updateUi()
@@ -78,11 +198,12 @@ void ArrayListElementWidget::updateUi()
 
 ArrayListFieldWidget::ArrayListFieldWidget(
     WrapperPtr wrapper,
-    CreateMissingDataFieldsFunc&& updateFunc,
+    CreateMemberFieldWidgetFunc&& func,
     QWidget* parentObj)
   : Base(parentObj),
     m_wrapper(std::move(wrapper)),
-    m_createMissingDataFieldsCallback(std::move(updateFunc))
+    m_elementsModel(new ElementsModel()),
+    m_createMemberFieldWidgetCallback(std::move(func))
 {
     m_ui.setupUi(this);
     setNameLabelWidget(m_ui.m_nameLabel);
@@ -90,8 +211,18 @@ ArrayListFieldWidget::ArrayListFieldWidget(
     setSeparatorWidget(m_ui.m_sepLine);
     setSerialisedValueWidget(m_ui.m_serValueWidget);
 
+    m_elementsModel->setElementUpdatedCallback(
+        [this]()
+        {
+            // The refresh may reset the model, don't do it inside setData()
+            QMetaObject::invokeMethod(this, "dataFieldUpdated", Qt::QueuedConnection);
+        });
+    m_ui.m_membersListView->setModel(m_elementsModel.get());
+    m_ui.m_membersListView->setUniformItemSizes(true);
+    m_ui.m_membersListView->hide();
+
     refreshInternal();
-    addMissingFields();
+    updateElements();
 
     updateUi();
 
@@ -104,12 +235,6 @@ ArrayListFieldWidget::~ArrayListFieldWidget() noexcept = default;
 
 void ArrayListFieldWidget::refreshImpl()
 {
-    while (!m_elements.empty()) {
-        assert(m_elements.back() != nullptr);
-        delete m_elements.back();
-        m_elements.pop_back();
-    }
-
     if (m_wrapper->hasFixedSize()) {
         m_wrapper->adjustFixedSize();
     }
@@ -117,9 +242,14 @@ void ArrayListFieldWidget::refreshImpl()
     m_wrapper->refreshMembers();
 
     refreshInternal();
-    addMissingFields();
+    updateElements();
     updatePrefixField();
-    assert(m_elements.size() == m_wrapper->size());
+}
+
+void ArrayListFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    // The elements are re-bound on refresh
+    rebindWrapper(m_wrapper, wrapper);
 }
 
 void ArrayListFieldWidget::editEnabledUpdatedImpl()
@@ -127,20 +257,16 @@ void ArrayListFieldWidget::editEnabledUpdatedImpl()
     for (auto* elem : m_elements) {
         elem->setEditEnabled(isEditEnabled());
     }
+    m_elementsModel->setEditEnabled(isEditEnabled());
     updateUi();
 }
 
-void ArrayListFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void ArrayListFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
-    property::field::ArrayList arrayListProps(props);
-    m_ui.m_prefixNameLabel->setText(arrayListProps.prefixName());
-    m_prefixVisible = arrayListProps.isPrefixVisible();
+    m_ui.m_prefixNameLabel->setText(desc.prefixName());
+    m_prefixVisible = desc.isPrefixVisible();
     updatePrefixField();
-    auto& elementsProps = arrayListProps.elements();
-
-    m_elemProperties.clear();
-    m_elemProperties.reserve(elementsProps.size());
-    m_elemProperties.assign(elementsProps.begin(), elementsProps.end());
+    m_elemProperties = desc.members();
 
     if (m_elemProperties.empty()) {
         return;
@@ -148,7 +274,7 @@ void ArrayListFieldWidget::updatePropertiesImpl(const QVariantMap& props)
 
     unsigned idx = 0;
     for (auto* elem : m_elements) {
-        elem->updateProperties(m_elemProperties[idx]);
+        elem->updateProperties(*m_elemProperties[idx]);
         idx = ((idx + 1) % m_elemProperties.size());
     }
 }
@@ -183,9 +309,6 @@ void ArrayListFieldWidget::removeField()
 
     refreshImpl();
 
-    assert(m_elements.size() == m_wrapper->size());
-    assert(m_elements.size() == (unsigned)m_ui.m_membersLayout->count());
-
     emitFieldUpdated();
 }
 
@@ -199,7 +322,7 @@ void ArrayListFieldWidget::addDataField(FieldWidget* dataFieldWidget)
         auto elemPropsIdx = m_elements.size() % m_elemProperties.size();
         assert(elemPropsIdx < m_elemProperties.size());
         auto& elemProps = m_elemProperties[elemPropsIdx];
-        wrapperWidget->updateProperties(elemProps);
+        wrapperWidget->updateProperties(*elemProps);
     }
 
     connect(
@@ -234,23 +357,52 @@ void ArrayListFieldWidget::updateUi()
     updatePrefixField();
 }
 
-void ArrayListFieldWidget::addMissingFields()
+void ArrayListFieldWidget::updateElements()
 {
-    if (!m_createMissingDataFieldsCallback) {
+    auto& membersWrappers = m_wrapper->getMembers();
+    assert(membersWrappers.size() == m_wrapper->size());
+    if (MaxElementWidgets < membersWrappers.size()) {
+        removeElements(0U);
+        m_elementsModel->setWrapper(m_wrapper.get());
+        m_ui.m_membersListView->show();
+        return;
+    }
+
+    m_elementsModel->setWrapper(nullptr);
+    m_ui.m_membersListView->hide();
+
+    // Reuse existing elements' widgets, create only the missing ones
+    removeElements(membersWrappers.size());
+    for (auto idx = 0U; idx < m_elements.size(); ++idx) {
+        auto* elem = m_elements[idx];
+        assert(elem != nullptr);
+        elem->rebind(*membersWrappers[idx]);
+        elem->refresh();
+    }
+
+    if (!m_createMemberFieldWidgetCallback) {
         assert(!"Callback should exist");
         return;
     }
 
-    assert(m_elements.empty());
-    auto fieldWidgets = m_createMissingDataFieldsCallback(*m_wrapper);
-    for (auto& fieldWidgetPtr : fieldWidgets) {
-        addDataField(fieldWidgetPtr.release());
+    while (m_elements.size() < membersWrappers.size()) {
+        auto fieldWidget = m_createMemberFieldWidgetCallback(*membersWrappers[m_elements.size()]);
+        addDataField(fieldWidget.release());
     }
 
     assert(m_elements.size() == m_wrapper->size());
     assert(m_elements.size() == (unsigned)m_ui.m_membersLayout->count());
 }
 
+void ArrayListFieldWidget::removeElements(std::size_t count)
+{
+    while (count < m_elements.size()) {
+        assert(m_elements.back() != nullptr);
+        delete m_elements.back();
+        m_elements.pop_back();
+    }
+}
+
 void ArrayListFieldWidget::updatePrefixField()
 {
     if (!m_prefixVisible) {
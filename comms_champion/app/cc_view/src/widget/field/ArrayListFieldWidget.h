@@ -20,12 +20,11 @@
 
 #include <functional>
 #include <vector>
+#include <memory>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
-#include <QtCore/QVariantMap>
-
 #include "ui_ArrayListElementWidget.h"
 #include "ui_ArrayListFieldWidget.h"
 CC_ENABLE_WARNINGS()
@@ -47,9 +46,10 @@ public:
         QWidget* parentObj = nullptr);
 
     void refresh();
+    void rebind(field_wrapper::FieldWrapper& wrapper);
     void setEditEnabled(bool enabled);
     void setDeletable(bool deletable);
-    void updateProperties(const QVariantMap& props);
+    void updateProperties(const FieldDescriptor& desc);
 
 signals:
     void sigFieldUpdated();
@@ -71,26 +71,21 @@ class ArrayListFieldWidget : public FieldWidget
 public:
     using Wrapper = field_wrapper::ArrayListWrapper;
     using WrapperPtr = Wrapper::Ptr;
-    typedef std::function<std::vector<FieldWidgetPtr> (Wrapper&)> CreateMissingDataFieldsFunc;
+    using CreateMemberFieldWidgetFunc =
+        std::function<FieldWidgetPtr (field_wrapper::FieldWrapper&)>;
 
     explicit ArrayListFieldWidget(
         WrapperPtr wrapper,
-        CreateMissingDataFieldsFunc&& updateFunc,
+        CreateMemberFieldWidgetFunc&& func,
         QWidget* parentObj = nullptr);
 
     ~ArrayListFieldWidget() noexcept;
 
-    template <typename TFunc>
-    void setCreateMissingDataFieldsCallback(TFunc&& func)
-    {
-        m_createMissingDataFieldsCallback = std::forward<TFunc>(func);
-        addMissingFields();
-    }
-
 protected:
     virtual void refreshImpl() override;
+    virtual void rebindImpl(field_wrapper::FieldWrapper& wrapper) override;
     virtual void editEnabledUpdatedImpl() override;
-    virtual void updatePropertiesImpl(const QVariantMap& props) override;
+    virtual void updatePropertiesImpl(const FieldDescriptor& desc) override;
 
 private slots:
     void dataFieldUpdated();
@@ -98,18 +93,25 @@ private slots:
     void removeField();
 
 private:
+    class ElementsModel;
+
+    /// @brief Lists with more elements are displayed by the list view
+    ///     instead of having a widget per element.
+    static const unsigned MaxElementWidgets = 128U;
 
     void addDataField(FieldWidget* dataFieldWidget);
     void refreshInternal();
     void updateUi();
-    void addMissingFields();
+    void updateElements();
+    void removeElements(std::size_t count);
     void updatePrefixField();
 
     Ui::ArrayListFieldWidget m_ui;
     WrapperPtr m_wrapper;
     std::vector<ArrayListElementWidget*> m_elements;
-    CreateMissingDataFieldsFunc m_createMissingDataFieldsCallback;
-    std::vector<QVariantMap> m_elemProperties;
+    std::unique_ptr<ElementsModel> m_elementsModel;
+    CreateMemberFieldWidgetFunc m_createMemberFieldWidgetCallback;
+    FieldDescriptor::List m_elemProperties;
     bool m_prefixVisible = false;
 };
 
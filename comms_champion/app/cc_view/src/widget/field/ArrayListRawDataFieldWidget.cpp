@@ -85,6 +85,11 @@ void ArrayListRawDataFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void ArrayListRawDataFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void ArrayListRawDataFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -81,6 +81,17 @@ void BitfieldFieldWidget::refreshImpl()
     refreshMembers();
 }
 
+void BitfieldFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+    auto& membersWrappers = m_wrapper->getMembers();
+    assert(membersWrappers.size() == m_members.size());
+    auto count = std::min(membersWrappers.size(), m_members.size());
+    for (auto idx = 0U; idx < count; ++idx) {
+        m_members[idx]->rebind(*membersWrappers[idx]);
+    }
+}
+
 void BitfieldFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -90,15 +101,13 @@ void BitfieldFieldWidget::editEnabledUpdatedImpl()
     }
 }
 
-void BitfieldFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void BitfieldFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
-    property::field::Bitfield bitfieldProps(props);
-    auto& membersProps = bitfieldProps.members();
-    auto count = std::min((std::size_t)membersProps.size(), m_members.size());
+    auto count = std::min(desc.members().size(), m_members.size());
     for (auto idx = 0U; idx < count; ++idx) {
         auto* memberFieldWidget = m_members[idx];
         assert(memberFieldWidget != nullptr);
-        memberFieldWidget->updateProperties(membersProps[idx]);
+        memberFieldWidget->updateProperties(desc.member(idx));
     }
 }
 
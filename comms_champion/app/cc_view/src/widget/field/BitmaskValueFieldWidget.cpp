@@ -84,21 +84,24 @@ void BitmaskValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void BitmaskValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void BitmaskValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
     m_ui.m_serValueLineEdit->setReadOnly(readonly);
 }
 
-void BitmaskValueFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void BitmaskValueFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
     for (auto* checkbox : m_checkboxes) {
         delete checkbox;
     }
 
-    property::field::BitmaskValue bitmaskProps(props);
-
-    auto& bitNamesList = bitmaskProps.bits();
+    auto& bitNamesList = desc.bits();
 
     m_checkboxes.clear();
 
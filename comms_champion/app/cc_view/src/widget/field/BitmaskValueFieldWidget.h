@@ -44,8 +44,9 @@ public:
 
 protected:
     virtual void refreshImpl() override;
+    virtual void rebindImpl(field_wrapper::FieldWrapper& wrapper) override;
     virtual void editEnabledUpdatedImpl() override;
-    virtual void updatePropertiesImpl(const QVariantMap& props) override;
+    virtual void updatePropertiesImpl(const FieldDescriptor& desc) override;
 
 private slots:
     void serialisedValueUpdated(const QString& value);
@@ -29,6 +29,7 @@ CC_DISABLE_WARNINGS()
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/property/field.h"
+#include "comms_champion/field_wrapper/BundleWrapper.h"
 
 namespace comms_champion
 {
@@ -72,6 +73,17 @@ void BundleFieldWidget::refreshImpl()
     }
 }
 
+void BundleFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    assert(dynamic_cast<field_wrapper::BundleWrapper*>(&wrapper) != nullptr);
+    auto& membersWrappers = static_cast<field_wrapper::BundleWrapper&>(wrapper).getMembers();
+    assert(membersWrappers.size() == m_members.size());
+    auto count = std::min(membersWrappers.size(), m_members.size());
+    for (auto idx = 0U; idx < count; ++idx) {
+        m_members[idx]->rebind(*membersWrappers[idx]);
+    }
+}
+
 void BundleFieldWidget::editEnabledUpdatedImpl()
 {
     bool enabled = isEditEnabled();
@@ -80,19 +92,17 @@ void BundleFieldWidget::editEnabledUpdatedImpl()
     }
 }
 
-void BundleFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void BundleFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
-    property::field::Bundle bundleProps(props);
-    auto& membersProps = bundleProps.members();
-    auto count = std::min((std::size_t)membersProps.size(), m_members.size());
+    auto count = std::min(desc.members().size(), m_members.size());
     for (auto idx = 0U; idx < count; ++idx) {
         auto* memberFieldWidget = m_members[idx];
         assert(memberFieldWidget != nullptr);
-        memberFieldWidget->updateProperties(membersProps[idx]);
+        memberFieldWidget->updateProperties(desc.member(idx));
     }
 
     assert(m_label != nullptr);
-    auto name = bundleProps.name();
+    auto& name = desc.name();
     if (name.isEmpty()) {
         m_label->hide();
         return;
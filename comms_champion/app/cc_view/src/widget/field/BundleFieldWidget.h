@@ -47,8 +47,9 @@ public:
 
 protected:
     virtual void refreshImpl() override;
+    virtual void rebindImpl(field_wrapper::FieldWrapper& wrapper) override;
     virtual void editEnabledUpdatedImpl() override;
-    virtual void updatePropertiesImpl(const QVariantMap& props) override;
+    virtual void updatePropertiesImpl(const FieldDescriptor& desc) override;
 
 private slots:
     void memberFieldUpdated();
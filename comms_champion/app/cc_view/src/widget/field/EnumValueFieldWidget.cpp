@@ -105,13 +105,18 @@ void EnumValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void EnumValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void EnumValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
     m_ui.m_serValueLineEdit->setReadOnly(readonly);
 }
 
-void EnumValueFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void EnumValueFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
     if (m_signalsConnected) {
         disconnect(m_ui.m_valueComboBox, SIGNAL(currentIndexChanged(int)),
@@ -123,8 +128,7 @@ void EnumValueFieldWidget::updatePropertiesImpl(const QVariantMap& props)
 
     m_ui.m_valueComboBox->clear();
 
-    property::field::EnumValue enumProps(props);
-    auto& values = enumProps.values();
+    auto& values = desc.enumValues();
     auto maxValue = std::numeric_limits<long long int>::min();
     for (auto& val : values) {
         m_ui.m_valueComboBox->addItem(val.first, val.second);
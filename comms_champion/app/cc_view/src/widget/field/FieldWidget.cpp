@@ -59,6 +59,11 @@ FieldWidget::FieldWidget(QWidget* parentObj)
 {
 }
 
+void FieldWidget::rebind(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindImpl(wrapper);
+}
+
 void FieldWidget::refresh()
 {
     refreshImpl();
@@ -70,13 +75,12 @@ void FieldWidget::setEditEnabled(bool enabled)
     editEnabledUpdatedImpl();
 }
 
-void FieldWidget::updateProperties(const QVariantMap& props)
+void FieldWidget::updateProperties(const FieldDescriptor& desc)
 {
-    property::field::Common commonProps(props);
-    performNameLabelUpdate(commonProps);
-    updatePropertiesImpl(props);
-    performUiElementsVisibilityCheck(commonProps);
-    performUiReadOnlyCheck(commonProps);
+    performNameLabelUpdate(desc);
+    updatePropertiesImpl(desc);
+    performUiElementsVisibilityCheck(desc);
+    performUiReadOnlyCheck(desc);
 }
 
 void FieldWidget::emitFieldUpdated()
@@ -161,14 +165,14 @@ void FieldWidget::editEnabledUpdatedImpl()
 {
 }
 
-void FieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void FieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
-    static_cast<void>(props);
+    static_cast<void>(desc);
 }
 
-void FieldWidget::performUiElementsVisibilityCheck(const property::field::Common& props)
+void FieldWidget::performUiElementsVisibilityCheck(const FieldDescriptor& desc)
 {
-    auto allHidden = props.isHidden();
+    auto allHidden = desc.isHidden();
     setHidden(allHidden);
     if (allHidden) {
         return;
@@ -188,27 +192,27 @@ void FieldWidget::performUiElementsVisibilityCheck(const property::field::Common
             }
         };
 
-    auto serHidden = props.isSerialisedHidden();
+    auto serHidden = desc.isSerialisedHidden();
     setWidgetHiddenFunc(m_sepWidget, serHidden);
     setWidgetHiddenFunc(m_serValueWidget, serHidden);
 }
 
-void FieldWidget::performUiReadOnlyCheck(const property::field::Common& props)
+void FieldWidget::performUiReadOnlyCheck(const FieldDescriptor& desc)
 {
-    auto readOnly = props.isReadOnly();
+    auto readOnly = desc.isReadOnly();
     if (m_forcedReadOnly != readOnly) {
         m_forcedReadOnly = readOnly;
         editEnabledUpdatedImpl();
     }
 }
 
-void FieldWidget::performNameLabelUpdate(const property::field::Common& props)
+void FieldWidget::performNameLabelUpdate(const FieldDescriptor& desc)
 {
     if (m_nameLabel == nullptr) {
         return;
     }
 
-    auto str = props.name();
+    auto str = desc.name();
     if (str.isEmpty()) {
         m_nameLabel->hide();
         return;
@@ -24,11 +24,10 @@
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
-#include <QtCore/QVariantMap>
 #include <QtWidgets/QWidget>
 CC_ENABLE_WARNINGS()
 
-#include "comms_champion/property/field.h"
+#include "comms_champion/FieldDescriptor.h"
 #include "comms_champion/field_wrapper/FieldWrapper.h"
 
 class QLineEdit;
@@ -47,10 +46,17 @@ public:
     FieldWidget(QWidget* parentObj = nullptr);
     ~FieldWidget() noexcept = default;
 
+    /// @brief Bind the widget (and all its members) to another field
+    ///     wrapper of the same type.
+    /// @details Used to reuse the widget when a message of the same type
+    ///     is displayed. The displayed values are not updated, the
+    ///     refresh() is expected to be invoked afterwards.
+    void rebind(field_wrapper::FieldWrapper& wrapper);
+
 public slots:
     void refresh();
     void setEditEnabled(bool enabled);
-    void updateProperties(const QVariantMap& props);
+    void updateProperties(const FieldDescriptor& desc);
 
 signals:
     void sigFieldUpdated();
@@ -107,14 +113,23 @@ protected:
         m_serValueWidget = widget;
     }
 
+    template <typename TWrapperPtr>
+    static void rebindWrapper(TWrapperPtr& wrapperPtr, field_wrapper::FieldWrapper& wrapper)
+    {
+        using WrapperType = typename TWrapperPtr::element_type;
+        assert(dynamic_cast<WrapperType*>(&wrapper) != nullptr);
+        wrapperPtr = static_cast<WrapperType&>(wrapper).clone();
+    }
+
     virtual void refreshImpl() = 0;
+    virtual void rebindImpl(field_wrapper::FieldWrapper& wrapper) = 0;
     virtual void editEnabledUpdatedImpl();
-    virtual void updatePropertiesImpl(const QVariantMap& props);
+    virtual void updatePropertiesImpl(const FieldDescriptor& desc);
 
 private:
-    void performUiElementsVisibilityCheck(const property::field::Common& props);
-    void performUiReadOnlyCheck(const property::field::Common& props);
-    void performNameLabelUpdate(const property::field::Common& props);
+    void performUiElementsVisibilityCheck(const FieldDescriptor& desc);
+    void performUiReadOnlyCheck(const FieldDescriptor& desc);
+    void performNameLabelUpdate(const FieldDescriptor& desc);
 
     bool m_forcedReadOnly = false;
     bool m_editEnabled = true;
@@ -99,6 +99,11 @@ void FloatValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void FloatValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void FloatValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -106,9 +111,9 @@ void FloatValueFieldWidget::editEnabledUpdatedImpl()
     m_ui.m_serValueLineEdit->setReadOnly(readonly);
 }
 
-void FloatValueFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void FloatValueFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
-    auto decimals = property::field::FloatValue(props).decimals();
+    auto decimals = desc.decimals();
     if (decimals == 0) {
         decimals = DefaultDecimals;
     }
@@ -54,6 +54,16 @@ void IntValueFieldWidget::refreshImpl()
     }
 }
 
+void IntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    if (m_childWidget) {
+        m_childWidget->rebind(wrapper);
+        return;
+    }
+
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void IntValueFieldWidget::editEnabledUpdatedImpl()
 {
     if (m_childWidget) {
@@ -61,12 +71,12 @@ void IntValueFieldWidget::editEnabledUpdatedImpl()
     }
 }
 
-void IntValueFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void IntValueFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
     assert(m_wrapper);
     assert(!m_childWidget);
     do {
-        if (property::field::IntValue(props).hasScaledDecimals()) {
+        if (desc.hasScaledDecimals()) {
             m_childWidget.reset(new ScaledIntValueFieldWidget(std::move(m_wrapper)));
             break;
         }
@@ -100,7 +110,7 @@ void IntValueFieldWidget::updatePropertiesImpl(const QVariantMap& props)
     childLayout->setContentsMargins(0, 0, 0, 0);
     childLayout->setSpacing(0);
     setLayout(childLayout);
-    m_childWidget->updateProperties(props);
+    m_childWidget->updateProperties(desc);
     m_childWidget->setEditEnabled(isEditEnabled());
 
     connect(
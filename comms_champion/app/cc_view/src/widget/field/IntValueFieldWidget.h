@@ -40,8 +40,9 @@ public:
 
 protected:
     virtual void refreshImpl() override;
+    virtual void rebindImpl(field_wrapper::FieldWrapper& wrapper) override;
     virtual void editEnabledUpdatedImpl() override;
-    virtual void updatePropertiesImpl(const QVariantMap& props) override;
+    virtual void updatePropertiesImpl(const FieldDescriptor& desc) override;
 
 private:
     using WrapperType = WrapperPtr::element_type;
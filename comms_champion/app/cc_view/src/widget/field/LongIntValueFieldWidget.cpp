@@ -76,6 +76,11 @@ void LongIntValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void LongIntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void LongIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -83,11 +88,10 @@ void LongIntValueFieldWidget::editEnabledUpdatedImpl()
     m_ui.m_serValueLineEdit->setReadOnly(readonly);
 }
 
-void LongIntValueFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void LongIntValueFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
     auto offset =
-        static_cast<decltype(m_offset)>(
-            property::field::IntValue(props).displayOffset());
+        static_cast<decltype(m_offset)>(desc.displayOffset());
     if (std::numeric_limits<double>::epsilon() < std::abs(m_offset - offset)) {
         m_offset = offset;
         refresh();
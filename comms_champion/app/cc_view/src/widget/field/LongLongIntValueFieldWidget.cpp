@@ -72,6 +72,11 @@ void LongLongIntValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void LongLongIntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void LongLongIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -79,9 +84,9 @@ void LongLongIntValueFieldWidget::editEnabledUpdatedImpl()
     m_ui.m_serValueLineEdit->setReadOnly(readonly);
 }
 
-void LongLongIntValueFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void LongLongIntValueFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
-    m_offset = property::field::IntValue(props).displayOffset();
+    m_offset = desc.displayOffset();
     refresh();
 }
 
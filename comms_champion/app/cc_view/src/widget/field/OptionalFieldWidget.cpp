@@ -72,21 +72,30 @@ void OptionalFieldWidget::refreshImpl()
     refreshField();
 }
 
+void OptionalFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+    if (m_wrapper->getMode() == Mode::Tentative) {
+        m_wrapper->setMode(Mode::Missing);
+    }
+
+    assert(m_field != nullptr);
+    m_field->rebind(m_wrapper->getFieldWrapper());
+}
+
 void OptionalFieldWidget::editEnabledUpdatedImpl()
 {
     assert(m_field != nullptr);
     m_field->setEditEnabled(isEditEnabled());
 }
 
-void OptionalFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void OptionalFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
-    property::field::Optional optProps(props);
-    auto& fieldPropsMap = optProps.field();
     assert(m_field);
-    m_field->updateProperties(fieldPropsMap);
+    m_field->updateProperties(desc.member(0));
     refreshInternal();
 
-    bool uncheckable = optProps.isUncheckable();
+    bool uncheckable = desc.isUncheckable();
     m_ui.m_optCheckBox->setHidden(uncheckable);
     m_ui.m_optSep->setHidden(uncheckable);
 }
@@ -83,6 +83,11 @@ void ScaledIntValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void ScaledIntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void ScaledIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -90,9 +95,9 @@ void ScaledIntValueFieldWidget::editEnabledUpdatedImpl()
     m_ui.m_serValueLineEdit->setReadOnly(readonly);
 }
 
-void ScaledIntValueFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void ScaledIntValueFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
-    auto decimals = property::field::IntValue(props).scaledDecimals();
+    auto decimals = desc.decimals();
     if (decimals <= 0) {
         assert(!"Should not happen");
         m_ui.m_valueSpinBox->setDecimals(0);
@@ -72,6 +72,11 @@ void ShortIntValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void ShortIntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void ShortIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -79,11 +84,10 @@ void ShortIntValueFieldWidget::editEnabledUpdatedImpl()
     m_ui.m_serValueLineEdit->setReadOnly(readonly);
 }
 
-void ShortIntValueFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void ShortIntValueFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
     auto offset =
-        static_cast<decltype(m_offset)>(
-            property::field::IntValue(props).displayOffset());
+        static_cast<decltype(m_offset)>(desc.displayOffset());
     if (m_offset != offset) {
         m_offset = offset;
         refresh();
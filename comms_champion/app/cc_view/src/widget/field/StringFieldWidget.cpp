@@ -68,6 +68,11 @@ void StringFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void StringFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void StringFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -54,6 +54,11 @@ void UnknownValueFieldWidget::refreshImpl()
     setFieldValid(m_wrapper->valid());
 }
 
+void UnknownValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void UnknownValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
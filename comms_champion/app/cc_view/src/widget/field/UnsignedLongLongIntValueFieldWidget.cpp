@@ -73,6 +73,11 @@ void UnsignedLongLongIntValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+void UnsignedLongLongIntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    rebindWrapper(m_wrapper, wrapper);
+}
+
 void UnsignedLongLongIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -80,11 +85,10 @@ void UnsignedLongLongIntValueFieldWidget::editEnabledUpdatedImpl()
     m_ui.m_serValueLineEdit->setReadOnly(readonly);
 }
 
-void UnsignedLongLongIntValueFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void UnsignedLongLongIntValueFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
-    property::field::IntValue parsedProps(props);
-    m_offset = parsedProps.displayOffset();
-    m_decimals = parsedProps.scaledDecimals();
+    m_offset = desc.displayOffset();
+    m_decimals = desc.decimals();
     refresh();
 }
 
@@ -72,6 +72,45 @@ void VariantFieldWidget::refreshImpl()
     refreshMember();
 }
 
+void VariantFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    // The previous field may not exist any more, use index displayed by the spin box
+    int prevIdx = -1;
+    if (m_member != nullptr) {
+        prevIdx = m_ui.m_idxSpinBox->value();
+    }
+
+    rebindWrapper(m_wrapper, wrapper);
+
+    m_ui.m_idxSpinBox->blockSignals(true);
+    m_ui.m_idxSpinBox->setValue(m_wrapper->getCurrentIndex());
+    m_ui.m_idxSpinBox->blockSignals(false);
+
+    auto& current = m_wrapper->getCurrent();
+    if ((m_member != nullptr) && (current) && (prevIdx == m_wrapper->getCurrentIndex())) {
+        m_member->rebind(*current);
+        return;
+    }
+
+    delete m_member;
+    m_member = nullptr;
+
+    if (!current) {
+        return;
+    }
+
+    assert(m_createFunc);
+    auto fieldWidget = m_createFunc(*current);
+    m_member = fieldWidget.release();
+    m_ui.m_membersLayout->addWidget(m_member);
+    m_member->setEditEnabled(isEditEnabled());
+    updateMemberProps();
+
+    connect(
+        m_member, SIGNAL(sigFieldUpdated()),
+        this, SLOT(memberFieldUpdated()));
+}
+
 void VariantFieldWidget::editEnabledUpdatedImpl()
 {
     bool readOnly = !isEditEnabled();
@@ -83,13 +122,12 @@ void VariantFieldWidget::editEnabledUpdatedImpl()
     updateIndexInfo();
 }
 
-void VariantFieldWidget::updatePropertiesImpl(const QVariantMap& props)
+void VariantFieldWidget::updatePropertiesImpl(const FieldDescriptor& desc)
 {
-    property::field::Variant variantProps(props);
-    m_membersProps = variantProps.members();
+    m_membersProps = desc.members();
     updateMemberProps();
 
-    m_indexHidden = variantProps.isIndexHidden();
+    m_indexHidden = desc.isIndexHidden();
     updateIndexInfo();
 }
 
@@ -155,11 +193,12 @@ void VariantFieldWidget::updateMemberProps()
 
     assert(0 <= m_ui.m_idxSpinBox->value());
     assert(0 <= m_wrapper->getCurrentIndex());
-    if (m_membersProps.size() <= m_wrapper->getCurrentIndex()) {
+    auto idx = static_cast<std::size_t>(m_wrapper->getCurrentIndex());
+    if (m_membersProps.size() <= idx) {
         return;
     }
 
-    m_member->updateProperties(m_membersProps[m_wrapper->getCurrentIndex()]);
+    m_member->updateProperties(*m_membersProps[idx]);
 }
 
 void VariantFieldWidget::updateIndexInfo()
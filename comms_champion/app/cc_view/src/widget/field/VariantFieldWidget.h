@@ -48,8 +48,9 @@ public:
 
 protected:
     virtual void refreshImpl() override;
+    virtual void rebindImpl(field_wrapper::FieldWrapper& wrapper) override;
     virtual void editEnabledUpdatedImpl() override;
-    virtual void updatePropertiesImpl(const QVariantMap& props) override;
+    virtual void updatePropertiesImpl(const FieldDescriptor& desc) override;
 
 private slots:
     void memberFieldUpdated();
@@ -66,7 +67,7 @@ private:
     Ui::VariantFieldWidget m_ui;
     WrapperPtr m_wrapper;
     FieldWidget* m_member = nullptr;
-    QList<QVariantMap> m_membersProps;
+    FieldDescriptor::List m_membersProps;
     CreateMemberFieldWidgetFunc m_createFunc;
     bool m_indexHidden = false;
 };
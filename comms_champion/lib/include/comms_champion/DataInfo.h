@@ -51,10 +51,19 @@ struct DataInfo
     /// @brief Type of extra properties storage
     using PropertiesMap = QVariantMap;
 
+    /// @brief Type of connection identifier
+    using ConnectionId = unsigned;
+
+    /// @brief Connection identifier used by sockets with single data stream
+    static const ConnectionId DefaultConnectionId = 0U;
+
     Timestamp m_timestamp; ///< Timestam when data has been received / sent
     DataSeq m_data; ///< Actual raw data
     PropertiesMap m_extraProperties; ///< Extra properties that can be used by
                                      /// other componets
+    ConnectionId m_connectionId = DefaultConnectionId; ///< Identifies independent
+                                     /// data stream (peer connection) the data
+                                     /// belongs to
 };
 
 /// @brief Pointer to @ref DataInfo
@@ -0,0 +1,197 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+#include <QtCore/QVariantMap>
+#include <QtCore/QVariantList>
+CC_ENABLE_WARNINGS()
+
+#include "Api.h"
+#include "property/field.h"
+
+namespace comms_champion
+{
+
+/// @brief Immutable description of the field.
+/// @details Contains the same information as the properties map
+///     (see @ref property::field), but already parsed into typed members.
+///     The descriptors are built once per message type by every
+///     @ref Protocol (see @ref Message::typeInfo()) and shared by all
+///     the message objects it creates, so the display code doesn't need to perform string keyed
+///     lookups in the QVariantMap every time the field is shown.
+/// @headerfile comms_champion/FieldDescriptor.h
+class CC_API FieldDescriptor
+{
+public:
+    /// @brief Pointer to the descriptor.
+    typedef std::shared_ptr<const FieldDescriptor> Ptr;
+
+    /// @brief List of descriptors.
+    typedef std::vector<Ptr> List;
+
+    /// @brief List of enum values.
+    typedef property::field::EnumValue::ElemsList EnumValuesList;
+
+    /// @brief List of bits descriptions.
+    typedef property::field::BitmaskValue::BitsList BitsList;
+
+    /// @brief Construct from properties map.
+    explicit FieldDescriptor(const QVariantMap& props);
+
+    /// @brief Destructor
+    ~FieldDescriptor() noexcept;
+
+    FieldDescriptor(const FieldDescriptor&) = delete;
+    FieldDescriptor& operator=(const FieldDescriptor&) = delete;
+
+    /// @brief Create descriptor from properties map.
+    static Ptr create(const QVariantMap& props);
+
+    /// @brief Create descriptor from QVariant containing properties map.
+    static Ptr create(const QVariant& props);
+
+    /// @brief Create descriptors of all the fields from list of their properties.
+    static List createList(const QVariantList& props);
+
+    /// @brief Descriptor of the field without any properties.
+    static const FieldDescriptor& empty();
+
+    /// @brief Original properties map.
+    const QVariantMap& props() const
+    {
+        return m_props;
+    }
+
+    /// @brief Name of the field.
+    const QString& name() const
+    {
+        return m_name;
+    }
+
+    /// @brief Check the field is hidden.
+    bool isHidden() const
+    {
+        return m_hidden;
+    }
+
+    /// @brief Check the serialisation part is hidden.
+    bool isSerialisedHidden() const
+    {
+        return m_serHidden;
+    }
+
+    /// @brief Check the field is read only.
+    bool isReadOnly() const
+    {
+        return m_readOnly;
+    }
+
+    /// @brief Numeric offset of the displayed value (integral fields).
+    long long displayOffset() const
+    {
+        return m_displayOffset;
+    }
+
+    /// @brief Number of digits after decimal point (scaled integral and
+    ///     floating point fields).
+    int decimals() const
+    {
+        return m_decimals;
+    }
+
+    /// @brief Check whether the integral value is displayed scaled.
+    bool hasScaledDecimals() const
+    {
+        return 0 < m_decimals;
+    }
+
+    /// @brief Names of the enum values.
+    const EnumValuesList& enumValues() const
+    {
+        return m_enumValues;
+    }
+
+    /// @brief Names of the bits in the bitmask.
+    const BitsList& bits() const
+    {
+        return m_bits;
+    }
+
+    /// @brief Check whether the size/length prefix of the list is displayed.
+    bool isPrefixVisible() const
+    {
+        return m_prefixVisible;
+    }
+
+    /// @brief Name of the size/length prefix of the list.
+    const QString& prefixName() const
+    {
+        return m_prefixName;
+    }
+
+    /// @brief Check whether the optional field cannot be checked/unchecked.
+    bool isUncheckable() const
+    {
+        return m_uncheckable;
+    }
+
+    /// @brief Check whether the index of the variant field is hidden.
+    bool isIndexHidden() const
+    {
+        return m_indexHidden;
+    }
+
+    /// @brief Descriptors of the contained fields.
+    /// @details Members of bundle, bitfield and variant, elements of the list,
+    ///     or single field wrapped by the optional.
+    const List& members() const
+    {
+        return m_members;
+    }
+
+    /// @brief Descriptor of the contained field.
+    /// @return @ref empty() descriptor if index is out of range.
+    const FieldDescriptor& member(std::size_t idx) const;
+
+private:
+    QVariantMap m_props;
+    QString m_name;
+    QString m_prefixName;
+    EnumValuesList m_enumValues;
+    BitsList m_bits;
+    List m_members;
+    long long m_displayOffset = 0;
+    int m_decimals = 0;
+    bool m_hidden = false;
+    bool m_serHidden = false;
+    bool m_readOnly = false;
+    bool m_prefixVisible = false;
+    bool m_uncheckable = false;
+    bool m_indexHidden = false;
+};
+
+}  // namespace comms_champion
+
@@ -21,16 +21,19 @@
 #include <vector>
 #include <cstdint>
 #include <memory>
+#include <string>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
 #include <QtCore/QObject>
+#include <QtCore/QString>
 #include <QtCore/QVariantList>
 #include <QtCore/QVariantMap>
 CC_ENABLE_WARNINGS()
 
 #include "Api.h"
+#include "FieldDescriptor.h"
 
 namespace comms_champion
 {
@@ -56,6 +59,30 @@ public:
         NumOfValues ///< Number of available values
     };
 
+    /// @brief Information shared by all the messages of the same type.
+    struct TypeInfo
+    {
+        /// @brief Typed descriptors of the message fields.
+        FieldDescriptor::List m_fieldsDescriptors;
+
+        /// @brief Message name, valid only when @ref m_static is true.
+        QString m_name;
+
+        /// @brief String representation of message ID, valid only
+        ///     when @ref m_static is true.
+        QString m_idAsString;
+
+        /// @brief Same as @ref m_idAsString, valid only when @ref m_static
+        ///     is true.
+        std::string m_idAsStdString;
+
+        /// @brief Name and ID are the same for all the messages of the type.
+        bool m_static = false;
+    };
+
+    /// @brief Pointer to @ref TypeInfo shared between the message objects.
+    using TypeInfoPtr = std::shared_ptr<const TypeInfo>;
+
     /// @brief Constructor
     Message() = default;
 
@@ -79,10 +106,39 @@ public:
     /// @details Invokes virtual nameImpl().
     const char* name() const;
 
+    /// @brief Get message name as string.
+    /// @details Doesn't allocate when the name is cached in the assigned
+    ///     type information (see setTypeInfo()).
+    QString nameAsString() const;
+
     /// @brief Get properties describing message fields
     /// @details Invokes fieldsPropertiesImpl()
     const QVariantList& fieldsProperties() const;
 
+    /// @brief Get typed descriptors of the message fields
+    /// @details The descriptors are part of typeInfo().
+    const FieldDescriptor::List& fieldsDescriptors() const;
+
+    /// @brief Get information shared by all the messages of the same type.
+    /// @details The information is normally assigned by the @ref Protocol
+    ///     that created the message using setTypeInfo(). If it wasn't
+    ///     assigned, it is created by createTypeInfo() for this object
+    ///     only on the first call.
+    const TypeInfo& typeInfo() const;
+
+    /// @brief Create new information about the type of this message.
+    /// @details The name and ID are cached only if hasStaticTypeInfoImpl()
+    ///     returns true.
+    TypeInfoPtr createTypeInfo() const;
+
+    /// @brief Assign information shared by all the messages of the same type.
+    /// @details Expected to be created by createTypeInfo() of a message
+    ///     of the same type.
+    void setTypeInfo(TypeInfoPtr info);
+
+    /// @brief Check whether information about the type has been assigned.
+    bool hasTypeInfo() const;
+
     /// @brief Dispatch message to message handler used by <b>CommsChampion Tools</b>
     /// @details Invokes dispatchImpl()
     void dispatch(MessageHandler& handler);
@@ -94,7 +150,9 @@ public:
     bool refreshMsg();
 
     /// @brief Get string representation of message ID.
-    /// @details Invokes idAsStringImpl().
+    /// @details Returns the ID cached in the assigned type information
+    ///     (see setTypeInfo()) when available, invokes idAsStringImpl()
+    ///     otherwise.
     QString idAsString() const;
 
     /// @brief Reset message contents to default constructed values
@@ -160,6 +218,15 @@ protected:
     /// @brief Polymorphic deserialisation functionality.
     /// @details Invoked by decodeData().
     virtual bool decodeDataImpl(const DataSeq& data) = 0;
+
+    /// @brief Polymorphic check whether the name and ID are the same for
+    ///     all the objects of the message type.
+    /// @details Invoked by createTypeInfo().
+    ///     Default implementation returns false.
+    virtual bool hasStaticTypeInfoImpl() const;
+
+private:
+    mutable TypeInfoPtr m_typeInfo;
 };
 
 /// @brief Smart pointer to @ref Message
@@ -0,0 +1,111 @@
+//
+// Copyright 2014 - 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <memory>
+#include <functional>
+#include <limits>
+#include <cstddef>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+CC_ENABLE_WARNINGS()
+
+#include "Api.h"
+#include "Message.h"
+#include "Protocol.h"
+
+namespace comms_champion
+{
+
+class MsgFileLoaderImpl;
+
+/// @brief Background loader of the saved received messages file.
+/// @details The reader thread splits the file into separate entries without
+///     parsing the whole document, and groups them into batches. The batches
+///     are decoded by the pool of worker threads, every one of which uses
+///     its own protocol object. The decoded messages are retrieved in
+///     their original order by @ref takeLoaded() while the rest of the
+///     file is still being processed.
+/// @headerfile comms_champion/MsgFileLoader.h
+class CC_API MsgFileLoader
+{
+public:
+    /// @brief List of loaded messages.
+    typedef Protocol::MessagesList MessagesList;
+
+    /// @brief Function used to create protocol object for every worker thread.
+    typedef std::function<ProtocolPtr ()> ProtocolCreateFunc;
+
+    /// @brief Constructor
+    MsgFileLoader();
+
+    /// @brief Destructor
+    /// @details Cancels the loading and waits for all the threads to exit.
+    ~MsgFileLoader() noexcept;
+
+    /// @brief Start loading the file.
+    /// @param[in] filename Name of the file.
+    /// @param[in] func Protocol creation function, invoked in the calling
+    ///     thread once per worker thread.
+    /// @param[in] threadsCount Number of worker threads, @b 0 means
+    ///     one less than number of available cores.
+    /// @return true if the file was opened and the loading started.
+    bool start(
+        const QString& filename,
+        ProtocolCreateFunc&& func,
+        unsigned threadsCount = 0U);
+
+    /// @brief Stop the loading.
+    /// @details The messages decoded so far but not taken yet are dropped.
+    void cancel();
+
+    /// @brief Take the decoded messages that are ready.
+    /// @details The messages are returned in the order of their appearance
+    ///     in the file. The created message objects belong to the thread
+    ///     which called @ref start().
+    /// @param[in] limit Stop taking further batches of messages when the
+    ///     limit is reached.
+    MessagesList takeLoaded(std::size_t limit = std::numeric_limits<std::size_t>::max());
+
+    /// @brief Check whether all the messages have been taken or the loading
+    ///     has been cancelled.
+    bool isComplete() const;
+
+    /// @brief Total size of the file.
+    long long bytesTotal() const;
+
+    /// @brief Number of bytes read from the file so far.
+    long long bytesRead() const;
+
+    /// @brief Number of messages taken so far.
+    std::size_t loadedCount() const;
+
+    /// @brief Description of the error in the file contents, empty if
+    ///     no error has been found.
+    QString errorString() const;
+
+private:
+    std::unique_ptr<MsgFileLoaderImpl> m_impl;
+};
+
+}  // namespace comms_champion
+
@@ -27,12 +27,15 @@
 CC_DISABLE_WARNINGS()
 #include <QtCore/QString>
 #include <QtCore/QVariantList>
+#include <QtCore/QVariantMap>
 #include <QtCore/QFile>
+#include <QtCore/QByteArray>
 CC_ENABLE_WARNINGS()
 
 #include "Api.h"
 #include "Message.h"
 #include "Protocol.h"
+#include "MsgFileLoader.h"
 
 namespace comms_champion
 {
@@ -64,10 +67,18 @@ public:
     MessagesList load(Type type, const QString& filename, Protocol& protocol);
     bool save(Type type, const QString& filename, const MessagesList& msgs);
 
+    typedef std::unique_ptr<MsgFileLoader> LoaderPtr;
+    LoaderPtr startRecvLoad(
+        const QString& filename,
+        MsgFileLoader::ProtocolCreateFunc&& func,
+        unsigned threadsCount = 0U);
+    static MessagePtr createRecvMsg(const QVariantMap& entry, Protocol& protocol);
+
     typedef std::shared_ptr<QFile> FileSaveHandler;
     static FileSaveHandler startRecvSave(const QString& filename);
     static void addToRecvSave(FileSaveHandler handler, const Message& msg, bool flush = false);
     static void flushRecvFile(FileSaveHandler handler);
+    static QByteArray encodeRecvMsg(const Message& msg);
 
 private:
     QString m_lastFile;
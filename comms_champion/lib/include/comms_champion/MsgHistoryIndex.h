@@ -0,0 +1,83 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+#include "Api.h"
+#include "Message.h"
+#include "MsgQuery.h"
+
+namespace comms_champion
+{
+
+class MsgHistoryIndexImpl;
+
+/// @brief Indexed history of messages to run the queries on.
+/// @details The messages are only recorded when added. The indices are
+///     populated lazily by the queries: the messages are grouped by their
+///     type (several types may share the same ID), and every field referenced
+///     by a query gets a column of decoded values per type. The following queries read the columns and only the
+///     messages added since the previous query are decoded.
+/// @headerfile comms_champion/MsgHistoryIndex.h
+class CC_API MsgHistoryIndex
+{
+public:
+    /// @brief List of message positions in the history.
+    typedef std::vector<std::size_t> PositionsList;
+
+    /// @brief Constructor
+    MsgHistoryIndex();
+
+    /// @brief Destructor
+    ~MsgHistoryIndex() noexcept;
+
+    /// @brief Add message to the end of the history.
+    void append(MessagePtr msg);
+
+    /// @brief Insert message at the specified position.
+    /// @details The indexed values of the other messages are kept, only
+    ///     the inserted message is decoded if it precedes the already
+    ///     indexed ones.
+    void insert(std::size_t pos, MessagePtr msg);
+
+    /// @brief Remove message at the specified position.
+    /// @details The indexed values of the other messages are kept.
+    void erase(std::size_t pos);
+
+    /// @brief Remove all the messages.
+    void clear();
+
+    /// @brief Number of messages in the history.
+    std::size_t size() const;
+
+    /// @brief Access message at the specified position.
+    const MessagePtr& at(std::size_t pos) const;
+
+    /// @brief Find all the messages matching the query.
+    /// @return Sorted positions of the matching messages.
+    PositionsList select(const MsgQuery& query);
+
+private:
+    std::unique_ptr<MsgHistoryIndexImpl> m_impl;
+};
+
+}  // namespace comms_champion
+
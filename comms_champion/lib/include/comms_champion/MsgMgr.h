@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <vector>
+#include <functional>
 
 #include "Api.h"
 #include "Message.h"
@@ -27,6 +28,7 @@
 #include "Message.h"
 #include "Socket.h"
 #include "Filter.h"
+#include "PipelineStats.h"
 
 namespace comms_champion
 {
@@ -39,6 +41,7 @@ public:
     typedef Protocol::MessagesList MessagesList;
 
     typedef Message::Type MsgType;
+    typedef std::function<ProtocolPtr ()> ProtocolCreateFunc;
 
     MsgMgr();
     ~MsgMgr() noexcept;
@@ -61,8 +64,14 @@ public:
 
     void setSocket(SocketPtr socket);
     void setProtocol(ProtocolPtr protocol);
+    void setRecvWorkers(ProtocolCreateFunc&& func, unsigned count = 0U);
     void addFilter(FilterPtr filter);
 
+    void setStatsEnabled(bool enabled);
+    bool isStatsEnabled() const;
+    PipelineStats getStats() const;
+    void resetStats();
+
     typedef std::function<void (MessagePtr msg)> MsgAddedCallbackFunc;
     typedef std::function<void (const QString& error)> ErrorReportCallbackFunc;
     typedef std::function<void ()> SocketDisconnectedReportCallbackFunc;
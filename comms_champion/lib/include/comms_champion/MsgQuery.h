@@ -0,0 +1,95 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+CC_ENABLE_WARNINGS()
+
+#include "Api.h"
+#include "Message.h"
+
+namespace comms_champion
+{
+
+class MsgQueryImpl;
+
+/// @brief Parsed query (filter) expression over messages.
+/// @details The expression consists of comparisons combined with
+///     @b &&, @b || and @b ! operators and parentheses. The left hand side
+///     of every comparison is one of:
+///     @li @b id - message ID or name (only @b == and @b != are supported)
+///     @li @b time - message timestamp (milliseconds since epoch)
+///     @li @b dir - message direction (@b recv or @b sent)
+///     @li name of the field as defined by @ref property::field::Common::name(),
+///         members of the bundles and bitfields are separated by @b ".", the
+///         names that contain spaces or clash with the keywords above
+///         need to be quoted.
+///
+///     The comparison operators are @b ==, @b !=, @b <, @b <=, @b >, @b >=.
+///     The right hand side is number, quoted string or a single word.
+///     Example:
+///     @code
+///     id == StatusReport && temperature > 80 && time >= 1476615600000
+///     @endcode
+///     Numeric fields are compared using the displayed value (with applied
+///     display offset and scaling). The comparison with a field, the
+///     message doesn't have (or the missing optional field), always fails.
+/// @headerfile comms_champion/MsgQuery.h
+class CC_API MsgQuery
+{
+public:
+    /// @brief Default constructor, creates query that matches all the messages.
+    MsgQuery();
+
+    /// @brief Copy constructor
+    MsgQuery(const MsgQuery&);
+
+    /// @brief Destructor
+    ~MsgQuery() noexcept;
+
+    /// @brief Copy assignment
+    MsgQuery& operator=(const MsgQuery&);
+
+    /// @brief Parse the expression.
+    /// @details Empty expression matches all the messages.
+    /// @return true on success, the query is left unchanged on failure.
+    bool parse(const QString& expr);
+
+    /// @brief Description of the last parse error.
+    const QString& errorString() const;
+
+    /// @brief Check whether the query matches all the messages.
+    bool isEmpty() const;
+
+    /// @brief Evaluate the query on single message.
+    bool matches(Message& msg) const;
+
+private:
+    friend class MsgHistoryIndexImpl;
+
+    std::shared_ptr<const MsgQueryImpl> m_impl;
+    QString m_error;
+};
+
+}  // namespace comms_champion
+
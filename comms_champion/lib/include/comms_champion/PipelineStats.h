@@ -0,0 +1,130 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstddef>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+#include <QtCore/QJsonObject>
+CC_ENABLE_WARNINGS()
+
+#include "Api.h"
+
+namespace comms_champion
+{
+
+/// @brief Statistics of the data processing pipeline.
+/// @details Collected by @ref MsgMgr (see @ref MsgMgr::setStatsEnabled())
+///     together with the @ref Protocol it uses. The collection is disabled
+///     by default.
+/// @headerfile comms_champion/PipelineStats.h
+struct CC_API PipelineStats
+{
+    /// @brief Processing stages of the received data.
+    enum class Stage
+    {
+        Filters, ///< Processing by all the filters (Filter::recvData())
+        Protocol, ///< Decoding by the protocol (Protocol::read())
+        Report, ///< Reporting of the new messages to the application
+        NumOfValues ///< Number of available values
+    };
+
+    /// @brief Histogram of the stage durations.
+    /// @details The bucket @b N counts durations in range
+    ///     [2^N, 2^(N+1)) microseconds, the bucket 0 also counts all the
+    ///     durations below 1 microsecond, the last one all the longer ones.
+    struct CC_API TimeHistogram
+    {
+        /// @brief Number of the buckets
+        static const std::size_t NumOfBuckets = 24U;
+
+        /// @brief Type of buckets storage
+        typedef std::array<unsigned long long, NumOfBuckets> Buckets;
+
+        Buckets m_buckets = Buckets(); ///< Counters of the buckets
+        unsigned long long m_count = 0U; ///< Number of measurements
+        unsigned long long m_totalNs = 0U; ///< Sum of the measured durations
+        unsigned long long m_maxNs = 0U; ///< Longest measured duration
+
+        /// @brief Add measurement
+        void add(unsigned long long ns);
+
+        /// @brief Average duration in nanoseconds
+        unsigned long long averageNs() const;
+
+        /// @brief Upper bound (in microseconds) of the bucket containing
+        ///     the requested percentile of the measurements.
+        unsigned long long percentileUs(unsigned percent) const;
+    };
+
+    /// @brief Statistics of single message type.
+    struct MsgTypeStats
+    {
+        QString m_id; ///< ID of the message
+        QString m_name; ///< Name of the message
+        unsigned long long m_count = 0U; ///< Number of received messages
+        unsigned long long m_bytes = 0U; ///< Total serialisation length
+        std::size_t m_minSize = 0U; ///< Shortest serialisation length
+        std::size_t m_maxSize = 0U; ///< Longest serialisation length
+    };
+
+    /// @brief List of message types statistics
+    typedef std::vector<MsgTypeStats> MsgTypesList;
+
+    /// @brief Storage of the stage histograms
+    typedef std::array<TimeHistogram, static_cast<std::size_t>(Stage::NumOfValues)> StagesList;
+
+    StagesList m_stages; ///< Durations of the processing stages
+    unsigned long long m_durationMs = 0U; ///< Time since the collection has been (re)started
+    unsigned long long m_recvChunks = 0U; ///< Number of data chunks reported by the socket
+    unsigned long long m_recvBytes = 0U; ///< Number of bytes reported by the socket
+    unsigned long long m_recvMsgs = 0U; ///< Number of received messages
+    unsigned long long m_sentMsgs = 0U; ///< Number of sent messages
+    unsigned long long m_sentBytes = 0U; ///< Number of bytes passed to the socket
+    unsigned long long m_invalidMsgs = 0U; ///< Number of messages with invalid contents
+    unsigned long long m_garbageBytes = 0U; ///< Number of bytes that couldn't be framed
+    unsigned long long m_errors = 0U; ///< Number of errors reported by socket and filters
+    std::size_t m_maxQueueDepth = 0U; ///< Maximal number of pending data chunks
+                                      /// produced by the filters out of single input
+    std::size_t m_historySize = 0U; ///< Number of messages stored in the history
+    MsgTypesList m_msgTypes; ///< Statistics of the received message types,
+                             /// sorted by number of messages
+
+    /// @brief Access the histogram of the stage
+    const TimeHistogram& stage(Stage value) const;
+
+    /// @brief Access the histogram of the stage
+    TimeHistogram& stage(Stage value);
+
+    /// @brief Name of the stage
+    static const char* stageName(Stage value);
+
+    /// @brief Rate of the counted messages (or bytes) per second.
+    double rate(unsigned long long count) const;
+
+    /// @brief Convert to JSON object.
+    QJsonObject toJson() const;
+};
+
+}  // namespace comms_champion
+
@@ -34,6 +34,7 @@ CC_ENABLE_WARNINGS()
 #include "Message.h"
 #include "ErrorStatus.h"
 #include "DataInfo.h"
+#include "PipelineStats.h"
 
 namespace comms_champion
 {
@@ -62,6 +63,9 @@ public:
         Changed ///< The message contents have been changed
     };
 
+    /// @brief Default constructor
+    Protocol();
+
     /// @brief Destructor
     virtual ~Protocol() noexcept;
 
@@ -104,10 +108,48 @@ public:
     /// @return Pointer to newly created message with the same contents
     MessagePtr cloneMessage(const Message& msg);
 
+    /// @brief Copy the message object together with its protocol related properties
+    /// @details Unlike cloneMessage(), it doesn't serialise the message again
+    ///     to refresh the "transport" and "raw data" information, they are
+    ///     shared with the original message. Suitable for sending the
+    ///     same unmodified message multiple times. Invokes cloneMessageImpl().
+    /// @return Pointer to newly created message with the same contents
+    MessagePtr copyMessage(const Message& msg);
+
     /// @brief Create dummy message containing invalid input
     /// @brief Invokes createInvalidMessageImpl().
     MessagePtr createInvalidMessage(const MsgDataSeq& data);
 
+    /// @brief Enable / disable decode only mode of read().
+    /// @details In this mode the created messages don't receive the "transport",
+    ///     "raw data" and "extra info" messages, nor protocol name as their
+    ///     properties. Suitable when the messages are counted or processed
+    ///     rather than displayed. Disabled by default.
+    void setDecodeOnly(bool value);
+
+    /// @brief Check whether decode only mode is enabled.
+    bool isDecodeOnly() const;
+
+    /// @brief Enable / disable collection of the decoding statistics.
+    /// @details Disabled by default. Disabling discards the collected values.
+    void setStatsEnabled(bool enabled);
+
+    /// @brief Check whether collection of the decoding statistics is enabled.
+    bool isStatsEnabled() const;
+
+    /// @brief Add collected decoding statistics (invalid messages, garbage
+    ///     bytes and received message types) to the provided object.
+    void collectStats(PipelineStats& stats) const;
+
+    /// @brief Reset collected decoding statistics.
+    void resetStats();
+
+    /// @brief Number of successfully decoded messages since the collection
+    ///     of the statistics has been enabled or reset.
+    /// @details Doesn't include the messages reporting invalid contents or
+    ///     garbage data. Always 0 when the collection is disabled.
+    unsigned long long decodedMsgsCount() const;
+
 protected:
     /// @brief Polymorphic protocol name retrieval.
     /// @details Invoked by name().
@@ -182,6 +224,32 @@ protected:
     /// @brief Helper function to check whether "extra info" existence is force.
     static bool getForceExtraInfoExistenceFromMessageProperties(const Message& msg);
 
+    /// @brief Helper function to record successfully decoded message in
+    ///     the statistics.
+    /// @details Expected to be used by the derived class, does nothing when
+    ///     the statistics collection is disabled.
+    void reportMsgStats(const Message& msg, std::size_t size);
+
+    /// @brief Helper function to record message with invalid contents in
+    ///     the statistics.
+    /// @details Expected to be used by the derived class.
+    void reportInvalidMsgStats();
+
+    /// @brief Helper function to record bytes, that couldn't be framed, in
+    ///     the statistics.
+    /// @details Expected to be used by the derived class.
+    void reportGarbageStats(std::size_t count);
+
+private:
+    struct StatsData;
+    struct TypesRegistry;
+
+    void updateTypeInfo(Message& msg);
+
+    std::unique_ptr<StatsData> m_stats;
+    std::unique_ptr<TypesRegistry> m_types;
+    bool m_decodeOnly = false;
+
 };
 
 /// @brief Pointer to @ref Protocol object.
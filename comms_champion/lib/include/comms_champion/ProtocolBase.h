@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <map>
 #include <cassert>
 
 
@@ -104,38 +105,55 @@ protected:
         "AllMessages is expected to be a tuple.");
 
     /// @brief Overriding implementation to Protocol::readImpl().
+    /// @details The framing state (buffered incomplete data and accumulated
+    ///     garbage) is kept separately for every connection identified by
+    ///     @ref DataInfo::m_connectionId, so interleaved input from multiple
+    ///     peers doesn't corrupt each other's framing. The state of the
+    ///     connection is released when @b final input is processed.
     virtual MessagesList readImpl(const DataInfo& dataInfo, bool final) override
     {
-        const std::uint8_t* iter = &dataInfo.m_data[0];
-        auto size = dataInfo.m_data.size();
+        auto stateGuard =
+            comms::util::makeScopeGuard(
+                [this, &dataInfo]()
+                {
+                    m_readStates.erase(dataInfo.m_connectionId);
+                });
+
+        if (!final) {
+            stateGuard.release();
+        }
+
+        auto& readState = m_readStates[dataInfo.m_connectionId];
+        auto& readData = readState.m_data;
+        auto& garbage = readState.m_garbage;
 
         MessagesList allMsgs;
-        m_data.reserve(m_data.size() + size);
-        std::copy_n(iter, size, std::back_inserter(m_data));
+        readData.reserve(readData.size() + dataInfo.m_data.size());
+        readData.insert(readData.end(), dataInfo.m_data.begin(), dataInfo.m_data.end());
 
         using ReadIterator = typename ProtocolMessage::ReadIterator;
-        ReadIterator readIterBeg = &m_data[0];
+        ReadIterator readIterBeg = readData.data();
 
         auto remainingSizeCalc =
-            [this](ReadIterator readIter) -> std::size_t
+            [&readData](ReadIterator readIter) -> std::size_t
             {
-                ReadIterator const dataBegin = &m_data[0];
+                ReadIterator const dataBegin = readData.data();
                 auto consumed =
                     static_cast<std::size_t>(
                         std::distance(dataBegin, readIter));
-                assert(consumed <= m_data.size());
-                return m_data.size() - consumed;
+                assert(consumed <= readData.size());
+                return readData.size() - consumed;
             };
 
         auto eraseGuard =
             comms::util::makeScopeGuard(
-                [this, &readIterBeg]()
+                [&readData, &readIterBeg]()
                 {
-                    ReadIterator dataBegin = &m_data[0];
+                    ReadIterator dataBegin = readData.data();
                     auto dist =
                         static_cast<std::size_t>(
                             std::distance(dataBegin, readIterBeg));
-                    m_data.erase(m_data.begin(), m_data.begin() + dist);
+                    readData.erase(readData.begin(), readData.begin() + dist);
                 });
 
         auto setExtraInfoFunc =
@@ -158,20 +176,23 @@ protected:
             };
 
         auto checkGarbageFunc =
-            [this, &allMsgs, &setExtraInfoFunc]()
+            [this, &garbage, &allMsgs, &setExtraInfoFunc]()
             {
-                if (!m_garbage.empty()) {
+                if (!garbage.empty()) {
+                    reportGarbageStats(garbage.size());
                     MessagePtr invalidMsgPtr(new InvalidMsg());
-                    setNameToMessageProperties(*invalidMsgPtr);
-                    std::unique_ptr<RawDataMsg> rawDataMsgPtr(new RawDataMsg());
-                    ReadIterator garbageReadIterator = &m_garbage[0];
-                    auto esTmp = rawDataMsgPtr->read(garbageReadIterator, m_garbage.size());
-                    static_cast<void>(esTmp);
-                    assert(esTmp == comms::ErrorStatus::Success);
-                    setRawDataToMessageProperties(MessagePtr(rawDataMsgPtr.release()), *invalidMsgPtr);
-                    setExtraInfoFunc(*invalidMsgPtr);
+                    if (!isDecodeOnly()) {
+                        setNameToMessageProperties(*invalidMsgPtr);
+                        std::unique_ptr<RawDataMsg> rawDataMsgPtr(new RawDataMsg());
+                        ReadIterator garbageReadIterator = garbage.data();
+                        auto esTmp = rawDataMsgPtr->read(garbageReadIterator, garbage.size());
+                        static_cast<void>(esTmp);
+                        assert(esTmp == comms::ErrorStatus::Success);
+                        setRawDataToMessageProperties(MessagePtr(rawDataMsgPtr.release()), *invalidMsgPtr);
+                        setExtraInfoFunc(*invalidMsgPtr);
+                    }
                     allMsgs.push_back(std::move(invalidMsgPtr));
-                    m_garbage.clear();
+                    garbage.clear();
                 }
             };
 
@@ -199,13 +220,19 @@ protected:
                     [this, &allMsgs, &msgPtr]()
                     {
                         assert(msgPtr);
-                        setNameToMessageProperties(*msgPtr);
+                        if (!isDecodeOnly()) {
+                            setNameToMessageProperties(*msgPtr);
+                        }
                         allMsgs.push_back(MessagePtr(std::move(msgPtr)));
                     });
 
             auto setExtrasFunc =
-                [readIterBeg, &readIterCur, &msgPtr, &setExtraInfoFunc]()
+                [this, readIterBeg, &readIterCur, &msgPtr, &setExtraInfoFunc]()
                 {
+                    if (isDecodeOnly()) {
+                        return;
+                    }
+
                     // readIterBeg is captured by value on purpose
                     auto dataSize = static_cast<std::size_t>(
                                 std::distance(readIterBeg, readIterCur));
@@ -229,6 +256,9 @@ protected:
             if (es == comms::ErrorStatus::Success) {
                 checkGarbageFunc();
                 assert(msgPtr);
+                reportMsgStats(
+                    *msgPtr,
+                    static_cast<std::size_t>(std::distance(readIterBeg, readIterCur)));
                 setExtrasFunc();
                 readIterBeg = readIterCur;
                 continue;
@@ -236,6 +266,7 @@ protected:
 
             if (es == comms::ErrorStatus::InvalidMsgData) {
                 checkGarbageFunc();
+                reportInvalidMsgStats();
                 msgPtr.reset(new InvalidMsg());
                 setExtrasFunc();
                 readIterBeg = readIterCur;
@@ -250,20 +281,20 @@ protected:
             }
 
             // Protocol error
-            m_garbage.push_back(*readIterBeg);
+            garbage.push_back(*readIterBeg);
             static const std::size_t GarbageLimit = 512;
-            if (GarbageLimit <= m_garbage.size()) {
+            if (GarbageLimit <= garbage.size()) {
                 checkGarbageFunc();
             }
             ++readIterBeg;
         }
 
         if (final) {
-            ReadIterator dataBegin = &m_data[0];
+            ReadIterator dataBegin = readData.data();
             auto consumed =
                 static_cast<std::size_t>(std::distance(dataBegin, readIterBeg));
-            auto remDataCount = m_data.size() - consumed;
-            m_garbage.insert(m_garbage.end(), m_data.begin() + consumed, m_data.end());
+            auto remDataCount = readData.size() - consumed;
+            garbage.insert(garbage.end(), readData.begin() + consumed, readData.end());
             std::advance(readIterBeg, remDataCount);
             checkGarbageFunc();
         }
@@ -573,9 +604,16 @@ private:
         return result;
     }
 
+    struct ReadState
+    {
+        std::vector<std::uint8_t> m_data;
+        std::vector<std::uint8_t> m_garbage;
+    };
+
+    using ReadStatesMap = std::map<DataInfo::ConnectionId, ReadState>;
+
     ProtocolStack m_protStack;
-    std::vector<std::uint8_t> m_data;
-    std::vector<std::uint8_t> m_garbage;
+    ReadStatesMap m_readStates;
 };
 
 }  // namespace comms_champion
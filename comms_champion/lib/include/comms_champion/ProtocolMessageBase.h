@@ -82,6 +82,15 @@ protected:
         actObj = *castedOther;
         return true;
     }
+
+    /// @brief Overriding implementation to comms_champion::Message::hasStaticTypeInfoImpl()
+    /// @details The name and ID are considered to be the same for all the
+    ///     objects when the message ID is provided using
+    ///     @b comms::option::StaticNumIdImpl option.
+    virtual bool hasStaticTypeInfoImpl() const override
+    {
+        return Base::ImplOptions::HasStaticMsgId;
+    }
 };
 
 }  // namespace comms_champion
@@ -31,6 +31,7 @@ CC_ENABLE_WARNINGS()
 
 #include "Api.h"
 #include "DataInfo.h"
+#include "Protocol.h"
 
 namespace comms_champion
 {
@@ -130,6 +131,17 @@ public:
         m_disconnectedReportCallback = std::forward<TFunc>(func);
     }
 
+    /// @brief Callback to report termination of one of the peer connections
+    using ConnectionClosedReportCallback = std::function <void (DataInfo::ConnectionId)>;
+
+    /// @brief Set callback to report termination of one of the peer connections
+    /// @details The callback must have the same signature as @ref ConnectionClosedReportCallback.
+    template <typename TFunc>
+    void setConnectionClosedReportCallback(TFunc&& func)
+    {
+        m_connectionClosedReportCallback = std::forward<TFunc>(func);
+    }
+
     /// @brief Get properties describing socket connection right after plugins
     ///     have been loaded and applied.
     /// @details The returned value is used by the driving application to
@@ -138,6 +150,15 @@ public:
     ///     explicty user request.
     /// @return OR-ed values of @ref ConnectionProperty values.
     unsigned connectionProperties() const;
+
+    /// @brief Inform the socket about the protocol being used.
+    /// @details Invoked by the driving application prior to start(). Most
+    ///     sockets don't care about the protocol, but some (like traffic
+    ///     generators) may use it to create and serialise messages. The function
+    ///     invokes virtual applyProtocolImpl(), which can be overridden by the
+    ///     derived class.
+    /// @param[in] protocol Pointer to protocol object, can be empty.
+    void applyProtocol(ProtocolPtr protocol);
 protected:
     /// @brief Polymorphic start functionality implementation.
     /// @details Invoked by start() and default implementation does nothing.
@@ -172,6 +193,11 @@ protected:
     /// @return 0.
     virtual unsigned connectionPropertiesImpl() const;
 
+    /// @brief Polymorphic protocol assignment functionality implementation.
+    /// @details Invoked by applyProtocol(). Default implementation does nothing.
+    ///     It can be overridden by the derived class.
+    virtual void applyProtocolImpl(ProtocolPtr protocol);
+
     /// @brief Report new data has been received.
     /// @details This function needs to be invoked by the derived class when
     ///     new data has been received from the I/O link. This function
@@ -193,10 +219,21 @@ protected:
     ///     derived class and it will invoke callback set by setDisconnectedReportCallback().
     void reportDisconnected();
 
+    /// @brief Report termination of one of the peer connections.
+    /// @details Sockets that serve multiple peers report the received data
+    ///     with different @ref DataInfo::m_connectionId values. When such
+    ///     peer disconnects, the derived class is expected to invoke this
+    ///     function to allow the application release the decoding state
+    ///     associated with the connection. It will invoke callback set
+    ///     by setConnectionClosedReportCallback().
+    /// @param[in] id Identifier of the connection.
+    void reportConnectionClosed(DataInfo::ConnectionId id);
+
 private:
     DataReceivedCallback m_dataReceivedCallback;
     ErrorReportCallback m_errorReportCallback;
     DisconnectedReportCallback m_disconnectedReportCallback;
+    ConnectionClosedReportCallback m_connectionClosedReportCallback;
 
     bool m_running = false;
     bool m_connected = false;
@@ -22,6 +22,7 @@
 
 #include "Api.h"
 #include "Message.h"
+#include "FieldDescriptor.h"
 #include "MessageHandler.h"
 #include "MessageBase.h"
 #include "ErrorStatus.h"
@@ -36,8 +37,12 @@
 #include "field_wrapper/FieldWrapperHandler.h"
 #include "InvalidMessage.h"
 #include "MsgMgr.h"
+#include "PipelineStats.h"
 #include "MsgFileMgr.h"
+#include "MsgFileLoader.h"
 #include "MsgSendMgr.h"
+#include "MsgQuery.h"
+#include "MsgHistoryIndex.h"
 #include "StaticSingleton.h"
 #include "property/message.h"
 #include "property/field.h"
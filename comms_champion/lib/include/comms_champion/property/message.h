@@ -30,6 +30,7 @@ CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Api.h"
 #include "comms_champion/Message.h"
+#include "comms_champion/DataInfo.h"
 
 namespace comms_champion
 {
@@ -258,6 +259,28 @@ private:
     static const QByteArray PropName;
 };
 
+class CC_API ConnectionId : public PropBase<unsigned>
+{
+    typedef PropBase<unsigned> Base;
+public:
+    ConnectionId() : Base(Name, PropName) {};
+
+private:
+    static const QString Name;
+    static const QByteArray PropName;
+};
+
+class CC_API OutData : public PropBase<DataInfoPtr>
+{
+    typedef PropBase<DataInfoPtr> Base;
+public:
+    OutData() : Base(Name, PropName) {};
+
+private:
+    static const QString Name;
+    static const QByteArray PropName;
+};
+
 class CC_API ScrollPos : public PropBase<int>
 {
     typedef PropBase<int> Base;
@@ -0,0 +1,113 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "comms_champion/FieldDescriptor.h"
+
+namespace comms_champion
+{
+
+FieldDescriptor::FieldDescriptor(const QVariantMap& props)
+  : m_props(props)
+{
+    // The data element of the properties is shared between the field kinds,
+    // read the lists in order that doesn't allow misinterpretation.
+    property::field::IntValue intProps(props);
+    m_name = intProps.name();
+    m_hidden = intProps.isHidden();
+    m_serHidden = intProps.isSerialisedHidden();
+    m_readOnly = intProps.isReadOnly();
+    m_displayOffset = intProps.displayOffset();
+    m_decimals = intProps.scaledDecimals();
+
+    property::field::ArrayList listProps(props);
+    m_prefixVisible = listProps.isPrefixVisible();
+    m_prefixName = listProps.prefixName();
+
+    auto& membersProps = listProps.elements();
+    m_members.reserve(static_cast<std::size_t>(membersProps.size()));
+    for (auto& m : membersProps) {
+        m_members.push_back(create(m));
+    }
+
+    property::field::Optional optProps(props);
+    m_uncheckable = optProps.isUncheckable();
+    if (m_members.empty()) {
+        auto& fieldProps = optProps.field();
+        if (!fieldProps.isEmpty()) {
+            m_members.push_back(create(fieldProps));
+        }
+    }
+
+    m_indexHidden = property::field::Variant(props).isIndexHidden();
+
+    if (m_members.empty()) {
+        m_enumValues = property::field::EnumValue(props).values();
+    }
+
+    if (m_members.empty() && m_enumValues.isEmpty()) {
+        m_bits = property::field::BitmaskValue(props).bits();
+    }
+}
+
+FieldDescriptor::~FieldDescriptor() noexcept = default;
+
+FieldDescriptor::Ptr FieldDescriptor::create(const QVariantMap& props)
+{
+    return std::make_shared<FieldDescriptor>(props);
+}
+
+FieldDescriptor::Ptr FieldDescriptor::create(const QVariant& props)
+{
+    if (props.isValid() && props.canConvert<QVariantMap>()) {
+        return create(props.value<QVariantMap>());
+    }
+
+    return create(QVariantMap());
+}
+
+FieldDescriptor::List FieldDescriptor::createList(const QVariantList& props)
+{
+    List result;
+    result.reserve(static_cast<std::size_t>(props.size()));
+    for (auto& p : props) {
+        result.push_back(create(p));
+    }
+    return result;
+}
+
+const FieldDescriptor& FieldDescriptor::empty()
+{
+    static const FieldDescriptor Desc{QVariantMap()};
+    return Desc;
+}
+
+const FieldDescriptor& FieldDescriptor::member(std::size_t idx) const
+{
+    if (m_members.size() <= idx) {
+        return empty();
+    }
+
+    auto& ptr = m_members[idx];
+    if (!ptr) {
+        return empty();
+    }
+
+    return *ptr;
+}
+
+}  // namespace comms_champion
+
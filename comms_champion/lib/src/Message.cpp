@@ -37,11 +37,59 @@ const char* Message::name() const
     return nameImpl();
 }
 
+QString Message::nameAsString() const
+{
+    if (m_typeInfo && m_typeInfo->m_static) {
+        return m_typeInfo->m_name;
+    }
+
+    return QString(name());
+}
+
 const QVariantList& Message::fieldsProperties() const
 {
     return fieldsPropertiesImpl();
 }
 
+const FieldDescriptor::List& Message::fieldsDescriptors() const
+{
+    return typeInfo().m_fieldsDescriptors;
+}
+
+const Message::TypeInfo& Message::typeInfo() const
+{
+    if (!m_typeInfo) {
+        m_typeInfo = createTypeInfo();
+    }
+
+    return *m_typeInfo;
+}
+
+Message::TypeInfoPtr Message::createTypeInfo() const
+{
+    auto info = std::make_shared<TypeInfo>();
+    info->m_fieldsDescriptors = FieldDescriptor::createList(fieldsProperties());
+    info->m_static = hasStaticTypeInfoImpl();
+    if (info->m_static) {
+        info->m_name = QString(nameImpl());
+        info->m_idAsString = idAsStringImpl();
+        info->m_idAsStdString = info->m_idAsString.toStdString();
+    }
+
+    return info;
+}
+
+void Message::setTypeInfo(TypeInfoPtr info)
+{
+    assert(info);
+    m_typeInfo = std::move(info);
+}
+
+bool Message::hasTypeInfo() const
+{
+    return static_cast<bool>(m_typeInfo);
+}
+
 void Message::dispatch(MessageHandler& handler)
 {
     dispatchImpl(handler);
@@ -54,6 +102,10 @@ bool Message::refreshMsg()
 
 QString Message::idAsString() const
 {
+    if (m_typeInfo && m_typeInfo->m_static) {
+        return m_typeInfo->m_idAsString;
+    }
+
     return idAsStringImpl();
 }
 
@@ -88,5 +140,10 @@ const QVariantList& Message::fieldsPropertiesImpl() const
     return Props;
 }
 
+bool Message::hasStaticTypeInfoImpl() const
+{
+    return false;
+}
+
 }  // namespace comms_champion
 
@@ -0,0 +1,77 @@
+//
+// Copyright 2014 - 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "comms_champion/MsgFileLoader.h"
+
+#include "MsgFileLoaderImpl.h"
+
+namespace comms_champion
+{
+
+MsgFileLoader::MsgFileLoader()
+  : m_impl(new MsgFileLoaderImpl())
+{
+}
+
+MsgFileLoader::~MsgFileLoader() noexcept = default;
+
+bool MsgFileLoader::start(
+    const QString& filename,
+    ProtocolCreateFunc&& func,
+    unsigned threadsCount)
+{
+    return m_impl->start(filename, std::move(func), threadsCount);
+}
+
+void MsgFileLoader::cancel()
+{
+    m_impl->cancel();
+}
+
+MsgFileLoader::MessagesList MsgFileLoader::takeLoaded(std::size_t limit)
+{
+    return m_impl->takeLoaded(limit);
+}
+
+bool MsgFileLoader::isComplete() const
+{
+    return m_impl->isComplete();
+}
+
+long long MsgFileLoader::bytesTotal() const
+{
+    return m_impl->bytesTotal();
+}
+
+long long MsgFileLoader::bytesRead() const
+{
+    return m_impl->bytesRead();
+}
+
+std::size_t MsgFileLoader::loadedCount() const
+{
+    return m_impl->loadedCount();
+}
+
+QString MsgFileLoader::errorString() const
+{
+    return m_impl->errorString();
+}
+
+}  // namespace comms_champion
+
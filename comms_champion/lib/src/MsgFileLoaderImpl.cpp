@@ -0,0 +1,398 @@
+//
+// Copyright 2014 - 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "MsgFileLoaderImpl.h"
+
+#include <cassert>
+#include <iostream>
+#include <utility>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QVariantMap>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/MsgFileMgr.h"
+
+namespace comms_champion
+{
+
+namespace
+{
+
+const qint64 ReadChunkSize = 1024 * 1024;
+const std::size_t EntriesPerJob = 256U;
+const std::size_t PendingJobsPerWorker = 4U;
+
+bool isWhitespace(char ch)
+{
+    return (ch == ' ') || (ch == '\n') || (ch == '\r') || (ch == '\t');
+}
+
+}  // namespace
+
+MsgFileLoaderImpl::MsgFileLoaderImpl() = default;
+
+MsgFileLoaderImpl::~MsgFileLoaderImpl() noexcept
+{
+    cancel();
+}
+
+bool MsgFileLoaderImpl::start(
+    const QString& filename,
+    ProtocolCreateFunc&& func,
+    unsigned threadsCount)
+{
+    assert(!m_file);
+    assert(func);
+    std::unique_ptr<QFile> file(new QFile(filename));
+    if (!file->open(QIODevice::ReadOnly)) {
+        std::cerr << "ERROR: Failed to load the file " <<
+            filename.toStdString() << std::endl;
+        return false;
+    }
+
+    if (threadsCount == 0U) {
+        auto cores = std::thread::hardware_concurrency();
+        threadsCount = 1U;
+        if (1U < cores) {
+            threadsCount = cores - 1U;
+        }
+    }
+
+    for (auto idx = 0U; idx < threadsCount; ++idx) {
+        auto protocol = func();
+        if (!protocol) {
+            break;
+        }
+
+        m_protocols.push_back(std::move(protocol));
+    }
+
+    if (m_protocols.empty()) {
+        std::cerr << "ERROR: Protocol hasn't been set!" << std::endl;
+        return false;
+    }
+
+    m_file = std::move(file);
+    m_bytesTotal = m_file->size();
+    m_ownerThread = QThread::currentThread();
+    m_maxPendingJobs = m_protocols.size() * PendingJobsPerWorker;
+
+    m_reader = std::thread(
+        [this]()
+        {
+            readerLoop();
+        });
+
+    for (auto& protocol : m_protocols) {
+        auto* protocolPtr = protocol.get();
+        m_workers.emplace_back(
+            [this, protocolPtr]()
+            {
+                workerLoop(*protocolPtr);
+            });
+    }
+    return true;
+}
+
+void MsgFileLoaderImpl::cancel()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_cancelled = true;
+    }
+
+    m_jobsCond.notify_all();
+    m_spaceCond.notify_all();
+    stopThreads();
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_jobs.clear();
+    m_done.clear();
+}
+
+MsgFileLoaderImpl::MessagesList MsgFileLoaderImpl::takeLoaded(std::size_t limit)
+{
+    MessagesList result;
+    std::size_t count = 0U;
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        auto takenJobsPrev = m_takenJobs;
+        while (count < limit) {
+            auto iter = m_done.find(m_takenJobs);
+            if (iter == m_done.end()) {
+                break;
+            }
+
+            count += iter->second.size();
+            result.splice(result.end(), iter->second);
+            m_done.erase(iter);
+            ++m_takenJobs;
+        }
+
+        if (takenJobsPrev != m_takenJobs) {
+            m_spaceCond.notify_one();
+        }
+    }
+
+    m_loadedCount += count;
+    return result;
+}
+
+bool MsgFileLoaderImpl::isComplete() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return
+        m_cancelled ||
+        (m_readComplete && (m_takenJobs == m_producedJobs));
+}
+
+QString MsgFileLoaderImpl::errorString() const
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_error;
+}
+
+void MsgFileLoaderImpl::readerLoop()
+{
+    EntriesList entries;
+    entries.reserve(EntriesPerJob);
+    QByteArray entry;
+    int depth = 0;
+    bool arrayStarted = false;
+    bool arrayEnded = false;
+    bool inString = false;
+    bool escaped = false;
+    bool failed = false;
+
+    // Only the boundaries of the top level array elements are located
+    // here, the elements themselves are parsed by the workers.
+    while ((!arrayEnded) && (!failed) && (!m_cancelled)) {
+        auto chunk = m_file->read(ReadChunkSize);
+        if (chunk.isEmpty()) {
+            break;
+        }
+
+        m_bytesRead += chunk.size();
+        int entryStart = 0;
+        auto* chunkData = chunk.constData();
+        for (int idx = 0; idx < chunk.size(); ++idx) {
+            auto ch = chunkData[idx];
+            if (0 < depth) {
+                if (inString) {
+                    if (escaped) {
+                        escaped = false;
+                    }
+                    else if (ch == '\\') {
+                        escaped = true;
+                    }
+                    else if (ch == '"') {
+                        inString = false;
+                    }
+                    continue;
+                }
+
+                if (ch == '"') {
+                    inString = true;
+                }
+                else if ((ch == '{') || (ch == '[')) {
+                    ++depth;
+                }
+                else if ((ch == '}') || (ch == ']')) {
+                    --depth;
+                }
+
+                if (0 < depth) {
+                    continue;
+                }
+
+                entry.append(chunkData + entryStart, (idx + 1) - entryStart);
+                entries.push_back(std::move(entry));
+                entry = QByteArray();
+                if ((EntriesPerJob <= entries.size()) && (!pushJob(entries))) {
+                    failed = true;
+                    break;
+                }
+                continue;
+            }
+
+            if (isWhitespace(ch)) {
+                continue;
+            }
+
+            if (!arrayStarted) {
+                if (ch != '[') {
+                    failed = true;
+                    break;
+                }
+
+                arrayStarted = true;
+                continue;
+            }
+
+            if (ch == ',') {
+                continue;
+            }
+
+            if (ch == ']') {
+                arrayEnded = true;
+                break;
+            }
+
+            if (ch != '{') {
+                failed = true;
+                break;
+            }
+
+            depth = 1;
+            entryStart = idx;
+        }
+
+        if (0 < depth) {
+            entry.append(chunkData + entryStart, chunk.size() - entryStart);
+        }
+    }
+
+    if (m_cancelled) {
+        return;
+    }
+
+    if (m_file->error() != QFile::NoError) {
+        reportError(QObject::tr("Failed to read the file"));
+    }
+    else if (!arrayEnded) {
+        reportError(QObject::tr("Invalid contents of messages file!"));
+    }
+
+    if (!entries.empty()) {
+        pushJob(entries);
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_readComplete = true;
+    }
+    m_jobsCond.notify_all();
+}
+
+void MsgFileLoaderImpl::workerLoop(Protocol& protocol)
+{
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> guard(m_mutex);
+            m_jobsCond.wait(
+                guard,
+                [this]() -> bool
+                {
+                    return m_cancelled || m_readComplete || (!m_jobs.empty());
+                });
+
+            if (m_cancelled || m_jobs.empty()) {
+                return;
+            }
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        MessagesList msgs;
+        for (auto& entry : job.m_entries) {
+            if (m_cancelled) {
+                return;
+            }
+
+            auto jsonError = QJsonParseError();
+            auto jsonDoc = QJsonDocument::fromJson(entry, &jsonError);
+            if ((jsonError.error != QJsonParseError::NoError) || (!jsonDoc.isObject())) {
+                reportError(QObject::tr("Invalid contents of messages file!"));
+                continue;
+            }
+
+            auto msg = MsgFileMgr::createRecvMsg(jsonDoc.object().toVariantMap(), protocol);
+            if (!msg) {
+                continue;
+            }
+
+            msg->moveToThread(m_ownerThread);
+            msgs.push_back(std::move(msg));
+        }
+
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_done.insert(std::make_pair(job.m_seq, std::move(msgs)));
+    }
+}
+
+bool MsgFileLoaderImpl::pushJob(EntriesList& entries)
+{
+    {
+        std::unique_lock<std::mutex> guard(m_mutex);
+        m_spaceCond.wait(
+            guard,
+            [this]() -> bool
+            {
+                return m_cancelled || ((m_producedJobs - m_takenJobs) < m_maxPendingJobs);
+            });
+
+        if (m_cancelled) {
+            return false;
+        }
+
+        Job job;
+        job.m_seq = m_producedJobs;
+        job.m_entries.swap(entries);
+        ++m_producedJobs;
+        m_jobs.push_back(std::move(job));
+    }
+
+    m_jobsCond.notify_one();
+    entries.reserve(EntriesPerJob);
+    return true;
+}
+
+void MsgFileLoaderImpl::reportError(const QString& error)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (!m_error.isEmpty()) {
+        return;
+    }
+
+    std::cerr << "ERROR: " << error.toStdString() << std::endl;
+    m_error = error;
+}
+
+void MsgFileLoaderImpl::stopThreads()
+{
+    if (m_reader.joinable()) {
+        m_reader.join();
+    }
+
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    m_workers.clear();
+}
+
+}  // namespace comms_champion
+
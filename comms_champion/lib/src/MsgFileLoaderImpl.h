@@ -0,0 +1,114 @@
+//
+// Copyright 2014 - 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <deque>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QThread>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/MsgFileLoader.h"
+
+namespace comms_champion
+{
+
+class MsgFileLoaderImpl
+{
+public:
+    typedef MsgFileLoader::MessagesList MessagesList;
+    typedef MsgFileLoader::ProtocolCreateFunc ProtocolCreateFunc;
+
+    MsgFileLoaderImpl();
+    ~MsgFileLoaderImpl() noexcept;
+
+    bool start(const QString& filename, ProtocolCreateFunc&& func, unsigned threadsCount);
+    void cancel();
+    MessagesList takeLoaded(std::size_t limit);
+    bool isComplete() const;
+
+    long long bytesTotal() const
+    {
+        return m_bytesTotal;
+    }
+
+    long long bytesRead() const
+    {
+        return m_bytesRead;
+    }
+
+    std::size_t loadedCount() const
+    {
+        return m_loadedCount;
+    }
+
+    QString errorString() const;
+
+private:
+    typedef std::vector<QByteArray> EntriesList;
+
+    struct Job
+    {
+        std::size_t m_seq = 0U;
+        EntriesList m_entries;
+    };
+
+    void readerLoop();
+    void workerLoop(Protocol& protocol);
+    bool pushJob(EntriesList& entries);
+    void reportError(const QString& error);
+    void stopThreads();
+
+    std::unique_ptr<QFile> m_file;
+    QThread* m_ownerThread = nullptr;
+    std::vector<ProtocolPtr> m_protocols;
+    std::thread m_reader;
+    std::vector<std::thread> m_workers;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_jobsCond;
+    std::condition_variable m_spaceCond;
+    std::deque<Job> m_jobs;
+    std::map<std::size_t, MessagesList> m_done;
+    std::size_t m_producedJobs = 0U;
+    std::size_t m_takenJobs = 0U;
+    std::size_t m_maxPendingJobs = 0U;
+    bool m_readComplete = false;
+    std::atomic<bool> m_cancelled{false};
+    QString m_error;
+
+    long long m_bytesTotal = 0;
+    std::atomic<long long> m_bytesRead{0};
+    std::size_t m_loadedCount = 0U;
+};
+
+}  // namespace comms_champion
+
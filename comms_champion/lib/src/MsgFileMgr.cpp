@@ -201,14 +201,9 @@ QString encodeMsgData(const Message& msg)
 }
 
 MessagePtr createMsgObjectFrom(
-    const QVariant& msgMapVar,
+    const QVariantMap& msgMap,
     Protocol& protocol)
 {
-    if ((!msgMapVar.isValid()) || (!msgMapVar.canConvert<QVariantMap>())) {
-        return MessagePtr();
-    }
-
-    auto msgMap = msgMapVar.value<QVariantMap>();
     auto msgId = IdProp().getFrom(msgMap);
     auto dataStr = DataProp().getFrom(msgMap);
 
@@ -343,25 +338,15 @@ MsgFileMgr::MessagesList convertRecvMsgList(
     MsgFileMgr::MessagesList convertedList;
 
     for (auto& msgMapVar : msgs) {
-        auto msg = createMsgObjectFrom(msgMapVar, protocol);
-        if (!msg) {
+        if ((!msgMapVar.isValid()) || (!msgMapVar.canConvert<QVariantMap>())) {
             continue;
         }
 
-        assert(msgMapVar.isValid() && msgMapVar.canConvert<QVariantMap>());
-
-        auto msgMap = msgMapVar.value<QVariantMap>();
-        auto timestamp = TimestampProp().getFrom(msgMap);
-        if (timestamp == 0) {
-            // Not a receive list, skip message
+        auto msg = MsgFileMgr::createRecvMsg(msgMapVar.value<QVariantMap>(), protocol);
+        if (!msg) {
             continue;
         }
 
-        auto type = static_cast<Message::Type>(TypeProp().getFrom(msgMap));
-
-        property::message::Timestamp().setTo(timestamp, *msg);
-        property::message::Type().setTo(type, *msg);
-
         convertedList.push_back(std::move(msg));
     }
     return convertedList;
@@ -404,14 +389,16 @@ MsgFileMgr::MessagesList convertSendMsgList(
     unsigned long long prevTimestamp = 0;
 
     for (auto& msgMapVar : msgs) {
-        auto msg = createMsgObjectFrom(msgMapVar, protocol);
-        if (!msg) {
+        if ((!msgMapVar.isValid()) || (!msgMapVar.canConvert<QVariantMap>())) {
             continue;
         }
 
-        assert(msgMapVar.isValid() && msgMapVar.canConvert<QVariantMap>());
-
         auto msgMap = msgMapVar.value<QVariantMap>();
+        auto msg = createMsgObjectFrom(msgMap, protocol);
+        if (!msg) {
+            continue;
+        }
+
         auto delay = DelayProp().getFrom(msgMap);
         auto delayUnits = DelayUnitsProp().getFrom(msgMap);
         auto repeatDuration = RepeatProp().getFrom(msgMap);
@@ -531,6 +518,42 @@ MsgFileMgr::MessagesList MsgFileMgr::load(
     return allMsgs;
 }
 
+MsgFileMgr::LoaderPtr MsgFileMgr::startRecvLoad(
+    const QString& filename,
+    MsgFileLoader::ProtocolCreateFunc&& func,
+    unsigned threadsCount)
+{
+    LoaderPtr loader(new MsgFileLoader());
+    if (!loader->start(filename, std::move(func), threadsCount)) {
+        return LoaderPtr();
+    }
+
+    m_lastFile = filename;
+    return loader;
+}
+
+MessagePtr MsgFileMgr::createRecvMsg(
+    const QVariantMap& entry,
+    Protocol& protocol)
+{
+    auto timestamp = TimestampProp().getFrom(entry);
+    if (timestamp == 0) {
+        // Not a receive list, skip message
+        return MessagePtr();
+    }
+
+    auto msg = createMsgObjectFrom(entry, protocol);
+    if (!msg) {
+        return msg;
+    }
+
+    auto type = static_cast<Message::Type>(TypeProp().getFrom(entry));
+
+    property::message::Timestamp().setTo(timestamp, *msg);
+    property::message::Type().setTo(type, *msg);
+    return msg;
+}
+
 bool MsgFileMgr::save(Type type, const QString& filename, const MessagesList& msgs)
 {
     QString filenameTmp(filename);
@@ -600,16 +623,8 @@ void MsgFileMgr::addToRecvSave(
     bool flush)
 {
     assert(handler);
-    auto msgMap = convertRecvMsg(msg);
-    if (!msgMap.isEmpty()) {
-        auto jsonObj = QJsonObject::fromVariantMap(msgMap);
-        QJsonDocument jsonDoc(jsonObj);
-        auto data = jsonDoc.toJson();
-        assert(!data.isEmpty());
-        if (data[data.size() - 1] == '\n') {
-            data.resize(data.size() - 1);
-        }
-
+    auto data = encodeRecvMsg(msg);
+    if (!data.isEmpty()) {
         static const char* IndicatorPropName = "first_write_performed";
         auto indicatorVar = handler->property(IndicatorPropName);
         bool firstWritePerformed = indicatorVar.isValid();
@@ -629,6 +644,23 @@ void MsgFileMgr::addToRecvSave(
     }
 }
 
+QByteArray MsgFileMgr::encodeRecvMsg(const Message& msg)
+{
+    auto msgMap = convertRecvMsg(msg);
+    if (msgMap.isEmpty()) {
+        return QByteArray();
+    }
+
+    auto jsonObj = QJsonObject::fromVariantMap(msgMap);
+    QJsonDocument jsonDoc(jsonObj);
+    auto data = jsonDoc.toJson();
+    assert(!data.isEmpty());
+    if (data[data.size() - 1] == '\n') {
+        data.resize(data.size() - 1);
+    }
+    return data;
+}
+
 void MsgFileMgr::flushRecvFile(FileSaveHandler handler)
 {
     assert(handler);
@@ -0,0 +1,68 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "comms_champion/MsgHistoryIndex.h"
+
+#include "MsgHistoryIndexImpl.h"
+
+namespace comms_champion
+{
+
+MsgHistoryIndex::MsgHistoryIndex()
+  : m_impl(new MsgHistoryIndexImpl())
+{
+}
+
+MsgHistoryIndex::~MsgHistoryIndex() noexcept = default;
+
+void MsgHistoryIndex::append(MessagePtr msg)
+{
+    m_impl->append(std::move(msg));
+}
+
+void MsgHistoryIndex::insert(std::size_t pos, MessagePtr msg)
+{
+    m_impl->insert(pos, std::move(msg));
+}
+
+void MsgHistoryIndex::erase(std::size_t pos)
+{
+    m_impl->erase(pos);
+}
+
+void MsgHistoryIndex::clear()
+{
+    m_impl->clear();
+}
+
+std::size_t MsgHistoryIndex::size() const
+{
+    return m_impl->size();
+}
+
+const MessagePtr& MsgHistoryIndex::at(std::size_t pos) const
+{
+    return m_impl->at(pos);
+}
+
+MsgHistoryIndex::PositionsList MsgHistoryIndex::select(const MsgQuery& query)
+{
+    return m_impl->select(query);
+}
+
+}  // namespace comms_champion
+
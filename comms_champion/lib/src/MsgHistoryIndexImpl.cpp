@@ -0,0 +1,276 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MsgHistoryIndexImpl.h"
+
+#include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <typeinfo>
+
+#include "comms_champion/property/message.h"
+
+namespace comms_champion
+{
+
+MsgHistoryIndexImpl::MsgHistoryIndexImpl() = default;
+MsgHistoryIndexImpl::~MsgHistoryIndexImpl() noexcept = default;
+
+void MsgHistoryIndexImpl::append(MessagePtr msg)
+{
+    assert(msg);
+    m_msgs.push_back(std::move(msg));
+}
+
+void MsgHistoryIndexImpl::insert(std::size_t pos, MessagePtr msg)
+{
+    assert(msg);
+    assert(pos <= m_msgs.size());
+    m_msgs.insert(m_msgs.begin() + static_cast<std::ptrdiff_t>(pos), std::move(msg));
+    if (pos < m_indexed) {
+        indexInsert(pos);
+    }
+}
+
+void MsgHistoryIndexImpl::erase(std::size_t pos)
+{
+    assert(pos < m_msgs.size());
+    if (pos < m_indexed) {
+        indexErase(pos);
+    }
+
+    m_msgs.erase(m_msgs.begin() + static_cast<std::ptrdiff_t>(pos));
+}
+
+void MsgHistoryIndexImpl::clear()
+{
+    m_msgs.clear();
+    invalidate();
+}
+
+const MessagePtr& MsgHistoryIndexImpl::at(std::size_t pos) const
+{
+    assert(pos < m_msgs.size());
+    return m_msgs[pos];
+}
+
+MsgHistoryIndexImpl::PositionsList MsgHistoryIndexImpl::select(const MsgQuery& query)
+{
+    auto& queryImpl = query.m_impl;
+    if ((!queryImpl) || queryImpl->isEmpty()) {
+        PositionsList result(m_msgs.size());
+        std::iota(result.begin(), result.end(), 0U);
+        return result;
+    }
+
+    indexPending();
+
+    auto& paths = queryImpl->paths();
+    std::vector<Column*> columns;
+    MsgQueryImpl::Context ctx;
+    ctx.m_fields.resize(paths.size());
+
+    PositionsList result;
+    for (auto& group : m_groups) {
+        auto idResult = queryImpl->evalForId(group.m_id, group.m_name);
+        if (idResult == MsgQueryImpl::Tristate::False) {
+            continue;
+        }
+
+        if (idResult == MsgQueryImpl::Tristate::True) {
+            result.insert(result.end(), group.m_rows.begin(), group.m_rows.end());
+            continue;
+        }
+
+        fillColumns(group, paths, columns);
+        ctx.m_id = group.m_id;
+        ctx.m_name = group.m_name;
+        for (auto row = 0U; row < group.m_rows.size(); ++row) {
+            auto pos = group.m_rows[row];
+            ctx.m_type = m_types[pos];
+            ctx.m_timestamp = m_timestamps[pos];
+            for (auto pathIdx = 0U; pathIdx < columns.size(); ++pathIdx) {
+                ctx.m_fields[pathIdx] = &(*columns[pathIdx])[row];
+            }
+
+            if (queryImpl->eval(ctx)) {
+                result.push_back(pos);
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void MsgHistoryIndexImpl::invalidate()
+{
+    m_groups.clear();
+    m_groupsMap.clear();
+    m_timestamps.clear();
+    m_types.clear();
+    m_groupIdxs.clear();
+    m_indexed = 0U;
+}
+
+void MsgHistoryIndexImpl::indexPending()
+{
+    m_timestamps.reserve(m_msgs.size());
+    m_types.reserve(m_msgs.size());
+    m_groupIdxs.reserve(m_msgs.size());
+    for (; m_indexed < m_msgs.size(); ++m_indexed) {
+        auto& msg = *m_msgs[m_indexed];
+        auto idx = groupIdx(msg);
+        m_groups[idx].m_rows.push_back(m_indexed);
+        m_timestamps.push_back(property::message::Timestamp().getFrom(msg));
+        m_types.push_back(property::message::Type().getFrom(msg));
+        m_groupIdxs.push_back(idx);
+    }
+}
+
+std::size_t MsgHistoryIndexImpl::groupIdx(const Message& msg)
+{
+    // Several message types may share the same ID, group by actual type
+    // to keep the fields layout of all the rows in the group the same.
+    std::type_index type(typeid(msg));
+    auto iter = m_groupsMap.find(type);
+    if (iter == m_groupsMap.end()) {
+        iter = m_groupsMap.insert(std::make_pair(type, m_groups.size())).first;
+        m_groups.emplace_back();
+        m_groups.back().m_id = msg.idAsString();
+        m_groups.back().m_name = msg.nameAsString();
+    }
+
+    return iter->second;
+}
+
+void MsgHistoryIndexImpl::indexInsert(std::size_t pos)
+{
+    // The message has already been inserted into m_msgs, only the
+    // positions of the following ones are shifted, the decoded values
+    // of the other messages remain valid.
+    assert(pos < m_indexed);
+    for (auto& group : m_groups) {
+        auto iter = std::lower_bound(group.m_rows.begin(), group.m_rows.end(), pos);
+        for (; iter != group.m_rows.end(); ++iter) {
+            ++(*iter);
+        }
+    }
+
+    auto& msg = *m_msgs[pos];
+    auto idx = groupIdx(msg);
+    auto offset = static_cast<std::ptrdiff_t>(pos);
+    m_timestamps.insert(m_timestamps.begin() + offset, property::message::Timestamp().getFrom(msg));
+    m_types.insert(m_types.begin() + offset, property::message::Type().getFrom(msg));
+    m_groupIdxs.insert(m_groupIdxs.begin() + offset, idx);
+    ++m_indexed;
+
+    auto& group = m_groups[idx];
+    auto rowIter = std::lower_bound(group.m_rows.begin(), group.m_rows.end(), pos);
+    auto row = static_cast<std::size_t>(std::distance(group.m_rows.begin(), rowIter));
+    group.m_rows.insert(rowIter, pos);
+
+    MsgQueryImpl::PathsList paths;
+    std::vector<Column*> columns;
+    for (auto& col : group.m_columns) {
+        if (row < col.second.m_values.size()) {
+            paths.push_back(col.second.m_path);
+            columns.push_back(&col.second.m_values);
+        }
+    }
+
+    if (paths.empty()) {
+        return;
+    }
+
+    auto values = MsgQueryImpl::extractFields(msg, paths);
+    assert(values.size() == columns.size());
+    for (auto colIdx = 0U; colIdx < columns.size(); ++colIdx) {
+        auto& col = *columns[colIdx];
+        col.insert(col.begin() + static_cast<std::ptrdiff_t>(row), std::move(values[colIdx]));
+    }
+}
+
+void MsgHistoryIndexImpl::indexErase(std::size_t pos)
+{
+    assert(pos < m_indexed);
+    auto& group = m_groups[m_groupIdxs[pos]];
+    auto rowIter = std::lower_bound(group.m_rows.begin(), group.m_rows.end(), pos);
+    assert((rowIter != group.m_rows.end()) && (*rowIter == pos));
+    auto row = static_cast<std::size_t>(std::distance(group.m_rows.begin(), rowIter));
+    group.m_rows.erase(rowIter);
+    for (auto& col : group.m_columns) {
+        auto& values = col.second.m_values;
+        if (row < values.size()) {
+            values.erase(values.begin() + static_cast<std::ptrdiff_t>(row));
+        }
+    }
+
+    for (auto& g : m_groups) {
+        auto iter = std::upper_bound(g.m_rows.begin(), g.m_rows.end(), pos);
+        for (; iter != g.m_rows.end(); ++iter) {
+            --(*iter);
+        }
+    }
+
+    auto offset = static_cast<std::ptrdiff_t>(pos);
+    m_timestamps.erase(m_timestamps.begin() + offset);
+    m_types.erase(m_types.begin() + offset);
+    m_groupIdxs.erase(m_groupIdxs.begin() + offset);
+    --m_indexed;
+}
+
+void MsgHistoryIndexImpl::fillColumns(
+    Group& group,
+    const MsgQueryImpl::PathsList& paths,
+    std::vector<Column*>& columns)
+{
+    columns.clear();
+    auto start = group.m_rows.size();
+    for (auto& path : paths) {
+        auto& colData = group.m_columns[path.join('.')];
+        if (colData.m_path.isEmpty()) {
+            colData.m_path = path;
+        }
+
+        auto& col = colData.m_values;
+        start = std::min(start, col.size());
+        columns.push_back(&col);
+    }
+
+    MsgQueryImpl::PathsList missingPaths;
+    std::vector<Column*> missingColumns;
+    for (auto row = start; row < group.m_rows.size(); ++row) {
+        missingPaths.clear();
+        missingColumns.clear();
+        for (auto pathIdx = 0U; pathIdx < columns.size(); ++pathIdx) {
+            if (columns[pathIdx]->size() == row) {
+                missingPaths.push_back(paths[pathIdx]);
+                missingColumns.push_back(columns[pathIdx]);
+            }
+        }
+
+        auto values = MsgQueryImpl::extractFields(*m_msgs[group.m_rows[row]], missingPaths);
+        assert(values.size() == missingColumns.size());
+        for (auto idx = 0U; idx < values.size(); ++idx) {
+            missingColumns[idx]->push_back(std::move(values[idx]));
+        }
+    }
+}
+
+}  // namespace comms_champion
+
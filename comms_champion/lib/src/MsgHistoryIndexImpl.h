@@ -0,0 +1,93 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <vector>
+#include <map>
+#include <typeindex>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/MsgHistoryIndex.h"
+#include "MsgQueryImpl.h"
+
+namespace comms_champion
+{
+
+class MsgHistoryIndexImpl
+{
+public:
+    typedef MsgHistoryIndex::PositionsList PositionsList;
+
+    MsgHistoryIndexImpl();
+    ~MsgHistoryIndexImpl() noexcept;
+
+    void append(MessagePtr msg);
+    void insert(std::size_t pos, MessagePtr msg);
+    void erase(std::size_t pos);
+    void clear();
+
+    std::size_t size() const
+    {
+        return m_msgs.size();
+    }
+
+    const MessagePtr& at(std::size_t pos) const;
+
+    PositionsList select(const MsgQuery& query);
+
+private:
+    typedef MsgQueryImpl::ValuesList Column;
+
+    struct ColumnData
+    {
+        QStringList m_path;
+        Column m_values;
+    };
+
+    struct Group
+    {
+        QString m_id;
+        QString m_name;
+        PositionsList m_rows;
+        std::map<QString, ColumnData> m_columns;
+    };
+
+    void invalidate();
+    void indexPending();
+    std::size_t groupIdx(const Message& msg);
+    void indexInsert(std::size_t pos);
+    void indexErase(std::size_t pos);
+    void fillColumns(Group& group, const MsgQueryImpl::PathsList& paths, std::vector<Column*>& columns);
+
+    std::vector<MessagePtr> m_msgs;
+    std::vector<Group> m_groups;
+    std::map<std::type_index, std::size_t> m_groupsMap;
+    std::vector<unsigned long long> m_timestamps;
+    std::vector<Message::Type> m_types;
+    std::vector<std::size_t> m_groupIdxs;
+    std::size_t m_indexed = 0U;
+};
+
+}  // namespace comms_champion
+
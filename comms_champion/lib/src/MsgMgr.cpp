@@ -95,11 +95,36 @@ void MsgMgr::setProtocol(ProtocolPtr protocol)
     m_impl->setProtocol(std::move(protocol));
 }
 
+void MsgMgr::setRecvWorkers(ProtocolCreateFunc&& func, unsigned count)
+{
+    m_impl->setRecvWorkers(std::move(func), count);
+}
+
 void MsgMgr::addFilter(FilterPtr filter)
 {
     m_impl->addFilter(std::move(filter));
 }
 
+void MsgMgr::setStatsEnabled(bool enabled)
+{
+    m_impl->setStatsEnabled(enabled);
+}
+
+bool MsgMgr::isStatsEnabled() const
+{
+    return m_impl->isStatsEnabled();
+}
+
+PipelineStats MsgMgr::getStats() const
+{
+    return m_impl->getStats();
+}
+
+void MsgMgr::resetStats()
+{
+    m_impl->resetStats();
+}
+
 void MsgMgr::setMsgAddedCallbackFunc(MsgAddedCallbackFunc&& func)
 {
     m_impl->setMsgAddedCallbackFunc(std::move(func));
@@ -21,11 +21,16 @@
 #include <cassert>
 #include <algorithm>
 #include <iterator>
+#include <deque>
+#include <thread>
+#include <condition_variable>
+#include <functional>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
 #include <QtCore/QVariant>
+#include <QtCore/QThread>
 CC_ENABLE_WARNINGS()
 
 #include "comms/util/ScopeGuard.h"
@@ -61,12 +66,150 @@ void updateMsgTimestamp(Message& msg, const DataInfo::Timestamp& timestamp)
 
 }  // namespace
 
+/// @details Decodes the data of the connections assigned to it using its own
+///     protocol object, so the framing state of every connection stays
+///     with single thread and the order of its messages is preserved.
+class MsgMgrImpl::RecvWorker
+{
+public:
+    RecvWorker(MsgMgrImpl& mgr, ProtocolPtr protocol)
+      : m_mgr(mgr),
+        m_protocol(std::move(protocol))
+    {
+        assert(m_protocol);
+    }
+
+    ~RecvWorker() noexcept
+    {
+        stop();
+    }
+
+    void start()
+    {
+        assert(!m_thread.joinable());
+        m_thread = std::thread(
+            [this]()
+            {
+                run();
+            });
+    }
+
+    void push(DataInfoPtr data, bool final)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_queue.push_back(Job{std::move(data), final});
+        }
+        m_dataCond.notify_one();
+    }
+
+    void stop()
+    {
+        if (!m_thread.joinable()) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_stopRequested = true;
+        }
+
+        m_dataCond.notify_one();
+        m_thread.join();
+    }
+
+    void setStatsEnabled(bool enabled)
+    {
+        std::lock_guard<std::mutex> guard(m_protocolLock);
+        m_protocol->setStatsEnabled(enabled);
+    }
+
+    void collectStats(PipelineStats& stats) const
+    {
+        std::lock_guard<std::mutex> guard(m_protocolLock);
+        m_protocol->collectStats(stats);
+    }
+
+    void resetStats()
+    {
+        std::lock_guard<std::mutex> guard(m_protocolLock);
+        m_protocol->resetStats();
+    }
+
+private:
+    struct Job
+    {
+        DataInfoPtr m_data;
+        bool m_final;
+    };
+
+    void run()
+    {
+        while (true) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> guard(m_lock);
+                m_dataCond.wait(
+                    guard,
+                    [this]() -> bool
+                    {
+                        return m_stopRequested || (!m_queue.empty());
+                    });
+
+                // The queued data is decoded before the stop
+                if (m_queue.empty()) {
+                    assert(m_stopRequested);
+                    return;
+                }
+
+                job = std::move(m_queue.front());
+                m_queue.pop_front();
+            }
+
+            assert(job.m_data);
+            RecvResult result;
+            auto decodeStart = StatsClock::now();
+            {
+                std::lock_guard<std::mutex> guard(m_protocolLock);
+                result.m_msgs = m_protocol->read(*job.m_data, job.m_final);
+            }
+
+            result.m_decodeNs =
+                static_cast<unsigned long long>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        StatsClock::now() - decodeStart).count());
+
+            for (auto& m : result.m_msgs) {
+                assert(m);
+                property::message::ConnectionId().setTo(job.m_data->m_connectionId, *m);
+                m->moveToThread(m_mgr.m_ownerThread);
+            }
+
+            result.m_dataInfo = std::move(job.m_data);
+            m_mgr.pushRecvResult(std::move(result));
+        }
+    }
+
+    MsgMgrImpl& m_mgr;
+    ProtocolPtr m_protocol;
+    mutable std::mutex m_protocolLock;
+    std::deque<Job> m_queue;
+    std::mutex m_lock;
+    std::condition_variable m_dataCond;
+    bool m_stopRequested = false;
+    std::thread m_thread;
+};
+
 MsgMgrImpl::MsgMgrImpl()
 {
     m_allMsgs.reserve(1024);
 }
 
-MsgMgrImpl::~MsgMgrImpl() noexcept = default;
+MsgMgrImpl::~MsgMgrImpl() noexcept
+{
+    // The workers report to this object, stop them first
+    m_recvWorkers.clear();
+}
 
 void MsgMgrImpl::start()
 {
@@ -76,6 +219,7 @@ void MsgMgrImpl::start()
     }
 
     if (m_socket) {
+        m_socket->applyProtocol(m_protocol);
         m_socket->start();
     }
 
@@ -83,6 +227,7 @@ void MsgMgrImpl::start()
         f->start();
     }
 
+    startRecvWorkers();
     m_running = true;
 }
 
@@ -99,8 +244,10 @@ void MsgMgrImpl::stop()
 
     if (m_socket) {
         m_socket->stop();
+        m_socket->applyProtocol(ProtocolPtr());
     }
 
+    stopRecvWorkers();
     m_running = false;
 }
 
@@ -113,6 +260,8 @@ void MsgMgrImpl::clear()
 
     m_socket.reset();
     m_protocol.reset();
+    m_protocolCreateFunc = nullptr;
+    m_recvWorkersCount = 0U;
     m_filters.clear();
 }
 
@@ -179,13 +328,21 @@ void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
                     reportMsgAdded(msgPtr);
                 });
 
-        auto dataInfoPtr = m_protocol->write(*msgPtr);
+        auto dataInfoPtr = property::message::OutData().getFrom(*msgPtr);
+        if (dataInfoPtr) {
+            // Already serialised by the sender, don't keep it with the message
+            property::message::OutData().setTo(DataInfoPtr(), *msgPtr);
+        }
+        else {
+            dataInfoPtr = m_protocol->write(*msgPtr);
+        }
+
         if (!dataInfoPtr) {
             continue;
         }
 
         QList <DataInfoPtr> data;
-        data.append(std::move(dataInfoPtr));
+        data.append(dataInfoPtr);
         for (auto& filter : m_filters) {
             if (data.isEmpty()) {
                 break;
@@ -203,6 +360,13 @@ void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
             continue;
         }
 
+        if (m_stats) {
+            ++m_stats->m_sentMsgs;
+            for (auto& d : data) {
+                m_stats->m_sentBytes += d->m_data.size();
+            }
+        }
+
         for (auto& d : data) {
             m_socket->sendData(d);
 
@@ -271,12 +435,28 @@ void MsgMgrImpl::setSocket(SocketPtr socket)
             reportSocketDisconnected();
         });
 
+    socket->setConnectionClosedReportCallback(
+        [this](DataInfo::ConnectionId id)
+        {
+            socketConnectionClosed(id);
+        });
+
     m_socket = std::move(socket);
 }
 
 void MsgMgrImpl::setProtocol(ProtocolPtr protocol)
 {
     m_protocol = std::move(protocol);
+    if (m_protocol) {
+        m_protocol->setStatsEnabled(isStatsEnabled());
+    }
+}
+
+void MsgMgrImpl::setRecvWorkers(ProtocolCreateFunc&& func, unsigned count)
+{
+    assert((!m_running) || !"The workers are created on start");
+    m_protocolCreateFunc = std::move(func);
+    m_recvWorkersCount = count;
 }
 
 void MsgMgrImpl::addFilter(FilterPtr filter)
@@ -332,14 +512,186 @@ void MsgMgrImpl::addFilter(FilterPtr filter)
     m_filters.push_back(std::move(filter));
 }
 
+void MsgMgrImpl::setStatsEnabled(bool enabled)
+{
+    if (enabled == isStatsEnabled()) {
+        return;
+    }
+
+    if (m_protocol) {
+        m_protocol->setStatsEnabled(enabled);
+    }
+
+    for (auto& w : m_recvWorkers) {
+        w->setStatsEnabled(enabled);
+    }
+
+    if (!enabled) {
+        m_stats.reset();
+        return;
+    }
+
+    m_stats.reset(new PipelineStats());
+    m_statsStart = StatsClock::now();
+}
+
+PipelineStats MsgMgrImpl::getStats() const
+{
+    if (!m_stats) {
+        return PipelineStats();
+    }
+
+    auto stats = *m_stats;
+    stats.m_durationMs =
+        static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                StatsClock::now() - m_statsStart).count());
+    stats.m_historySize = m_allMsgs.size();
+    if (m_protocol) {
+        m_protocol->collectStats(stats);
+    }
+
+    for (auto& w : m_recvWorkers) {
+        w->collectStats(stats);
+    }
+    return stats;
+}
+
+void MsgMgrImpl::resetStats()
+{
+    if (!m_stats) {
+        return;
+    }
+
+    *m_stats = PipelineStats();
+    m_statsStart = StatsClock::now();
+    if (m_protocol) {
+        m_protocol->resetStats();
+    }
+
+    for (auto& w : m_recvWorkers) {
+        w->resetStats();
+    }
+}
+
+void MsgMgrImpl::recvResultsReady()
+{
+    RecvResultsList results;
+    {
+        std::lock_guard<std::mutex> guard(m_recvResultsLock);
+        results.swap(m_recvResults);
+        m_recvResultsNotifyPending = false;
+    }
+
+    for (auto& r : results) {
+        assert(r.m_dataInfo);
+        StatsClock::time_point stageStart;
+        if (m_stats) {
+            m_stats->stage(PipelineStats::Stage::Protocol).add(r.m_decodeNs);
+            stageStart = StatsClock::now();
+        }
+
+        // The final data of the closed connection is decoded regardless
+        if (!m_recvEnabled) {
+            continue;
+        }
+
+        reportReceivedMsgs(std::move(r.m_msgs), *r.m_dataInfo);
+
+        if (m_stats) {
+            recordStage(PipelineStats::Stage::Report, stageStart);
+        }
+    }
+}
+
+void MsgMgrImpl::startRecvWorkers()
+{
+    assert(m_recvWorkers.empty());
+    if (!m_protocolCreateFunc) {
+        return;
+    }
+
+    auto count = m_recvWorkersCount;
+    if (count == 0U) {
+        auto cores = std::thread::hardware_concurrency();
+        count = 1U;
+        if (1U < cores) {
+            count = cores - 1U;
+        }
+    }
+
+    m_ownerThread = QThread::currentThread();
+    m_recvWorkers.reserve(count);
+    for (auto idx = 0U; idx < count; ++idx) {
+        auto protocol = m_protocolCreateFunc();
+        if (!protocol) {
+            break;
+        }
+
+        protocol->setStatsEnabled(isStatsEnabled());
+        m_recvWorkers.push_back(RecvWorkerPtr(new RecvWorker(*this, std::move(protocol))));
+        m_recvWorkers.back()->start();
+    }
+}
+
+void MsgMgrImpl::stopRecvWorkers()
+{
+    if (m_recvWorkers.empty()) {
+        return;
+    }
+
+    for (auto& w : m_recvWorkers) {
+        w->stop();
+    }
+    m_recvWorkers.clear();
+
+    // Report the messages decoded before the stop
+    recvResultsReady();
+}
+
+MsgMgrImpl::RecvWorker* MsgMgrImpl::recvWorkerFor(DataInfo::ConnectionId id)
+{
+    // The single connection sockets (serial, UDP, ...) report all the data
+    // with default ID, its decoding stays on the calling thread: all the data
+    // must be processed by the same protocol object anyway, while the round
+    // trip to another thread takes longer than decoding of typical chunk.
+    if (m_recvWorkers.empty() || (id == DataInfo::DefaultConnectionId)) {
+        return nullptr;
+    }
+
+    auto idx = std::hash<DataInfo::ConnectionId>()(id) % m_recvWorkers.size();
+    return m_recvWorkers[idx].get();
+}
+
+void MsgMgrImpl::pushRecvResult(RecvResult&& result)
+{
+    std::lock_guard<std::mutex> guard(m_recvResultsLock);
+    m_recvResults.push_back(std::move(result));
+    if (m_recvResultsNotifyPending) {
+        return;
+    }
+
+    m_recvResultsNotifyPending = true;
+    QMetaObject::invokeMethod(this, "recvResultsReady", Qt::QueuedConnection);
+}
+
 void MsgMgrImpl::socketDataReceived(DataInfoPtr dataInfoPtr)
 {
     if ((!m_recvEnabled) || !(m_protocol) || (!dataInfoPtr)) {
         return;
     }
 
+    // Time is measured only when the statistics are collected, so the
+    // disabled instrumentation costs single branch per stage.
+    StatsClock::time_point stageStart;
+    if (m_stats) {
+        ++m_stats->m_recvChunks;
+        m_stats->m_recvBytes += dataInfoPtr->m_data.size();
+        stageStart = StatsClock::now();
+    }
+
     QList<DataInfoPtr> data;
-    data.append(std::move(dataInfoPtr));
+    data.append(dataInfoPtr);
     for (auto filt : m_filters) {
         assert(filt);
 
@@ -355,19 +707,91 @@ void MsgMgrImpl::socketDataReceived(DataInfoPtr dataInfoPtr)
         data.swap(dataTmp);
     }
 
+    if (m_stats) {
+        recordStage(PipelineStats::Stage::Filters, stageStart);
+        m_stats->m_maxQueueDepth =
+            std::max(m_stats->m_maxQueueDepth, static_cast<std::size_t>(data.size()));
+    }
+
     if (data.isEmpty()) {
         return;
     }
 
+    // The data of the connections is decoded by the workers (if any), the
+    // results are reported back on this thread by recvResultsReady().
     MessagesList msgsList;
+    bool decodedInPlace = false;
     while (!data.isEmpty()) {
         auto nextDataPtr = data.front();
         data.pop_front();
 
+        auto* worker = recvWorkerFor(nextDataPtr->m_connectionId);
+        if (worker != nullptr) {
+            worker->push(std::move(nextDataPtr), false);
+            continue;
+        }
+
+        decodedInPlace = true;
         auto msgs = m_protocol->read(*nextDataPtr);
+        if (nextDataPtr->m_connectionId != DataInfo::DefaultConnectionId) {
+            for (auto& m : msgs) {
+                assert(m);
+                property::message::ConnectionId().setTo(nextDataPtr->m_connectionId, *m);
+            }
+        }
         msgsList.insert(msgsList.end(), msgs.begin(), msgs.end());
     }
 
+    if (!decodedInPlace) {
+        return;
+    }
+
+    if (m_stats) {
+        recordStage(PipelineStats::Stage::Protocol, stageStart);
+    }
+
+    reportReceivedMsgs(std::move(msgsList), *dataInfoPtr);
+
+    if (m_stats) {
+        recordStage(PipelineStats::Stage::Report, stageStart);
+    }
+}
+
+void MsgMgrImpl::socketConnectionClosed(DataInfo::ConnectionId id)
+{
+    if (!m_protocol) {
+        return;
+    }
+
+    auto* worker = recvWorkerFor(id);
+    if (worker != nullptr) {
+        auto dataInfoPtr = makeDataInfo();
+        dataInfoPtr->m_timestamp = DataInfo::TimestampClock::now();
+        dataInfoPtr->m_connectionId = id;
+        worker->push(std::move(dataInfoPtr), true);
+        return;
+    }
+
+    DataInfo dataInfo;
+    dataInfo.m_timestamp = DataInfo::TimestampClock::now();
+    dataInfo.m_connectionId = id;
+
+    // Flush (and release) the decoding state of the terminated connection
+    auto msgs = m_protocol->read(dataInfo, true);
+    if (!m_recvEnabled) {
+        return;
+    }
+
+    for (auto& m : msgs) {
+        assert(m);
+        property::message::ConnectionId().setTo(id, *m);
+    }
+
+    reportReceivedMsgs(std::move(msgs), dataInfo);
+}
+
+void MsgMgrImpl::reportReceivedMsgs(MessagesList&& msgsList, const DataInfo& dataInfo)
+{
     if (msgsList.empty()) {
         return;
     }
@@ -378,8 +802,8 @@ void MsgMgrImpl::socketDataReceived(DataInfoPtr dataInfoPtr)
         property::message::Type().setTo(MsgType::Received, *m);
 
         static const DataInfo::Timestamp DefaultTimestamp;
-        if (dataInfoPtr->m_timestamp != DefaultTimestamp) {
-            updateMsgTimestamp(*m, dataInfoPtr->m_timestamp);
+        if (dataInfo.m_timestamp != DefaultTimestamp) {
+            updateMsgTimestamp(*m, dataInfo.m_timestamp);
         }
         else {
             auto now = DataInfo::TimestampClock::now();
@@ -389,6 +813,10 @@ void MsgMgrImpl::socketDataReceived(DataInfoPtr dataInfoPtr)
         reportMsgAdded(m);
     }
 
+    if (m_stats) {
+        m_stats->m_recvMsgs += msgsList.size();
+    }
+
     m_allMsgs.reserve(m_allMsgs.size() + msgsList.size());
     std::move(msgsList.begin(), msgsList.end(), std::back_inserter(m_allMsgs));
 }
@@ -409,6 +837,10 @@ void MsgMgrImpl::reportMsgAdded(MessagePtr msg)
 
 void MsgMgrImpl::reportError(const QString& error)
 {
+    if (m_stats) {
+        ++m_stats->m_errors;
+    }
+
     if (m_errorReportCallback) {
         m_errorReportCallback(error);
     }
@@ -421,5 +853,14 @@ void MsgMgrImpl::reportSocketDisconnected()
     }
 }
 
+void MsgMgrImpl::recordStage(PipelineStats::Stage stage, StatsClock::time_point& since)
+{
+    assert(m_stats);
+    auto now = StatsClock::now();
+    auto diff = std::chrono::duration_cast<std::chrono::nanoseconds>(now - since);
+    m_stats->stage(stage).add(static_cast<unsigned long long>(diff.count()));
+    since = now;
+}
+
 }  // namespace comms_champion
 
@@ -19,19 +19,30 @@
 #pragma once
 
 #include <vector>
+#include <memory>
+#include <chrono>
+#include <mutex>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QObject>
+CC_ENABLE_WARNINGS()
 
 #include "comms_champion/MsgMgr.h"
 
 namespace comms_champion
 {
 
-class MsgMgrImpl
+class MsgMgrImpl : public QObject
 {
+    Q_OBJECT
 public:
     typedef MsgMgr::AllMessages AllMessages;
     typedef MsgMgr::MessagesList MessagesList;
 
     typedef MsgMgr::MsgType MsgType;
+    typedef MsgMgr::ProtocolCreateFunc ProtocolCreateFunc;
 
     MsgMgrImpl();
     ~MsgMgrImpl() noexcept;
@@ -61,8 +72,18 @@ public:
 
     void setSocket(SocketPtr socket);
     void setProtocol(ProtocolPtr protocol);
+    void setRecvWorkers(ProtocolCreateFunc&& func, unsigned count);
     void addFilter(FilterPtr filter);
 
+    void setStatsEnabled(bool enabled);
+    bool isStatsEnabled() const
+    {
+        return static_cast<bool>(m_stats);
+    }
+
+    PipelineStats getStats() const;
+    void resetStats();
+
     typedef MsgMgr::MsgAddedCallbackFunc MsgAddedCallbackFunc;
     typedef MsgMgr::ErrorReportCallbackFunc ErrorReportCallbackFunc;
     typedef MsgMgr::SocketDisconnectedReportCallbackFunc SocketDisconnectedReportCallbackFunc;
@@ -85,15 +106,40 @@ public:
         m_socketDisconnectReportCallback = std::forward<TFunc>(func);
     }
 
+private slots:
+    void recvResultsReady();
+
 private:
     typedef unsigned long long MsgNumberType;
     typedef std::vector<FilterPtr> FiltersList;
+    typedef std::chrono::steady_clock StatsClock;
+    typedef std::unique_ptr<PipelineStats> PipelineStatsPtr;
+
+    class RecvWorker;
+    typedef std::unique_ptr<RecvWorker> RecvWorkerPtr;
+    typedef std::vector<RecvWorkerPtr> RecvWorkersList;
+
+    struct RecvResult
+    {
+        MessagesList m_msgs;
+        DataInfoPtr m_dataInfo;
+        unsigned long long m_decodeNs = 0U;
+    };
+
+    typedef std::vector<RecvResult> RecvResultsList;
 
+    void startRecvWorkers();
+    void stopRecvWorkers();
+    RecvWorker* recvWorkerFor(DataInfo::ConnectionId id);
+    void pushRecvResult(RecvResult&& result);
     void socketDataReceived(DataInfoPtr dataInfoPtr);
+    void socketConnectionClosed(DataInfo::ConnectionId id);
+    void reportReceivedMsgs(MessagesList&& msgsList, const DataInfo& dataInfo);
     void updateInternalId(Message& msg);
     void reportMsgAdded(MessagePtr msg);
     void reportError(const QString& error);
     void reportSocketDisconnected();
+    void recordStage(PipelineStats::Stage stage, StatsClock::time_point& since);
 
     AllMessages m_allMsgs;
     bool m_recvEnabled = false;
@@ -103,6 +149,16 @@ private:
     FiltersList m_filters;
     MsgNumberType m_nextMsgNum = 1;
     bool m_running = false;
+    PipelineStatsPtr m_stats;
+    StatsClock::time_point m_statsStart;
+
+    ProtocolCreateFunc m_protocolCreateFunc;
+    unsigned m_recvWorkersCount = 0U;
+    QThread* m_ownerThread = nullptr;
+    std::mutex m_recvResultsLock;
+    RecvResultsList m_recvResults;
+    bool m_recvResultsNotifyPending = false;
+    RecvWorkersList m_recvWorkers;
 
     MsgAddedCallbackFunc m_msgAddedCallback;
     ErrorReportCallbackFunc m_errorReportCallback;
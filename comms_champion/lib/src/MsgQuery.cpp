@@ -0,0 +1,65 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "comms_champion/MsgQuery.h"
+
+#include "MsgQueryImpl.h"
+
+namespace comms_champion
+{
+
+MsgQuery::MsgQuery() = default;
+
+MsgQuery::MsgQuery(const MsgQuery&) = default;
+
+MsgQuery::~MsgQuery() noexcept = default;
+
+MsgQuery& MsgQuery::operator=(const MsgQuery&) = default;
+
+bool MsgQuery::parse(const QString& expr)
+{
+    m_error.clear();
+    auto impl = MsgQueryImpl::parse(expr, m_error);
+    if (!impl) {
+        return false;
+    }
+
+    m_impl = std::move(impl);
+    return true;
+}
+
+const QString& MsgQuery::errorString() const
+{
+    return m_error;
+}
+
+bool MsgQuery::isEmpty() const
+{
+    return (!m_impl) || m_impl->isEmpty();
+}
+
+bool MsgQuery::matches(Message& msg) const
+{
+    if (!m_impl) {
+        return true;
+    }
+
+    return m_impl->matches(msg);
+}
+
+}  // namespace comms_champion
+
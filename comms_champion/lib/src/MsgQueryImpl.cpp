@@ -0,0 +1,838 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MsgQueryImpl.h"
+
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QObject>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/MessageHandler.h"
+#include "comms_champion/field_wrapper/FieldWrapperHandler.h"
+#include "comms_champion/property/message.h"
+#include "comms_champion/property/field.h"
+
+namespace comms_champion
+{
+
+namespace
+{
+
+typedef MsgQueryImpl::Value Value;
+typedef MsgQueryImpl::PathsList PathsList;
+typedef MsgQueryImpl::Op Op;
+
+const QString IdKeyword("id");
+const QString TimeKeyword("time");
+const QString DirKeyword("dir");
+
+template <typename T>
+bool applyOp(Op op, const T& left, const T& right)
+{
+    switch (op) {
+    case Op::Eq: return left == right;
+    case Op::Ne: return left != right;
+    case Op::Lt: return left < right;
+    case Op::Le: return left <= right;
+    case Op::Gt: return left > right;
+    case Op::Ge: return left >= right;
+    default:
+        break;
+    }
+
+    assert(!"Unexpected operation");
+    return false;
+}
+
+bool compareValues(const Value& left, Op op, const Value& right)
+{
+    if (!left.m_valid) {
+        return false;
+    }
+
+    if (left.m_numeric && right.m_numeric) {
+        return applyOp(op, left.m_num, right.m_num);
+    }
+
+    if (left.m_numeric && left.m_str.isEmpty()) {
+        return false;
+    }
+
+    return applyOp(op, QString::compare(left.m_str, right.m_str), 0);
+}
+
+Value numericValue(long double val)
+{
+    Value result;
+    result.m_valid = true;
+    result.m_numeric = true;
+    result.m_num = val;
+    return result;
+}
+
+Value stringValue(const QString& str)
+{
+    Value result;
+    result.m_valid = true;
+    result.m_str = str;
+    return result;
+}
+
+class FieldResolver : public field_wrapper::FieldWrapperHandler
+{
+public:
+    FieldResolver(const QStringList& path, int pos, const FieldDescriptor& desc)
+      : m_path(path),
+        m_pos(pos),
+        m_desc(desc)
+    {
+    }
+
+    const Value& value() const
+    {
+        return m_value;
+    }
+
+    virtual void handle(field_wrapper::IntValueWrapper& wrapper) override
+    {
+        if (isLeaf()) {
+            m_value = scaledValue(wrapper.getValue());
+        }
+    }
+
+    virtual void handle(field_wrapper::UnsignedLongValueWrapper& wrapper) override
+    {
+        if (isLeaf()) {
+            m_value = scaledValue(wrapper.getValue());
+        }
+    }
+
+    virtual void handle(field_wrapper::BitmaskValueWrapper& wrapper) override
+    {
+        if (isLeaf()) {
+            m_value = numericValue(wrapper.getValue());
+        }
+    }
+
+    virtual void handle(field_wrapper::EnumValueWrapper& wrapper) override
+    {
+        if (!isLeaf()) {
+            return;
+        }
+
+        auto val = wrapper.getValue();
+        m_value = numericValue(val);
+        auto& elems = m_desc.enumValues();
+        auto iter =
+            std::find_if(
+                elems.begin(), elems.end(),
+                [val](const property::field::EnumValue::ElemType& elem) -> bool
+                {
+                    return elem.second == val;
+                });
+
+        if (iter != elems.end()) {
+            m_value.m_str = iter->first;
+        }
+    }
+
+    virtual void handle(field_wrapper::StringWrapper& wrapper) override
+    {
+        if (isLeaf()) {
+            m_value = stringValue(wrapper.getValue());
+        }
+    }
+
+    virtual void handle(field_wrapper::BitfieldWrapper& wrapper) override
+    {
+        if (!isLeaf()) {
+            descend(wrapper.getMembers());
+        }
+    }
+
+    virtual void handle(field_wrapper::OptionalWrapper& wrapper) override
+    {
+        if ((wrapper.getMode() != field_wrapper::OptionalWrapper::Mode::Exists) ||
+            (!wrapper.hasFieldWrapper())) {
+            return;
+        }
+
+        FieldResolver resolver(m_path, m_pos, m_desc.member(0));
+        wrapper.getFieldWrapper().dispatch(resolver);
+        m_value = resolver.value();
+    }
+
+    virtual void handle(field_wrapper::BundleWrapper& wrapper) override
+    {
+        if (!isLeaf()) {
+            descend(wrapper.getMembers());
+        }
+    }
+
+    virtual void handle(field_wrapper::ArrayListRawDataWrapper& wrapper) override
+    {
+        if (isLeaf()) {
+            m_value = stringValue(wrapper.getValue());
+        }
+    }
+
+    virtual void handle(field_wrapper::ArrayListWrapper& wrapper) override
+    {
+        if (isLeaf()) {
+            m_value = numericValue(wrapper.size());
+        }
+    }
+
+    virtual void handle(field_wrapper::FloatValueWrapper& wrapper) override
+    {
+        if (isLeaf()) {
+            m_value = numericValue(wrapper.getValue());
+        }
+    }
+
+    virtual void handle(field_wrapper::VariantWrapper& wrapper) override
+    {
+        auto& current = wrapper.getCurrent();
+        if (!current) {
+            return;
+        }
+
+        auto idx = wrapper.getCurrentIndex();
+        auto& memDesc =
+            (0 <= idx) ? m_desc.member(static_cast<std::size_t>(idx)) : FieldDescriptor::empty();
+
+        FieldResolver resolver(m_path, m_pos, memDesc);
+        current->dispatch(resolver);
+        m_value = resolver.value();
+    }
+
+    virtual void handle(field_wrapper::UnknownValueWrapper& wrapper) override
+    {
+        if (isLeaf()) {
+            m_value = stringValue(wrapper.getSerialisedString());
+        }
+    }
+
+    using field_wrapper::FieldWrapperHandler::handle;
+
+private:
+    bool isLeaf() const
+    {
+        return m_path.size() <= m_pos;
+    }
+
+    Value scaledValue(long double val) const
+    {
+        val += m_desc.displayOffset();
+        if (m_desc.hasScaledDecimals()) {
+            val /= std::pow(10.0L, m_desc.decimals());
+        }
+        return numericValue(val);
+    }
+
+    template <typename TMembers>
+    void descend(TMembers& members)
+    {
+        auto& name = m_path[m_pos];
+        auto count = std::min(members.size(), m_desc.members().size());
+        for (auto idx = 0U; idx < count; ++idx) {
+            auto& memDesc = m_desc.member(idx);
+            if (memDesc.name().compare(name, Qt::CaseInsensitive) != 0) {
+                continue;
+            }
+
+            FieldResolver resolver(m_path, m_pos + 1, memDesc);
+            members[idx]->dispatch(resolver);
+            m_value = resolver.value();
+            return;
+        }
+    }
+
+    const QStringList& m_path;
+    int m_pos = 0;
+    const FieldDescriptor& m_desc;
+    Value m_value;
+};
+
+class FieldsExtractor : public MessageHandler
+{
+public:
+    FieldsExtractor(const PathsList& paths)
+      : m_paths(paths),
+        m_values(paths.size())
+    {
+    }
+
+    MsgQueryImpl::ValuesList takeValues()
+    {
+        return std::move(m_values);
+    }
+
+protected:
+    virtual void beginMsgHandlingImpl(Message& msg) override
+    {
+        m_fieldsDescs = &msg.fieldsDescriptors();
+        m_fieldIdx = 0;
+    }
+
+    virtual void addFieldImpl(FieldWrapperPtr wrapper) override
+    {
+        assert(m_fieldsDescs != nullptr);
+        auto idx = m_fieldIdx;
+        ++m_fieldIdx;
+        if (m_fieldsDescs->size() <= idx) {
+            return;
+        }
+
+        auto& desc = *(*m_fieldsDescs)[idx];
+        auto& name = desc.name();
+        for (auto pathIdx = 0U; pathIdx < m_paths.size(); ++pathIdx) {
+            auto& path = m_paths[pathIdx];
+            assert(!path.isEmpty());
+            if ((m_values[pathIdx].m_valid) ||
+                (name.compare(path.front(), Qt::CaseInsensitive) != 0)) {
+                continue;
+            }
+
+            FieldResolver resolver(path, 1, desc);
+            wrapper->dispatch(resolver);
+            m_values[pathIdx] = resolver.value();
+        }
+    }
+
+private:
+    const PathsList& m_paths;
+    MsgQueryImpl::ValuesList m_values;
+    const FieldDescriptor::List* m_fieldsDescs = nullptr;
+    std::size_t m_fieldIdx = 0U;
+};
+
+}  // namespace
+
+class MsgQueryImpl::Parser
+{
+public:
+    Parser(const QString& expr, PathsList& paths)
+      : m_expr(expr),
+        m_paths(paths)
+    {
+    }
+
+    std::unique_ptr<Node> parse(QString& error)
+    {
+        nextToken();
+        auto node = parseOr();
+        if (node && (m_token != Token::End)) {
+            setError(QObject::tr("Unexpected \"%1\"").arg(m_tokenText));
+            node.reset();
+        }
+
+        if (!node) {
+            error = m_error;
+        }
+        return node;
+    }
+
+private:
+    enum class Token
+    {
+        End,
+        Word,
+        Number,
+        Quoted,
+        Cmp,
+        And,
+        Or,
+        Not,
+        LParen,
+        RParen,
+        Invalid
+    };
+
+    void setError(const QString& msg)
+    {
+        if (m_error.isEmpty()) {
+            m_error = QObject::tr("%1 at position %2").arg(msg).arg(m_tokenPos + 1);
+        }
+    }
+
+    void nextToken()
+    {
+        while ((m_pos < m_expr.size()) && (m_expr[m_pos].isSpace())) {
+            ++m_pos;
+        }
+
+        m_tokenPos = m_pos;
+        m_tokenText.clear();
+        if (m_expr.size() <= m_pos) {
+            m_token = Token::End;
+            return;
+        }
+
+        auto ch = m_expr[m_pos];
+        auto nextCh = QChar();
+        if ((m_pos + 1) < m_expr.size()) {
+            nextCh = m_expr[m_pos + 1];
+        }
+
+        auto takeChars =
+            [this](int count, Token token)
+            {
+                m_tokenText = m_expr.mid(m_pos, count);
+                m_pos += count;
+                m_token = token;
+            };
+
+        if ((ch == '&') && (nextCh == '&')) {
+            takeChars(2, Token::And);
+            return;
+        }
+
+        if ((ch == '|') && (nextCh == '|')) {
+            takeChars(2, Token::Or);
+            return;
+        }
+
+        if ((ch == '!') && (nextCh == '=')) {
+            takeChars(2, Token::Cmp);
+            m_op = Op::Ne;
+            return;
+        }
+
+        if (ch == '!') {
+            takeChars(1, Token::Not);
+            return;
+        }
+
+        if (ch == '(') {
+            takeChars(1, Token::LParen);
+            return;
+        }
+
+        if (ch == ')') {
+            takeChars(1, Token::RParen);
+            return;
+        }
+
+        if ((ch == '=') || (ch == '<') || (ch == '>')) {
+            auto withEq = (nextCh == '=');
+            if (ch == '=') {
+                m_op = Op::Eq;
+            }
+            else if (ch == '<') {
+                m_op = withEq ? Op::Le : Op::Lt;
+            }
+            else {
+                m_op = withEq ? Op::Ge : Op::Gt;
+            }
+            takeChars(withEq ? 2 : 1, Token::Cmp);
+            return;
+        }
+
+        if ((ch == '"') || (ch == '\'')) {
+            auto endPos = m_expr.indexOf(ch, m_pos + 1);
+            if (endPos < 0) {
+                m_token = Token::Invalid;
+                setError(QObject::tr("Unterminated string"));
+                return;
+            }
+
+            m_tokenText = m_expr.mid(m_pos + 1, endPos - (m_pos + 1));
+            m_pos = endPos + 1;
+            m_token = Token::Quoted;
+            return;
+        }
+
+        auto isNumberStart =
+            ch.isDigit() ||
+            (((ch == '-') || (ch == '+') || (ch == '.')) && nextCh.isDigit());
+
+        auto isWordChar =
+            [isNumberStart](QChar c) -> bool
+            {
+                return c.isLetterOrNumber() || (c == '_') || (c == '.') ||
+                       (isNumberStart && ((c == '-') || (c == '+')));
+            };
+
+        if ((!isNumberStart) && (!ch.isLetter()) && (ch != '_')) {
+            m_token = Token::Invalid;
+            setError(QObject::tr("Unexpected character \"%1\"").arg(ch));
+            return;
+        }
+
+        auto endPos = m_pos + 1;
+        while ((endPos < m_expr.size()) && isWordChar(m_expr[endPos])) {
+            ++endPos;
+        }
+
+        m_tokenText = m_expr.mid(m_pos, endPos - m_pos);
+        m_pos = endPos;
+        m_token = isNumberStart ? Token::Number : Token::Word;
+    }
+
+    std::unique_ptr<Node> makeBinary(Node::Kind kind, std::unique_ptr<Node> left, std::unique_ptr<Node> right)
+    {
+        std::unique_ptr<Node> node(new Node);
+        node->m_kind = kind;
+        node->m_left = std::move(left);
+        node->m_right = std::move(right);
+        return node;
+    }
+
+    std::unique_ptr<Node> parseOr()
+    {
+        auto node = parseAnd();
+        while (node && (m_token == Token::Or)) {
+            nextToken();
+            auto right = parseAnd();
+            if (!right) {
+                return right;
+            }
+            node = makeBinary(Node::Kind::Or, std::move(node), std::move(right));
+        }
+        return node;
+    }
+
+    std::unique_ptr<Node> parseAnd()
+    {
+        auto node = parseUnary();
+        while (node && (m_token == Token::And)) {
+            nextToken();
+            auto right = parseUnary();
+            if (!right) {
+                return right;
+            }
+            node = makeBinary(Node::Kind::And, std::move(node), std::move(right));
+        }
+        return node;
+    }
+
+    std::unique_ptr<Node> parseUnary()
+    {
+        if (m_token == Token::Not) {
+            nextToken();
+            auto operand = parseUnary();
+            if (!operand) {
+                return operand;
+            }
+
+            std::unique_ptr<Node> node(new Node);
+            node->m_kind = Node::Kind::Not;
+            node->m_left = std::move(operand);
+            return node;
+        }
+
+        if (m_token == Token::LParen) {
+            nextToken();
+            auto node = parseOr();
+            if (!node) {
+                return node;
+            }
+
+            if (m_token != Token::RParen) {
+                setError(QObject::tr("Missing \")\""));
+                return std::unique_ptr<Node>();
+            }
+            nextToken();
+            return node;
+        }
+
+        return parseComparison();
+    }
+
+    std::unique_ptr<Node> parseComparison()
+    {
+        if ((m_token != Token::Word) && (m_token != Token::Quoted)) {
+            setError(QObject::tr("Expected field name"));
+            return std::unique_ptr<Node>();
+        }
+
+        std::unique_ptr<Node> node(new Node);
+        node->m_kind = Node::Kind::Cmp;
+        auto lhs = m_tokenText.toLower();
+        if ((m_token == Token::Word) && (lhs == IdKeyword)) {
+            node->m_subject = Subject::Id;
+        }
+        else if ((m_token == Token::Word) && (lhs == TimeKeyword)) {
+            node->m_subject = Subject::Time;
+        }
+        else if ((m_token == Token::Word) && (lhs == DirKeyword)) {
+            node->m_subject = Subject::Dir;
+        }
+        else {
+            auto path = lhs.split('.');
+            if (std::any_of(path.begin(), path.end(), [](const QString& s) { return s.isEmpty(); })) {
+                setError(QObject::tr("Invalid field name \"%1\"").arg(m_tokenText));
+                return std::unique_ptr<Node>();
+            }
+
+            node->m_subject = Subject::Field;
+            auto iter = std::find(m_paths.begin(), m_paths.end(), path);
+            node->m_pathIdx = static_cast<std::size_t>(std::distance(m_paths.begin(), iter));
+            if (iter == m_paths.end()) {
+                m_paths.push_back(std::move(path));
+            }
+        }
+
+        nextToken();
+        if (m_token != Token::Cmp) {
+            setError(QObject::tr("Expected comparison operator"));
+            return std::unique_ptr<Node>();
+        }
+
+        node->m_op = m_op;
+        if (((node->m_subject == Subject::Id) || (node->m_subject == Subject::Dir)) &&
+            (node->m_op != Op::Eq) && (node->m_op != Op::Ne)) {
+            setError(QObject::tr("Only \"==\" and \"!=\" are supported for \"%1\"").arg(lhs));
+            return std::unique_ptr<Node>();
+        }
+
+        nextToken();
+        if ((m_token != Token::Word) && (m_token != Token::Number) && (m_token != Token::Quoted)) {
+            setError(QObject::tr("Expected value"));
+            return std::unique_ptr<Node>();
+        }
+
+        auto& rhs = node->m_rhs;
+        rhs = stringValue(m_tokenText);
+        if (m_token == Token::Number) {
+            bool ok = false;
+            auto base = m_tokenText.contains("0x", Qt::CaseInsensitive) ? 16 : 10;
+            auto intVal = m_tokenText.toLongLong(&ok, base);
+            if (ok) {
+                rhs.m_num = intVal;
+            }
+            else {
+                rhs.m_num = m_tokenText.toDouble(&ok);
+            }
+
+            if (!ok) {
+                setError(QObject::tr("Invalid number \"%1\"").arg(m_tokenText));
+                return std::unique_ptr<Node>();
+            }
+            rhs.m_numeric = true;
+        }
+
+        if ((node->m_subject == Subject::Time) && (!rhs.m_numeric)) {
+            setError(QObject::tr("Timestamp must be a number"));
+            return std::unique_ptr<Node>();
+        }
+
+        if (node->m_subject == Subject::Dir) {
+            auto dir = rhs.m_str.toLower();
+            if ((dir == "recv") || (dir == "received")) {
+                node->m_dir = Message::Type::Received;
+            }
+            else if ((dir == "sent") || (dir == "send")) {
+                node->m_dir = Message::Type::Sent;
+            }
+            else {
+                setError(QObject::tr("Direction must be \"recv\" or \"sent\""));
+                return std::unique_ptr<Node>();
+            }
+        }
+
+        nextToken();
+        return node;
+    }
+
+    const QString& m_expr;
+    PathsList& m_paths;
+    int m_pos = 0;
+    int m_tokenPos = 0;
+    Token m_token = Token::End;
+    QString m_tokenText;
+    Op m_op = Op::Eq;
+    QString m_error;
+};
+
+std::shared_ptr<MsgQueryImpl> MsgQueryImpl::parse(const QString& expr, QString& error)
+{
+    std::shared_ptr<MsgQueryImpl> query(new MsgQueryImpl);
+    if (expr.trimmed().isEmpty()) {
+        return query;
+    }
+
+    Parser parser(expr, query->m_paths);
+    query->m_root = parser.parse(error);
+    if (!query->m_root) {
+        query.reset();
+    }
+    return query;
+}
+
+bool MsgQueryImpl::matches(Message& msg) const
+{
+    if (!m_root) {
+        return true;
+    }
+
+    auto values = extractFields(msg, m_paths);
+    Context ctx;
+    ctx.m_id = msg.idAsString();
+    ctx.m_name = msg.nameAsString();
+    ctx.m_type = property::message::Type().getFrom(msg);
+    ctx.m_timestamp = property::message::Timestamp().getFrom(msg);
+    ctx.m_fields.reserve(values.size());
+    for (auto& val : values) {
+        ctx.m_fields.push_back(&val);
+    }
+    return evalNode(*m_root, ctx);
+}
+
+bool MsgQueryImpl::eval(const Context& ctx) const
+{
+    if (!m_root) {
+        return true;
+    }
+
+    return evalNode(*m_root, ctx);
+}
+
+MsgQueryImpl::Tristate MsgQueryImpl::evalForId(
+    const QString& id,
+    const QString& name) const
+{
+    if (!m_root) {
+        return Tristate::True;
+    }
+
+    return evalNodeForId(*m_root, id, name);
+}
+
+MsgQueryImpl::ValuesList MsgQueryImpl::extractFields(
+    Message& msg,
+    const PathsList& paths)
+{
+    if (paths.empty()) {
+        return ValuesList();
+    }
+
+    FieldsExtractor extractor(paths);
+    msg.dispatch(extractor);
+    return extractor.takeValues();
+}
+
+bool MsgQueryImpl::evalNode(const Node& node, const Context& ctx)
+{
+    switch (node.m_kind) {
+    case Node::Kind::And:
+        return evalNode(*node.m_left, ctx) && evalNode(*node.m_right, ctx);
+    case Node::Kind::Or:
+        return evalNode(*node.m_left, ctx) || evalNode(*node.m_right, ctx);
+    case Node::Kind::Not:
+        return !evalNode(*node.m_left, ctx);
+    default:
+        break;
+    }
+
+    assert(node.m_kind == Node::Kind::Cmp);
+    switch (node.m_subject) {
+    case Subject::Id:
+        return compareId(node, ctx.m_id, ctx.m_name);
+    case Subject::Time:
+        return compareValues(numericValue(ctx.m_timestamp), node.m_op, node.m_rhs);
+    case Subject::Dir:
+        return applyOp(node.m_op, ctx.m_type, node.m_dir);
+    default:
+        break;
+    }
+
+    assert(node.m_pathIdx < ctx.m_fields.size());
+    auto* val = ctx.m_fields[node.m_pathIdx];
+    if (val == nullptr) {
+        return false;
+    }
+    return compareValues(*val, node.m_op, node.m_rhs);
+}
+
+MsgQueryImpl::Tristate MsgQueryImpl::evalNodeForId(
+    const Node& node,
+    const QString& id,
+    const QString& name)
+{
+    switch (node.m_kind) {
+    case Node::Kind::And: {
+        auto left = evalNodeForId(*node.m_left, id, name);
+        auto right = evalNodeForId(*node.m_right, id, name);
+        if ((left == Tristate::False) || (right == Tristate::False)) {
+            return Tristate::False;
+        }
+
+        if ((left == Tristate::True) && (right == Tristate::True)) {
+            return Tristate::True;
+        }
+        return Tristate::Unknown;
+    }
+    case Node::Kind::Or: {
+        auto left = evalNodeForId(*node.m_left, id, name);
+        auto right = evalNodeForId(*node.m_right, id, name);
+        if ((left == Tristate::True) || (right == Tristate::True)) {
+            return Tristate::True;
+        }
+
+        if ((left == Tristate::False) && (right == Tristate::False)) {
+            return Tristate::False;
+        }
+        return Tristate::Unknown;
+    }
+    case Node::Kind::Not: {
+        auto operand = evalNodeForId(*node.m_left, id, name);
+        if (operand == Tristate::Unknown) {
+            return operand;
+        }
+        return (operand == Tristate::True) ? Tristate::False : Tristate::True;
+    }
+    default:
+        break;
+    }
+
+    if (node.m_subject != Subject::Id) {
+        return Tristate::Unknown;
+    }
+
+    return compareId(node, id, name) ? Tristate::True : Tristate::False;
+}
+
+bool MsgQueryImpl::compareId(
+    const Node& node,
+    const QString& id,
+    const QString& name)
+{
+    bool equal = false;
+    if (node.m_rhs.m_numeric) {
+        bool ok = false;
+        long double idNum = id.toLongLong(&ok, 10);
+        equal = ok && (idNum == node.m_rhs.m_num);
+    }
+    else {
+        equal =
+            (id == node.m_rhs.m_str) ||
+            (name.compare(node.m_rhs.m_str, Qt::CaseInsensitive) == 0);
+    }
+
+    return (node.m_op == Op::Eq) ? equal : (!equal);
+}
+
+}  // namespace comms_champion
+
@@ -0,0 +1,141 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Message.h"
+
+namespace comms_champion
+{
+
+class MsgQueryImpl
+{
+public:
+    struct Value
+    {
+        bool m_valid = false;
+        bool m_numeric = false;
+        long double m_num = 0;
+        QString m_str;
+    };
+
+    typedef std::vector<Value> ValuesList;
+    typedef std::vector<QStringList> PathsList;
+
+    enum class Subject
+    {
+        Id,
+        Time,
+        Dir,
+        Field
+    };
+
+    enum class Op
+    {
+        Eq,
+        Ne,
+        Lt,
+        Le,
+        Gt,
+        Ge
+    };
+
+    struct Node
+    {
+        enum class Kind
+        {
+            And,
+            Or,
+            Not,
+            Cmp
+        };
+
+        Kind m_kind = Kind::Cmp;
+        std::unique_ptr<Node> m_left;
+        std::unique_ptr<Node> m_right;
+        Subject m_subject = Subject::Field;
+        std::size_t m_pathIdx = 0U;
+        Op m_op = Op::Eq;
+        Value m_rhs;
+        Message::Type m_dir = Message::Type::Invalid;
+    };
+
+    /// @brief Properties of the single evaluated message.
+    /// @details Values of the fields are referenced by the index of their
+    ///     path in the @ref paths() list.
+    struct Context
+    {
+        QString m_id;
+        QString m_name;
+        Message::Type m_type = Message::Type::Invalid;
+        unsigned long long m_timestamp = 0U;
+        std::vector<const Value*> m_fields;
+    };
+
+    enum class Tristate
+    {
+        False,
+        True,
+        Unknown
+    };
+
+    static std::shared_ptr<MsgQueryImpl> parse(const QString& expr, QString& error);
+
+    /// @brief Lower case names of the referenced fields, members of bundles
+    ///     and bitfields are separate elements of the path.
+    const PathsList& paths() const
+    {
+        return m_paths;
+    }
+
+    bool isEmpty() const
+    {
+        return !m_root;
+    }
+
+    bool matches(Message& msg) const;
+
+    bool eval(const Context& ctx) const;
+
+    /// @brief Evaluate the query knowing only id and name of the message.
+    Tristate evalForId(const QString& id, const QString& name) const;
+
+    static ValuesList extractFields(Message& msg, const PathsList& paths);
+
+private:
+    class Parser;
+
+    static bool evalNode(const Node& node, const Context& ctx);
+    static Tristate evalNodeForId(const Node& node, const QString& id, const QString& name);
+    static bool compareId(const Node& node, const QString& id, const QString& name);
+
+    std::unique_ptr<Node> m_root;
+    PathsList m_paths;
+};
+
+}  // namespace comms_champion
+
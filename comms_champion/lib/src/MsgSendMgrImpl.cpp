@@ -18,33 +18,55 @@
 #include "MsgSendMgrImpl.h"
 
 #include <cassert>
+#include <algorithm>
 
 #include "comms_champion/property/message.h"
 
 namespace comms_champion
 {
 
-MsgSendMgrImpl::MsgSendMgrImpl()
-  : m_timer(this)
+namespace
 {
-    connect(
-        &m_timer, SIGNAL(timeout()),
-        this, SLOT(sendPendingAndWait()));
-}
 
-MsgSendMgrImpl::~MsgSendMgrImpl() noexcept = default;
+struct ScheduledMsgComp
+{
+    template <typename T>
+    bool operator()(const T& first, const T& second) const
+    {
+        // Heap keeps the earliest (and the first inserted) on top
+        if (first.m_due != second.m_due) {
+            return second.m_due < first.m_due;
+        }
+        return second.m_seq < first.m_seq;
+    }
+};
+
+}  // namespace
+
+MsgSendMgrImpl::MsgSendMgrImpl() = default;
+
+MsgSendMgrImpl::~MsgSendMgrImpl() noexcept
+{
+    stopScheduler();
+}
 
 void MsgSendMgrImpl::start(ProtocolPtr protocol, const MessagesList& msgs)
 {
-    assert(m_msgsToSend.empty() || !"The previous sending must be stopped first.");
+    // The scheduler of the previous (completed) sending may still be running
+    stopScheduler();
+    assert(m_queue.empty() || !"The previous sending must be stopped first.");
     m_protocol = std::move(protocol);
+    m_msgs.clear();
+    m_msgs.reserve(msgs.size());
+    m_queue.reserve(msgs.size());
+    m_ready.clear();
+    m_stopRequested = false;
+    m_complete = false;
+
+    // Delays are relative to the previous message in the list
+    auto due = Clock::now();
     for (auto& m : msgs) {
         auto clonedMsg = m_protocol->cloneMessage(*m);
-        property::message::Delay().copyFromTo(*m, *clonedMsg);
-        property::message::DelayUnits().copyFromTo(*m, *clonedMsg);
-        property::message::RepeatDuration().copyFromTo(*m, *clonedMsg);
-        property::message::RepeatDurationUnits().copyFromTo(*m, *clonedMsg);
-        property::message::RepeatCount().copyFromTo(*m, *clonedMsg);
         auto extraProps = property::message::ExtraInfo().getFrom(*m);
         if (!extraProps.isEmpty()) {
             property::message::ExtraInfo().setTo(std::move(extraProps), *clonedMsg);
@@ -52,105 +74,183 @@ void MsgSendMgrImpl::start(ProtocolPtr protocol, const MessagesList& msgs)
             assert(!property::message::ExtraInfo().getFrom(*clonedMsg).isEmpty());
         }
 
-        m_msgsToSend.push_back(std::move(clonedMsg));
+        due += std::chrono::milliseconds(property::message::Delay().getFrom(*m));
+
+        ScheduledMsg sched;
+        sched.m_due = due;
+        sched.m_idx = m_msgs.size();
+        sched.m_period =
+            std::chrono::milliseconds(property::message::RepeatDuration().getFrom(*m));
+        sched.m_remCount = property::message::RepeatCount().getFrom(*m);
+
+        // Serialise once, the same data is reused for all the repetitions
+        MsgInfo info;
+        auto dataInfoPtr = m_protocol->write(*clonedMsg);
+        if (dataInfoPtr) {
+            info.m_data = std::move(dataInfoPtr->m_data);
+        }
+
+        info.m_msg = std::move(clonedMsg);
+        m_msgs.push_back(std::move(info));
+        schedule(std::move(sched));
     }
-    sendPendingAndWait();
+
+    m_scheduler = std::thread(
+        [this]()
+        {
+            schedulerLoop();
+        });
 }
 
 void MsgSendMgrImpl::stop()
 {
-    m_timer.stop();
+    stopScheduler();
     m_protocol.reset();
-    m_msgsToSend.clear();
+    m_msgs.clear();
+    m_queue.clear();
+    m_ready.clear();
+    m_complete = false;
+}
+
+void MsgSendMgrImpl::sendReady()
+{
+    BatchesList ready;
+    bool complete = false;
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        ready.swap(m_ready);
+        complete = m_complete;
+        m_complete = false;
+        m_notifyPending = false;
+    }
+
+    for (auto& batch : ready) {
+        if (!m_protocol) {
+            // Stopped by the callback
+            return;
+        }
+
+        MessagesList msgsToSend;
+        for (auto& dueMsg : batch) {
+            assert(dueMsg.m_idx < m_msgs.size());
+            auto msg = prepareMsg(m_msgs[dueMsg.m_idx], dueMsg.m_copy);
+            if (msg) {
+                msgsToSend.push_back(std::move(msg));
+            }
+        }
+
+        // All the messages due at the same tick are reported in a single batch
+        if ((!msgsToSend.empty()) && m_sendCallback) {
+            m_sendCallback(std::move(msgsToSend));
+        }
+    }
+
+    if (complete && m_sendCompleteCallback) {
+        m_sendCompleteCallback();
+    }
+}
+
+void MsgSendMgrImpl::schedule(ScheduledMsg&& sched)
+{
+    sched.m_seq = m_nextSeq;
+    ++m_nextSeq;
+    m_queue.push_back(std::move(sched));
+    std::push_heap(m_queue.begin(), m_queue.end(), ScheduledMsgComp());
 }
 
-void MsgSendMgrImpl::sendPendingAndWait()
+MessagePtr MsgSendMgrImpl::prepareMsg(const MsgInfo& info, bool copy)
 {
-    m_timer.stop();
-    auto iter = m_msgsToSend.begin();
-    for (; iter != m_msgsToSend.end(); ++iter) {
-        auto& msg = *iter;
-        assert(msg);
-        auto delay = property::message::Delay().getFrom(*msg);
-        if (delay != 0U) {
-            break;
+    MessagePtr msg = info.m_msg;
+    if (copy) {
+        msg = m_protocol->copyMessage(*info.m_msg);
+        if (!msg) {
+            assert(!"Message copy failed");
+            return msg;
         }
     }
 
-    decltype(m_msgsToSend) nextMsgsToSend;
-    nextMsgsToSend.splice(
-        nextMsgsToSend.end(), m_msgsToSend, m_msgsToSend.begin(), iter);
+    if (!info.m_data.empty()) {
+        auto dataInfoPtr = makeDataInfo();
+        dataInfoPtr->m_data = info.m_data;
+        property::message::OutData().setTo(std::move(dataInfoPtr), *msg);
+    }
+    return msg;
+}
 
-    for (auto& msgToSend : nextMsgsToSend) {
-        auto repeatMs = property::message::RepeatDuration().getFrom(*msgToSend);
-        auto repeatCount = property::message::RepeatCount().getFrom(*msgToSend);
+void MsgSendMgrImpl::schedulerLoop()
+{
+    std::unique_lock<std::mutex> guard(m_lock);
+    while (!m_stopRequested) {
+        if (m_queue.empty()) {
+            m_complete = true;
+            notifyOwner();
+            return;
+        }
 
-        bool reinsert =
-            (0U < repeatMs) &&
-            ((repeatCount == 0U) || (1U < repeatCount));
+        auto now = Clock::now();
+        if (now < m_queue.front().m_due) {
+            m_cond.wait_until(guard, m_queue.front().m_due);
+            continue;
+        }
 
-        if (reinsert) {
-            if (!m_protocol) {
-                assert(!"Expecting protocol to be valid");
-                continue;
-            }
+        Batch batch;
+        while ((!m_queue.empty()) && (m_queue.front().m_due <= now)) {
+            std::pop_heap(m_queue.begin(), m_queue.end(), ScheduledMsgComp());
+            auto sched = std::move(m_queue.back());
+            m_queue.pop_back();
 
-            auto newDelay = repeatMs;
-            auto reinsertIter =
-                std::find_if(
-                    m_msgsToSend.begin(), m_msgsToSend.end(),
-                    [&newDelay](MessagePtr mPtr) mutable -> bool
-                    {
-                        assert(mPtr);
-                        auto mDelay = property::message::Delay().getFrom(*mPtr);
-                        if (newDelay < mDelay) {
-                            return true;
-                        }
-                        newDelay -= mDelay;
-                        return false;
-                    });
-
-            if (reinsertIter != m_msgsToSend.end()) {
-                auto& msgToUpdate = *reinsertIter;
-                assert(msgToUpdate);
-                auto mDelay = property::message::Delay().getFrom(*msgToUpdate);
-                property::message::Delay().setTo(mDelay - newDelay, *msgToUpdate);
-            }
+            bool repeat =
+                (Duration::zero() < sched.m_period) &&
+                ((sched.m_remCount == 0U) || (1U < sched.m_remCount));
 
-            auto clonedMsg = m_protocol->cloneMessage(*msgToSend);
-            auto extraProps = property::message::ExtraInfo().getFrom(*msgToSend);
-            if (!extraProps.isEmpty()) {
-                property::message::ExtraInfo().setTo(std::move(extraProps), *clonedMsg);
-                m_protocol->updateMessage(*clonedMsg);
+            // The original message object is reported with its last sending
+            batch.push_back(DueMsg{sched.m_idx, repeat});
+            if (!repeat) {
+                continue;
             }
 
-            std::swap(clonedMsg, msgToSend);
-            property::message::Delay().setTo(newDelay, *clonedMsg);
-
-            if (repeatCount != 0) {
-                property::message::RepeatCount().setTo(repeatCount - 1, *clonedMsg);
+            if (sched.m_remCount != 0U) {
+                --sched.m_remCount;
             }
 
-            m_msgsToSend.insert(reinsertIter, std::move(clonedMsg));
+            // Keep the schedule based on absolute time to avoid drift, but
+            // don't produce bursts after long stall of the scheduler.
+            sched.m_due += sched.m_period;
+            if (sched.m_due + sched.m_period < now) {
+                sched.m_due = now + sched.m_period;
+            }
+            schedule(std::move(sched));
         }
+
+        m_ready.push_back(std::move(batch));
+        notifyOwner();
     }
+}
 
-    if (!m_msgsToSend.empty()) {
-        auto& msg = m_msgsToSend.front();
-        assert(msg);
-        auto delay = property::message::Delay().getFrom(*msg);
-        assert(0 < delay);
-        property::message::Delay().setTo(0, *msg);
-        m_timer.setSingleShot(true);
-        m_timer.start(static_cast<int>(delay));
+void MsgSendMgrImpl::notifyOwner()
+{
+    // Expected to be called with m_lock held, single pending notification
+    // delivers all the ready batches.
+    if (m_notifyPending) {
+        return;
     }
 
-    if ((!nextMsgsToSend.empty()) && m_sendCallback) {
-        m_sendCallback(std::move(nextMsgsToSend));
+    m_notifyPending = true;
+    QMetaObject::invokeMethod(this, "sendReady", Qt::QueuedConnection);
+}
+
+void MsgSendMgrImpl::stopScheduler()
+{
+    if (!m_scheduler.joinable()) {
+        return;
     }
 
-    if (m_msgsToSend.empty() && m_sendCompleteCallback) {
-        m_sendCompleteCallback();
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_stopRequested = true;
     }
+    m_cond.notify_all();
+    m_scheduler.join();
 }
+
 }  // namespace comms_champion
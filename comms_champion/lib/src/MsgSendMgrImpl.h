@@ -18,20 +18,30 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
 #include <QtCore/QObject>
-#include <QtCore/QTimer>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/MsgSendMgr.h"
 #include "comms_champion/Protocol.h"
+#include "comms_champion/DataInfo.h"
 
 namespace comms_champion
 {
 
+/// @details The schedule is kept by the dedicated thread, which sleeps
+///     until the next due time with the steady clock resolution. The
+///     messages due at the same tick are posted as a single batch to the
+///     thread that owns this object, where the message objects are prepared
+///     and reported via the "send messages" callback.
 class MsgSendMgrImpl : public QObject
 {
     Q_OBJECT
@@ -60,14 +70,59 @@ public:
     void stop();
 
 private slots:
-    void sendPendingAndWait();
+    void sendReady();
 
 private:
+    typedef std::chrono::steady_clock Clock;
+    typedef Clock::time_point Timestamp;
+    typedef std::chrono::microseconds Duration;
+
+    struct MsgInfo
+    {
+        MessagePtr m_msg;
+        DataInfo::DataSeq m_data;
+    };
+
+    struct ScheduledMsg
+    {
+        Timestamp m_due;
+        unsigned long long m_seq = 0U;
+        std::size_t m_idx = 0U;
+        Duration m_period;
+        unsigned m_remCount = 0U;
+    };
+
+    struct DueMsg
+    {
+        std::size_t m_idx;
+        bool m_copy;
+    };
+
+    typedef std::vector<MsgInfo> MsgsList;
+    typedef std::vector<ScheduledMsg> ScheduledQueue;
+    typedef std::vector<DueMsg> Batch;
+    typedef std::vector<Batch> BatchesList;
+
+    void schedule(ScheduledMsg&& sched);
+    MessagePtr prepareMsg(const MsgInfo& info, bool copy);
+    void schedulerLoop();
+    void notifyOwner();
+    void stopScheduler();
+
     SendMsgsCallbackFunc m_sendCallback;
     SendCompleteCallbackFunc m_sendCompleteCallback;
     ProtocolPtr m_protocol;
-    MessagesList m_msgsToSend;
-    QTimer m_timer;
+    MsgsList m_msgs;
+
+    std::thread m_scheduler;
+    std::mutex m_lock;
+    std::condition_variable m_cond;
+    ScheduledQueue m_queue;
+    BatchesList m_ready;
+    unsigned long long m_nextSeq = 0U;
+    bool m_stopRequested = false;
+    bool m_complete = false;
+    bool m_notifyPending = false;
 };
 
 }  // namespace comms_champion
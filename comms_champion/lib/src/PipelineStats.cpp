@@ -0,0 +1,191 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "comms_champion/PipelineStats.h"
+
+#include <cassert>
+#include <type_traits>
+#include <algorithm>
+#include <iterator>
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QJsonArray>
+CC_ENABLE_WARNINGS()
+
+namespace comms_champion
+{
+
+namespace
+{
+
+const unsigned long long NsInUs = 1000ULL;
+
+std::size_t bucketIdx(unsigned long long ns)
+{
+    auto us = ns / NsInUs;
+    std::size_t idx = 0U;
+    while ((1U < us) && (idx < (PipelineStats::TimeHistogram::NumOfBuckets - 1))) {
+        us >>= 1;
+        ++idx;
+    }
+    return idx;
+}
+
+QJsonObject histogramToJson(const PipelineStats::TimeHistogram& hist)
+{
+    QJsonObject obj;
+    obj.insert("count", static_cast<double>(hist.m_count));
+    obj.insert("avg_ns", static_cast<double>(hist.averageNs()));
+    obj.insert("max_ns", static_cast<double>(hist.m_maxNs));
+    obj.insert("p50_us", static_cast<double>(hist.percentileUs(50)));
+    obj.insert("p99_us", static_cast<double>(hist.percentileUs(99)));
+
+    auto lastUsed =
+        std::find_if(
+            hist.m_buckets.rbegin(), hist.m_buckets.rend(),
+            [](unsigned long long val) -> bool
+            {
+                return val != 0U;
+            });
+
+    QJsonArray buckets;
+    auto count = static_cast<std::size_t>(std::distance(lastUsed, hist.m_buckets.rend()));
+    for (auto idx = 0U; idx < count; ++idx) {
+        buckets.append(static_cast<double>(hist.m_buckets[idx]));
+    }
+    obj.insert("buckets_log2_us", buckets);
+    return obj;
+}
+
+}  // namespace
+
+void PipelineStats::TimeHistogram::add(unsigned long long ns)
+{
+    ++m_buckets[bucketIdx(ns)];
+    ++m_count;
+    m_totalNs += ns;
+    m_maxNs = std::max(m_maxNs, ns);
+}
+
+unsigned long long PipelineStats::TimeHistogram::averageNs() const
+{
+    if (m_count == 0U) {
+        return 0U;
+    }
+
+    return m_totalNs / m_count;
+}
+
+unsigned long long PipelineStats::TimeHistogram::percentileUs(unsigned percent) const
+{
+    auto required = (m_count * std::min(percent, 100U) + 99U) / 100U;
+    unsigned long long accumulated = 0U;
+    for (auto idx = 0U; idx < m_buckets.size(); ++idx) {
+        accumulated += m_buckets[idx];
+        if ((0U < accumulated) && (required <= accumulated)) {
+            return 1ULL << (idx + 1);
+        }
+    }
+    return 0U;
+}
+
+const PipelineStats::TimeHistogram& PipelineStats::stage(Stage value) const
+{
+    auto idx = static_cast<std::size_t>(value);
+    assert(idx < m_stages.size());
+    return m_stages[idx];
+}
+
+PipelineStats::TimeHistogram& PipelineStats::stage(Stage value)
+{
+    auto idx = static_cast<std::size_t>(value);
+    assert(idx < m_stages.size());
+    return m_stages[idx];
+}
+
+const char* PipelineStats::stageName(Stage value)
+{
+    static const char* Names[] = {
+        "filters",
+        "protocol",
+        "report"
+    };
+
+    static_assert(
+        std::extent<decltype(Names)>::value == static_cast<std::size_t>(Stage::NumOfValues),
+        "Names list is not updated");
+
+    auto idx = static_cast<std::size_t>(value);
+    if (static_cast<std::size_t>(Stage::NumOfValues) <= idx) {
+        assert(!"Invalid stage");
+        return "";
+    }
+
+    return Names[idx];
+}
+
+double PipelineStats::rate(unsigned long long count) const
+{
+    if (m_durationMs == 0U) {
+        return 0.0;
+    }
+
+    return (static_cast<double>(count) * 1000.0) / static_cast<double>(m_durationMs);
+}
+
+QJsonObject PipelineStats::toJson() const
+{
+    QJsonObject stages;
+    for (auto idx = 0U; idx < m_stages.size(); ++idx) {
+        auto stageVal = static_cast<Stage>(idx);
+        stages.insert(stageName(stageVal), histogramToJson(stage(stageVal)));
+    }
+
+    QJsonArray msgTypes;
+    for (auto& info : m_msgTypes) {
+        QJsonObject obj;
+        obj.insert("id", info.m_id);
+        obj.insert("name", info.m_name);
+        obj.insert("count", static_cast<double>(info.m_count));
+        obj.insert("rate", rate(info.m_count));
+        obj.insert("bytes", static_cast<double>(info.m_bytes));
+        obj.insert("min_size", static_cast<double>(info.m_minSize));
+        obj.insert("max_size", static_cast<double>(info.m_maxSize));
+        msgTypes.append(obj);
+    }
+
+    QJsonObject obj;
+    obj.insert("duration_ms", static_cast<double>(m_durationMs));
+    obj.insert("recv_chunks", static_cast<double>(m_recvChunks));
+    obj.insert("recv_bytes", static_cast<double>(m_recvBytes));
+    obj.insert("recv_bytes_rate", rate(m_recvBytes));
+    obj.insert("recv_msgs", static_cast<double>(m_recvMsgs));
+    obj.insert("recv_rate", rate(m_recvMsgs));
+    obj.insert("sent_msgs", static_cast<double>(m_sentMsgs));
+    obj.insert("sent_bytes", static_cast<double>(m_sentBytes));
+    obj.insert("invalid_msgs", static_cast<double>(m_invalidMsgs));
+    obj.insert("garbage_bytes", static_cast<double>(m_garbageBytes));
+    obj.insert("errors", static_cast<double>(m_errors));
+    obj.insert("max_queue_depth", static_cast<double>(m_maxQueueDepth));
+    obj.insert("history_size", static_cast<double>(m_historySize));
+    obj.insert("stages", stages);
+    obj.insert("msg_types", msgTypes);
+    return obj;
+}
+
+}  // namespace comms_champion
+
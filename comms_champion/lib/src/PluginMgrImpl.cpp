@@ -28,7 +28,14 @@ CC_DISABLE_WARNINGS()
 #include <QtCore/QString>
 #include <QtCore/QVariantList>
 #include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+#include <QtCore/QDateTime>
 #include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStandardPaths>
 #include <QtCore/QVariantList>
 CC_ENABLE_WARNINGS()
 
@@ -47,6 +54,17 @@ const QString NameMetaKey("name");
 const QString DescMetaKey("desc");
 const QString TypeMetaKey("type");
 
+const QString CacheFileName("plugins_cache.json");
+const QString CacheVersionKey("version");
+const QString CachePluginsKey("plugins");
+const QString CacheSizeKey("size");
+const QString CacheModifiedKey("modified");
+const QString CacheIidKey("iid");
+const QString CacheNameKey("name");
+const QString CacheDescKey("desc");
+const QString CacheTypeKey("type");
+const int CacheVersion = 1;
+
 struct PluginLoaderDeleter
 {
     void operator()(QPluginLoader* loader)
@@ -81,7 +99,7 @@ Plugin* getPlugin(QPluginLoader& loader)
     return plugin;
 }
 
-PluginMgrImpl::PluginInfo::Type parseType(const QString& val)
+const QString& typeName(PluginMgrImpl::PluginInfo::Type value)
 {
     static const QString Values[] = {
         QString(),
@@ -93,12 +111,25 @@ PluginMgrImpl::PluginInfo::Type parseType(const QString& val)
     static_assert(std::extent<decltype(Values)>::value == (std::size_t)PluginMgrImpl::PluginInfo::Type::NumOfValues,
         "The Values array must be adjusted.");
 
-    auto iter = std::find(std::begin(Values), std::end(Values), val);
-    if (iter == std::end(Values)) {
-        return PluginMgrImpl::PluginInfo::Type::Invalid;
+    auto idx = static_cast<std::size_t>(value);
+    if (std::extent<decltype(Values)>::value <= idx) {
+        return Values[0];
+    }
+
+    return Values[idx];
+}
+
+PluginMgrImpl::PluginInfo::Type parseType(const QString& val)
+{
+    typedef PluginMgrImpl::PluginInfo::Type Type;
+    for (auto idx = 0U; idx < static_cast<unsigned>(Type::NumOfValues); ++idx) {
+        auto type = static_cast<Type>(idx);
+        if (typeName(type) == val) {
+            return type;
+        }
     }
 
-    return static_cast<PluginMgrImpl::PluginInfo::Type>(std::distance(std::begin(Values), iter));
+    return Type::Invalid;
 }
 
 }  // namespace
@@ -109,8 +140,8 @@ PluginMgrImpl::~PluginMgrImpl() noexcept
 {
     for (auto& pluginInfoPtr : m_plugins) {
         assert(pluginInfoPtr);
-        assert(pluginInfoPtr->m_loader);
-        if (pluginInfoPtr->m_loader->isLoaded()) {
+        if ((pluginInfoPtr->m_loader) &&
+            (pluginInfoPtr->m_loader->isLoaded())) {
             pluginInfoPtr->m_loader->unload();
         }
     }
@@ -132,11 +163,43 @@ const PluginMgrImpl::ListOfPluginInfos& PluginMgrImpl::getAvailablePlugins()
         auto files =
             pluginDir.entryList(QDir::Files | QDir::NoDotAndDotDot, QDir::Name);
 
+        // The metadata is cached by the file path, size and modification
+        // time, the libraries are not touched until loaded.
+        auto cache = loadCache();
+        bool cacheUpdated = false;
+        auto dirPrefix = pluginDir.absolutePath() + '/';
+        for (auto iter = cache.begin(); iter != cache.end();) {
+            if (iter.key().startsWith(dirPrefix) && (!QFileInfo::exists(iter.key()))) {
+                iter = cache.erase(iter);
+                cacheUpdated = true;
+                continue;
+            }
+            ++iter;
+        }
+
         for (auto& f : files) {
-            auto infoPtr = readPluginInfo(f);
+            auto path = pluginDir.absoluteFilePath(f);
+            QFileInfo fileInfo(path);
+            auto size = fileInfo.size();
+            auto modified = fileInfo.lastModified().toMSecsSinceEpoch();
+
+            PluginInfoPtr infoPtr;
+            auto entry = cache.value(path).toMap();
+            if ((!entry.isEmpty()) &&
+                (entry.value(CacheSizeKey).toLongLong() == size) &&
+                (entry.value(CacheModifiedKey).toLongLong() == modified)) {
+                infoPtr = readCachedPluginInfo(entry);
+            }
+            else {
+                infoPtr = readPluginInfo(path);
+                cache.insert(path, makeCacheEntry(infoPtr.get(), size, modified));
+                cacheUpdated = true;
+            }
+
             if (!infoPtr) {
                 continue;
             }
+            infoPtr->m_filename = path;
 
             if (infoPtr->getType() == PluginInfo::Type::Invalid) {
                 std::cerr << "WARNING: plugin " << f.toStdString() << " doesn't specify its type, use either "
@@ -146,6 +209,10 @@ const PluginMgrImpl::ListOfPluginInfos& PluginMgrImpl::getAvailablePlugins()
 
             m_plugins.push_back(std::move(infoPtr));
         }
+
+        if (cacheUpdated) {
+            saveCache(cache);
+        }
     } while (false);
 
     return m_plugins;
@@ -193,8 +260,7 @@ PluginMgrImpl::ListOfPluginInfos PluginMgrImpl::loadPluginsFromConfig(
 
             auto pluginInfoPtr = *iter;
             assert(pluginInfoPtr);
-            assert(pluginInfoPtr->m_loader);
-            auto* pluginPtr = getPlugin(*pluginInfoPtr->m_loader);
+            auto* pluginPtr = getPlugin(pluginLoader(*pluginInfoPtr));
             assert(pluginPtr != nullptr);
             pluginPtr->reconfigure(config);
 
@@ -227,7 +293,7 @@ bool PluginMgrImpl::savePluginsToConfigFile(
 
 Plugin* PluginMgrImpl::loadPlugin(const PluginInfo& info)
 {
-    return getPlugin(*info.m_loader);
+    return getPlugin(pluginLoader(info));
 }
 
 bool PluginMgrImpl::hasAppliedPlugins() const
@@ -311,8 +377,7 @@ QVariantMap PluginMgrImpl::getConfigForPlugins(
         assert(!pluginInfoPtr->m_iid.isEmpty());
         pluginsList.append(QVariant::fromValue(pluginInfoPtr->m_iid));
 
-        assert(pluginInfoPtr->m_loader);
-        auto* pluginPtr = getPlugin(*pluginInfoPtr->m_loader);
+        auto* pluginPtr = getPlugin(pluginLoader(*pluginInfoPtr));
         assert(pluginPtr != nullptr);
         pluginPtr->getCurrentConfig(config);
     }
@@ -395,6 +460,115 @@ PluginMgrImpl::PluginInfoPtr PluginMgrImpl::readPluginInfo(const QString& filena
     return ptr;
 }
 
+PluginMgrImpl::PluginInfoPtr PluginMgrImpl::readCachedPluginInfo(const QVariantMap& entry)
+{
+    PluginInfoPtr ptr;
+    auto iid = entry.value(CacheIidKey).toString();
+    if (iid.isEmpty()) {
+        // Not a plugin
+        return ptr;
+    }
+
+    ptr.reset(new PluginInfo());
+    ptr->m_iid = std::move(iid);
+    ptr->m_name = entry.value(CacheNameKey).toString();
+    ptr->m_desc = entry.value(CacheDescKey).toString();
+    ptr->m_type = parseType(entry.value(CacheTypeKey).toString());
+    return ptr;
+}
+
+QVariantMap PluginMgrImpl::makeCacheEntry(
+    const PluginInfo* info,
+    qint64 size,
+    qint64 modified)
+{
+    QVariantMap entry;
+    entry.insert(CacheSizeKey, QVariant::fromValue(size));
+    entry.insert(CacheModifiedKey, QVariant::fromValue(modified));
+    if (info != nullptr) {
+        entry.insert(CacheIidKey, info->m_iid);
+        entry.insert(CacheNameKey, info->m_name);
+        entry.insert(CacheDescKey, info->m_desc);
+        entry.insert(CacheTypeKey, typeName(info->m_type));
+    }
+    return entry;
+}
+
+QPluginLoader& PluginMgrImpl::pluginLoader(const PluginInfo& info)
+{
+    if (!info.m_loader) {
+        assert(!info.m_filename.isEmpty());
+        info.m_loader.reset(new QPluginLoader(info.m_filename));
+    }
+    return *info.m_loader;
+}
+
+QString PluginMgrImpl::cacheFilePath()
+{
+    auto dir = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+    if (dir.isEmpty()) {
+        return QString();
+    }
+
+    return QDir(dir).absoluteFilePath("comms_champion/" + CacheFileName);
+}
+
+QVariantMap PluginMgrImpl::loadCache()
+{
+    auto path = cacheFilePath();
+    if (path.isEmpty()) {
+        return QVariantMap();
+    }
+
+    QFile cacheFile(path);
+    if (!cacheFile.open(QIODevice::ReadOnly)) {
+        return QVariantMap();
+    }
+
+    auto jsonDoc = QJsonDocument::fromJson(cacheFile.readAll());
+    if (!jsonDoc.isObject()) {
+        return QVariantMap();
+    }
+
+    auto cacheMap = jsonDoc.object().toVariantMap();
+    if (cacheMap.value(CacheVersionKey).toInt() != CacheVersion) {
+        return QVariantMap();
+    }
+
+    return cacheMap.value(CachePluginsKey).toMap();
+}
+
+void PluginMgrImpl::saveCache(const QVariantMap& cache)
+{
+    auto path = cacheFilePath();
+    if (path.isEmpty()) {
+        return;
+    }
+
+    QFileInfo pathInfo(path);
+    if (!QDir().mkpath(pathInfo.absolutePath())) {
+        return;
+    }
+
+    QVariantMap cacheMap;
+    cacheMap.insert(CacheVersionKey, CacheVersion);
+    cacheMap.insert(CachePluginsKey, cache);
+    auto data = QJsonDocument(QJsonObject::fromVariantMap(cacheMap)).toJson();
+
+    // Other running instance may read the cache at the same time,
+    // QSaveFile replaces the file atomically on commit().
+    QSaveFile cacheFile(path);
+    if (!cacheFile.open(QIODevice::WriteOnly)) {
+        return;
+    }
+
+    if (cacheFile.write(data) != data.size()) {
+        cacheFile.cancelWriting();
+    }
+
+    cacheFile.commit();
+}
+
 }  // namespace comms_champion
 
 
@@ -73,6 +73,12 @@ private:
     typedef std::list<PluginLoaderPtr> PluginLoadersList;
 
     PluginInfoPtr readPluginInfo(const QString& filename);
+    static PluginInfoPtr readCachedPluginInfo(const QVariantMap& entry);
+    static QVariantMap makeCacheEntry(const PluginInfo* info, qint64 size, qint64 modified);
+    static QPluginLoader& pluginLoader(const PluginInfo& info);
+    static QString cacheFilePath();
+    static QVariantMap loadCache();
+    static void saveCache(const QVariantMap& cache);
 
     QString m_pluginDir;
     ListOfPluginInfos m_plugins;
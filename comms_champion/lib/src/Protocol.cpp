@@ -17,6 +17,11 @@
 
 #include "comms_champion/Protocol.h"
 
+#include <algorithm>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
@@ -30,6 +35,33 @@ CC_ENABLE_WARNINGS()
 namespace comms_champion
 {
 
+struct Protocol::StatsData
+{
+    typedef std::unordered_map<std::type_index, PipelineStats::MsgTypeStats> MsgTypesMap;
+
+    MsgTypesMap m_msgTypes;
+    unsigned long long m_decodedMsgs = 0U;
+    unsigned long long m_invalidMsgs = 0U;
+    unsigned long long m_garbageBytes = 0U;
+};
+
+// Information shared by the messages of the same type, owned by every
+// protocol instance rather than globally, because the message types
+// belong to the plugin, which may be unloaded after the protocol object
+// is destructed. The protocol objects are not used by multiple threads
+// concurrently, no locking is required.
+struct Protocol::TypesRegistry
+{
+    typedef std::unordered_map<std::type_index, Message::TypeInfoPtr> Map;
+
+    Map m_map;
+};
+
+Protocol::Protocol()
+  : m_types(new TypesRegistry())
+{
+}
+
 Protocol::~Protocol() noexcept = default;
 
 const QString& Protocol::name() const
@@ -41,7 +73,13 @@ Protocol::MessagesList Protocol::read(
     const DataInfo& dataInfo,
     bool final)
 {
-    return readImpl(dataInfo, final);
+    auto msgs = readImpl(dataInfo, final);
+    for (auto& m : msgs) {
+        if (m) {
+            updateTypeInfo(*m);
+        }
+    }
+    return msgs;
 }
 
 DataInfoPtr Protocol::write(Message& msg)
@@ -68,12 +106,22 @@ DataInfoPtr Protocol::write(Message& msg)
 
 Protocol::MessagesList Protocol::createAllMessages()
 {
-    return createAllMessagesImpl();
+    auto msgs = createAllMessagesImpl();
+    for (auto& m : msgs) {
+        if (m) {
+            updateTypeInfo(*m);
+        }
+    }
+    return msgs;
 }
 
 MessagePtr Protocol::createMessage(const QString& idAsString, unsigned idx)
 {
-    return createMessageImpl(idAsString, idx);
+    auto msg = createMessageImpl(idAsString, idx);
+    if (msg) {
+        updateTypeInfo(*msg);
+    }
+    return msg;
 }
 
 Protocol::UpdateStatus Protocol::updateMessage(Message& msg)
@@ -131,6 +179,7 @@ MessagePtr Protocol::cloneMessage(const Message& msg)
             return clonedMsg;
         }
 
+        updateTypeInfo(*clonedMsg);
         auto extraInfoMap = getExtraInfoFromMessageProperties(msg);
         if (!extraInfoMap.isEmpty()) {
             setExtraInfoToMessageProperties(extraInfoMap, *clonedMsg);
@@ -142,6 +191,7 @@ MessagePtr Protocol::cloneMessage(const Message& msg)
 
     auto clonedMsg = cloneMessageImpl(msg);
     if (clonedMsg) {
+        updateTypeInfo(*clonedMsg);
         setNameToMessageProperties(*clonedMsg);
         updateMessage(*clonedMsg);
         property::message::ExtraInfo().copyFromTo(msg, *clonedMsg);
@@ -149,6 +199,24 @@ MessagePtr Protocol::cloneMessage(const Message& msg)
     return clonedMsg;
 }
 
+MessagePtr Protocol::copyMessage(const Message& msg)
+{
+    if (msg.idAsString().isEmpty()) {
+        return cloneMessage(msg);
+    }
+
+    auto copiedMsg = cloneMessageImpl(msg);
+    if (copiedMsg) {
+        updateTypeInfo(*copiedMsg);
+        property::message::ProtocolName().copyFromTo(msg, *copiedMsg);
+        property::message::TransportMsg().copyFromTo(msg, *copiedMsg);
+        property::message::RawDataMsg().copyFromTo(msg, *copiedMsg);
+        property::message::ExtraInfoMsg().copyFromTo(msg, *copiedMsg);
+        property::message::ExtraInfo().copyFromTo(msg, *copiedMsg);
+    }
+    return copiedMsg;
+}
+
 MessagePtr Protocol::createInvalidMessage(const MsgDataSeq& data)
 {
     auto rawDataMsg = createRawDataMessageImpl();
@@ -165,10 +233,124 @@ MessagePtr Protocol::createInvalidMessage(const MsgDataSeq& data)
         return invalidMsg;
     }
 
+    updateTypeInfo(*invalidMsg);
     setRawDataToMessageProperties(std::move(rawDataMsg), *invalidMsg);
     return invalidMsg;
 }
 
+void Protocol::setDecodeOnly(bool value)
+{
+    m_decodeOnly = value;
+}
+
+bool Protocol::isDecodeOnly() const
+{
+    return m_decodeOnly;
+}
+
+void Protocol::setStatsEnabled(bool enabled)
+{
+    if (!enabled) {
+        m_stats.reset();
+        return;
+    }
+
+    if (!m_stats) {
+        m_stats.reset(new StatsData());
+    }
+}
+
+bool Protocol::isStatsEnabled() const
+{
+    return static_cast<bool>(m_stats);
+}
+
+void Protocol::collectStats(PipelineStats& stats) const
+{
+    if (!m_stats) {
+        return;
+    }
+
+    stats.m_invalidMsgs += m_stats->m_invalidMsgs;
+    stats.m_garbageBytes += m_stats->m_garbageBytes;
+    stats.m_msgTypes.reserve(stats.m_msgTypes.size() + m_stats->m_msgTypes.size());
+    for (auto& info : m_stats->m_msgTypes) {
+        stats.m_msgTypes.push_back(info.second);
+    }
+
+    std::sort(
+        stats.m_msgTypes.begin(), stats.m_msgTypes.end(),
+        [](const PipelineStats::MsgTypeStats& first, const PipelineStats::MsgTypeStats& second) -> bool
+        {
+            return second.m_count < first.m_count;
+        });
+}
+
+void Protocol::resetStats()
+{
+    if (m_stats) {
+        m_stats.reset(new StatsData());
+    }
+}
+
+unsigned long long Protocol::decodedMsgsCount() const
+{
+    if (!m_stats) {
+        return 0U;
+    }
+
+    return m_stats->m_decodedMsgs;
+}
+
+void Protocol::reportMsgStats(const Message& msg, std::size_t size)
+{
+    if (!m_stats) {
+        return;
+    }
+
+    ++m_stats->m_decodedMsgs;
+    auto& info = m_stats->m_msgTypes[std::type_index(typeid(msg))];
+    if (info.m_count == 0U) {
+        info.m_id = msg.idAsString();
+        info.m_name = msg.name();
+        info.m_minSize = size;
+        info.m_maxSize = size;
+    }
+
+    ++info.m_count;
+    info.m_bytes += size;
+    info.m_minSize = std::min(info.m_minSize, size);
+    info.m_maxSize = std::max(info.m_maxSize, size);
+}
+
+void Protocol::reportInvalidMsgStats()
+{
+    if (m_stats) {
+        ++m_stats->m_invalidMsgs;
+    }
+}
+
+void Protocol::reportGarbageStats(std::size_t count)
+{
+    if (m_stats) {
+        m_stats->m_garbageBytes += count;
+    }
+}
+
+void Protocol::updateTypeInfo(Message& msg)
+{
+    if (msg.hasTypeInfo()) {
+        return;
+    }
+
+    auto& info = m_types->m_map[std::type_index(typeid(msg))];
+    if (!info) {
+        info = msg.createTypeInfo();
+    }
+
+    msg.setTypeInfo(info);
+}
+
 void Protocol::setNameToMessageProperties(Message& msg)
 {
     property::message::ProtocolName().setTo(name(), msg);
@@ -79,6 +79,11 @@ unsigned Socket::connectionProperties() const
     return connectionPropertiesImpl();
 }
 
+void Socket::applyProtocol(ProtocolPtr protocol)
+{
+    applyProtocolImpl(std::move(protocol));
+}
+
 bool Socket::startImpl()
 {
     return true;
@@ -102,6 +107,11 @@ unsigned Socket::connectionPropertiesImpl() const
     return 0U;
 }
 
+void Socket::applyProtocolImpl(ProtocolPtr protocol)
+{
+    static_cast<void>(protocol);
+}
+
 void Socket::reportDataReceived(DataInfoPtr dataPtr)
 {
     if ((!m_running) || (!m_dataReceivedCallback)) {
@@ -130,4 +140,11 @@ void Socket::reportDisconnected()
     }
 }
 
+void Socket::reportConnectionClosed(DataInfo::ConnectionId id)
+{
+    if (m_running && m_connectionClosedReportCallback) {
+        m_connectionClosedReportCallback(id);
+    }
+}
+
 }  // namespace comms_champion
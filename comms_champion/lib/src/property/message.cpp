@@ -65,6 +65,12 @@ const QByteArray RepeatDurationUnits::PropName = RepeatDurationUnits::Name.toUtf
 const QString RepeatCount::Name("cc.msg_repeat_count");
 const QByteArray RepeatCount::PropName = RepeatCount::Name.toUtf8();
 
+const QString ConnectionId::Name("cc.msg_conn_id");
+const QByteArray ConnectionId::PropName = ConnectionId::Name.toUtf8();
+
+const QString OutData::Name("cc.msg_out_data");
+const QByteArray OutData::PropName = OutData::Name.toUtf8();
+
 const QString ScrollPos::Name("cc.msg_scroll_pos");
 const QByteArray ScrollPos::PropName = ScrollPos::Name.toUtf8();
 
@@ -0,0 +1,225 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "LoadGenSocket.h"
+
+#include <cassert>
+#include <algorithm>
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace load_gen_socket
+{
+
+namespace
+{
+
+const unsigned long long MaxFramesPerTick = 10000U;
+const auto MaxRateTickBudget = std::chrono::milliseconds(10);
+const std::mt19937::result_type RandSeed = 0x1234;
+
+}  // namespace
+
+LoadGenSocket::LoadGenSocket()
+{
+    connect(
+        &m_genTimer, SIGNAL(timeout()),
+        this, SLOT(generate()));
+}
+
+LoadGenSocket::~LoadGenSocket() noexcept = default;
+
+bool LoadGenSocket::socketConnectImpl()
+{
+    if (!prepareFrames()) {
+        return false;
+    }
+
+    m_rand.seed(RandSeed);
+    m_pending.clear();
+    m_nextFrameIdx = 0U;
+    m_framesSinceStart = 0U;
+    m_startTime = Clock::now();
+
+    int genInterval = 1;
+    if (m_rate == 0U) {
+        genInterval = 0;
+    }
+    m_genTimer.start(genInterval);
+    return true;
+}
+
+void LoadGenSocket::socketDisconnectImpl()
+{
+    m_genTimer.stop();
+    m_pending.clear();
+}
+
+void LoadGenSocket::sendDataImpl(DataInfoPtr dataPtr)
+{
+    static_cast<void>(dataPtr);
+}
+
+void LoadGenSocket::applyProtocolImpl(ProtocolPtr protocol)
+{
+    m_protocol = std::move(protocol);
+    m_frames.clear();
+}
+
+void LoadGenSocket::generate()
+{
+    if (m_frames.empty()) {
+        return;
+    }
+
+    if (m_rate != 0U) {
+        auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - m_startTime).count();
+        auto due = (static_cast<unsigned long long>(elapsed) * m_rate) / 1000000ULL;
+        auto count = std::min(due - std::min(due, m_framesSinceStart), MaxFramesPerTick);
+        for (auto idx = 0ULL; idx < count; ++idx) {
+            appendFrame();
+            flushPending(false);
+        }
+        flushPending(true);
+        return;
+    }
+
+    auto tickEnd = Clock::now() + MaxRateTickBudget;
+    while (true) {
+        static const unsigned CheckInterval = 16U;
+        for (auto idx = 0U; idx < CheckInterval; ++idx) {
+            appendFrame();
+            flushPending(false);
+        }
+
+        if (tickEnd <= Clock::now()) {
+            break;
+        }
+    }
+    flushPending(true);
+}
+
+bool LoadGenSocket::prepareFrames()
+{
+    if (!m_frames.empty()) {
+        return true;
+    }
+
+    if (!m_protocol) {
+        static const QString NoProtocolError(
+            tr("Load generator requires protocol plugin to be applied."));
+        reportError(NoProtocolError);
+        return false;
+    }
+
+    auto msgs = m_protocol->createAllMessages();
+    m_frames.reserve(msgs.size());
+    for (auto& msgPtr : msgs) {
+        assert(msgPtr);
+        auto dataPtr = m_protocol->write(*msgPtr);
+        if ((!dataPtr) || (dataPtr->m_data.empty())) {
+            continue;
+        }
+
+        m_frames.push_back(std::move(dataPtr->m_data));
+    }
+
+    if (m_frames.empty()) {
+        static const QString NoFramesError(
+            tr("Protocol didn't produce any message to generate."));
+        reportError(NoFramesError);
+        return false;
+    }
+
+    return true;
+}
+
+void LoadGenSocket::appendFrame()
+{
+    assert(!m_frames.empty());
+    auto& frame = m_frames[m_nextFrameIdx];
+    m_nextFrameIdx = (m_nextFrameIdx + 1) % m_frames.size();
+
+    auto frameStart = m_pending.size();
+    m_pending.insert(m_pending.end(), frame.begin(), frame.end());
+    ++m_framesSinceStart;
+
+    if ((m_corruptPercent == 0U) ||
+        (m_corruptPercent < std::uniform_int_distribution<unsigned>(1U, 100U)(m_rand))) {
+        return;
+    }
+
+    auto pos = std::uniform_int_distribution<std::size_t>(frameStart, m_pending.size() - 1)(m_rand);
+    auto mask = static_cast<std::uint8_t>(std::uniform_int_distribution<unsigned>(1U, 0xffU)(m_rand));
+    m_pending[pos] ^= mask;
+}
+
+void LoadGenSocket::flushPending(bool all)
+{
+    if (m_maxChunk == 0U) {
+        if (all || (m_minChunk <= m_pending.size())) {
+            if (!m_pending.empty()) {
+                deliverChunk(std::move(m_pending));
+                m_pending.clear();
+            }
+        }
+        return;
+    }
+
+    auto minChunk = std::max(1U, std::min(m_minChunk, m_maxChunk));
+    std::size_t consumed = 0U;
+    while (consumed < m_pending.size()) {
+        auto chunkSize =
+            static_cast<std::size_t>(
+                std::uniform_int_distribution<unsigned>(minChunk, m_maxChunk)(m_rand));
+        auto remSize = m_pending.size() - consumed;
+        if (remSize < chunkSize) {
+            if (!all) {
+                break;
+            }
+            chunkSize = remSize;
+        }
+
+        auto chunkBeg = m_pending.begin() + static_cast<std::ptrdiff_t>(consumed);
+        deliverChunk(DataSeq(chunkBeg, chunkBeg + static_cast<std::ptrdiff_t>(chunkSize)));
+        consumed += chunkSize;
+    }
+
+    m_pending.erase(m_pending.begin(), m_pending.begin() + static_cast<std::ptrdiff_t>(consumed));
+}
+
+void LoadGenSocket::deliverChunk(DataSeq&& data)
+{
+    // The throughput and the decode lag are measured by the message
+    // manager (see PipelineStats), the data is processed synchronously.
+    auto dataPtr = makeDataInfo();
+    dataPtr->m_data = std::move(data);
+    dataPtr->m_timestamp = Clock::now();
+    reportDataReceived(std::move(dataPtr));
+}
+
+}  // namespace load_gen_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
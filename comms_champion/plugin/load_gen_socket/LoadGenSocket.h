@@ -0,0 +1,115 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdint>
+
+#include "comms/CompileControl.h"
+CC_DISABLE_WARNINGS()
+#include <QtCore/QTimer>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Socket.h"
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace load_gen_socket
+{
+
+class LoadGenSocket : public QObject,
+                      public comms_champion::Socket
+{
+    Q_OBJECT
+    using Base = comms_champion::Socket;
+
+public:
+    LoadGenSocket();
+    ~LoadGenSocket() noexcept;
+
+    /// @brief Frames per second, 0 means "as fast as possible".
+    unsigned& rate()
+    {
+        return m_rate;
+    }
+
+    /// @brief Percentage of frames that get one byte corrupted.
+    unsigned& corruptPercent()
+    {
+        return m_corruptPercent;
+    }
+
+    /// @brief Minimal size of reported data chunk.
+    unsigned& minChunk()
+    {
+        return m_minChunk;
+    }
+
+    /// @brief Maximal size of reported data chunk, 0 means one chunk per frame.
+    unsigned& maxChunk()
+    {
+        return m_maxChunk;
+    }
+
+protected:
+    virtual bool socketConnectImpl() override;
+    virtual void socketDisconnectImpl() override;
+    virtual void sendDataImpl(DataInfoPtr dataPtr) override;
+    virtual void applyProtocolImpl(ProtocolPtr protocol) override;
+
+private slots:
+    void generate();
+
+private:
+    using Clock = DataInfo::TimestampClock;
+    using Timestamp = DataInfo::Timestamp;
+    using DataSeq = DataInfo::DataSeq;
+    using FramesList = std::vector<DataSeq>;
+
+    bool prepareFrames();
+    void appendFrame();
+    void flushPending(bool all);
+    void deliverChunk(DataSeq&& data);
+
+    QTimer m_genTimer;
+    ProtocolPtr m_protocol;
+    FramesList m_frames;
+    std::size_t m_nextFrameIdx = 0U;
+    DataSeq m_pending;
+    std::mt19937 m_rand;
+    Timestamp m_startTime;
+    unsigned long long m_framesSinceStart = 0U;
+
+    unsigned m_rate = 0U;
+    unsigned m_corruptPercent = 0U;
+    unsigned m_minChunk = 1U;
+    unsigned m_maxChunk = 0U;
+};
+
+}  // namespace load_gen_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
@@ -0,0 +1,86 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "LoadGenSocketConfigWidget.h"
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace load_gen_socket
+{
+
+LoadGenSocketConfigWidget::LoadGenSocketConfigWidget(
+    LoadGenSocket& socket,
+    QWidget* parentObj)
+  : Base(parentObj),
+    m_socket(socket)
+{
+    m_ui.setupUi(this);
+    m_ui.m_rateSpinBox->setValue(static_cast<int>(m_socket.rate()));
+    m_ui.m_corruptSpinBox->setValue(static_cast<int>(m_socket.corruptPercent()));
+    m_ui.m_minChunkSpinBox->setValue(static_cast<int>(m_socket.minChunk()));
+    m_ui.m_maxChunkSpinBox->setValue(static_cast<int>(m_socket.maxChunk()));
+
+    connect(
+        m_ui.m_rateSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(rateChanged(int)));
+
+    connect(
+        m_ui.m_corruptSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(corruptPercentChanged(int)));
+
+    connect(
+        m_ui.m_minChunkSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(minChunkChanged(int)));
+
+    connect(
+        m_ui.m_maxChunkSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(maxChunkChanged(int)));
+}
+
+LoadGenSocketConfigWidget::~LoadGenSocketConfigWidget() noexcept = default;
+
+void LoadGenSocketConfigWidget::rateChanged(int value)
+{
+    m_socket.rate() = static_cast<unsigned>(value);
+}
+
+void LoadGenSocketConfigWidget::corruptPercentChanged(int value)
+{
+    m_socket.corruptPercent() = static_cast<unsigned>(value);
+}
+
+void LoadGenSocketConfigWidget::minChunkChanged(int value)
+{
+    m_socket.minChunk() = static_cast<unsigned>(value);
+}
+
+void LoadGenSocketConfigWidget::maxChunkChanged(int value)
+{
+    m_socket.maxChunk() = static_cast<unsigned>(value);
+}
+
+}  // namespace load_gen_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
+
+
@@ -0,0 +1,67 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtWidgets/QWidget>
+CC_ENABLE_WARNINGS()
+
+#include "LoadGenSocket.h"
+#include "ui_LoadGenSocketConfigWidget.h"
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace load_gen_socket
+{
+
+class LoadGenSocketConfigWidget : public QWidget
+{
+    Q_OBJECT
+    typedef QWidget Base;
+public:
+    explicit LoadGenSocketConfigWidget(
+        LoadGenSocket& socket,
+        QWidget* parentObj = nullptr);
+
+    ~LoadGenSocketConfigWidget() noexcept;
+
+private slots:
+    void rateChanged(int value);
+    void corruptPercentChanged(int value);
+    void minChunkChanged(int value);
+    void maxChunkChanged(int value);
+
+private:
+    LoadGenSocket& m_socket;
+    Ui::LoadGenSocketConfigWidget m_ui;
+};
+
+}  // namespace load_gen_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
+
+
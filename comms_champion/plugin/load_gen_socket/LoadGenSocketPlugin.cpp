@@ -0,0 +1,118 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "LoadGenSocketPlugin.h"
+
+#include <memory>
+#include <cassert>
+
+#include "LoadGenSocketConfigWidget.h"
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace load_gen_socket
+{
+
+namespace
+{
+
+const QString MainConfigKey("cc_load_gen_socket");
+const QString RateSubKey("rate");
+const QString CorruptSubKey("corrupt_percent");
+const QString MinChunkSubKey("min_chunk");
+const QString MaxChunkSubKey("max_chunk");
+
+}  // namespace
+
+LoadGenSocketPlugin::LoadGenSocketPlugin()
+{
+    pluginProperties()
+        .setSocketCreateFunc(
+            [this]()
+            {
+                createSocketIfNeeded();
+                return m_socket;
+            })
+        .setConfigWidgetCreateFunc(
+            [this]()
+            {
+                createSocketIfNeeded();
+                return new LoadGenSocketConfigWidget(*m_socket);
+            });
+}
+
+LoadGenSocketPlugin::~LoadGenSocketPlugin() noexcept = default;
+
+void LoadGenSocketPlugin::getCurrentConfigImpl(QVariantMap& config)
+{
+    createSocketIfNeeded();
+
+    QVariantMap subConfig;
+    subConfig.insert(RateSubKey, m_socket->rate());
+    subConfig.insert(CorruptSubKey, m_socket->corruptPercent());
+    subConfig.insert(MinChunkSubKey, m_socket->minChunk());
+    subConfig.insert(MaxChunkSubKey, m_socket->maxChunk());
+    config.insert(MainConfigKey, QVariant::fromValue(subConfig));
+}
+
+void LoadGenSocketPlugin::reconfigureImpl(const QVariantMap& config)
+{
+    auto subConfigVar = config.value(MainConfigKey);
+    if ((!subConfigVar.isValid()) || (!subConfigVar.canConvert<QVariantMap>())) {
+        return;
+    }
+
+    createSocketIfNeeded();
+
+    auto subConfig = subConfigVar.value<QVariantMap>();
+    auto readValueFunc =
+        [&subConfig](const QString& key, unsigned& value)
+        {
+            auto var = subConfig.value(key);
+            if (var.isValid() && var.canConvert<unsigned>()) {
+                value = var.value<unsigned>();
+            }
+        };
+
+    readValueFunc(RateSubKey, m_socket->rate());
+    readValueFunc(CorruptSubKey, m_socket->corruptPercent());
+    readValueFunc(MinChunkSubKey, m_socket->minChunk());
+    readValueFunc(MaxChunkSubKey, m_socket->maxChunk());
+
+    if (100U < m_socket->corruptPercent()) {
+        m_socket->corruptPercent() = 100U;
+    }
+}
+
+void LoadGenSocketPlugin::createSocketIfNeeded()
+{
+    if (!m_socket) {
+        m_socket.reset(new LoadGenSocket());
+    }
+}
+
+}  // namespace load_gen_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
+
+
@@ -0,0 +1,506 @@
+//
+// Copyright 2015 - 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "NativeSerialReader.h"
+
+#ifdef CC_SERIAL_SOCKET_NATIVE_READER
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <sys/ioctl.h>
+
+#ifdef __linux__
+#include <linux/serial.h>
+#endif
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace serial_socket
+{
+
+namespace
+{
+
+struct BaudMapEntry
+{
+    unsigned m_baud;
+    speed_t m_speed;
+};
+
+const BaudMapEntry BaudMap[] = {
+    {1200, B1200},
+    {2400, B2400},
+    {4800, B4800},
+    {9600, B9600},
+    {19200, B19200},
+    {38400, B38400},
+    {57600, B57600},
+    {115200, B115200},
+    {230400, B230400},
+#ifdef B460800
+    {460800, B460800},
+#endif
+#ifdef B921600
+    {921600, B921600},
+#endif
+#ifdef B1000000
+    {1000000, B1000000},
+#endif
+#ifdef B2000000
+    {2000000, B2000000},
+#endif
+#ifdef B3000000
+    {3000000, B3000000},
+#endif
+#ifdef B4000000
+    {4000000, B4000000},
+#endif
+};
+
+bool mapBaud(unsigned baud, speed_t& speed)
+{
+    auto iter =
+        std::find_if(
+            std::begin(BaudMap), std::end(BaudMap),
+            [baud](const BaudMapEntry& entry) -> bool
+            {
+                return entry.m_baud == baud;
+            });
+
+    if (iter == std::end(BaudMap)) {
+        return false;
+    }
+
+    speed = iter->m_speed;
+    return true;
+}
+
+tcflag_t mapDataBits(unsigned dataBits)
+{
+    switch (dataBits) {
+    case 5: return CS5;
+    case 6: return CS6;
+    case 7: return CS7;
+    default: break;
+    }
+    return CS8;
+}
+
+std::string errnoStr(const char* prefix)
+{
+    return std::string(prefix) + ": " + std::strerror(errno);
+}
+
+void requestLowLatency(int fd)
+{
+#ifdef __linux__
+    struct serial_struct serial;
+    if (::ioctl(fd, TIOCGSERIAL, &serial) != 0) {
+        return; // Not supported by the driver (pty, some USB adapters)
+    }
+
+    serial.flags |= ASYNC_LOW_LATENCY;
+    ::ioctl(fd, TIOCSSERIAL, &serial);
+#else
+    static_cast<void>(fd);
+#endif
+}
+
+}  // namespace
+
+NativeSerialReader::NativeSerialReader()
+  : m_stopRequested(false)
+{
+    m_wakePipe[0] = -1;
+    m_wakePipe[1] = -1;
+}
+
+NativeSerialReader::~NativeSerialReader() noexcept
+{
+    close();
+}
+
+bool NativeSerialReader::open(const Config& config, std::string& error)
+{
+    close();
+
+    speed_t speed = B0;
+    if (!mapBaud(config.m_baud, speed)) {
+        error = "Baud rate is not supported by native serial reader";
+        return false;
+    }
+
+    // Non-blocking descriptor: a read() after poll() mustn't wait for VMIN
+    // bytes, otherwise close() can't interrupt the reader thread.
+    auto fd = ::open(config.m_dev.c_str(), O_RDWR | O_NOCTTY | O_CLOEXEC | O_NONBLOCK);
+    if (fd < 0) {
+        error = errnoStr("Failed to open serial port");
+        return false;
+    }
+
+    struct termios tio;
+    if (::tcgetattr(fd, &tio) != 0) {
+        error = errnoStr("Failed to get serial port attributes");
+        ::close(fd);
+        return false;
+    }
+
+    ::cfmakeraw(&tio);
+    ::cfsetispeed(&tio, speed);
+    ::cfsetospeed(&tio, speed);
+
+    tio.c_cflag |= (CLOCAL | CREAD);
+    tio.c_cflag &= ~static_cast<tcflag_t>(CSIZE | PARENB | PARODD | CSTOPB | CRTSCTS);
+    tio.c_cflag |= mapDataBits(config.m_dataBits);
+#ifdef CMSPAR
+    tio.c_cflag &= ~static_cast<tcflag_t>(CMSPAR);
+#endif
+    switch (config.m_parity) {
+    case Parity::Even:
+        tio.c_cflag |= PARENB;
+        break;
+    case Parity::Odd:
+        tio.c_cflag |= (PARENB | PARODD);
+        break;
+#ifdef CMSPAR
+    case Parity::Space:
+        tio.c_cflag |= (PARENB | CMSPAR);
+        break;
+    case Parity::Mark:
+        tio.c_cflag |= (PARENB | PARODD | CMSPAR);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    if (config.m_stopBits == StopBits::Two) {
+        tio.c_cflag |= CSTOPB;
+    }
+
+    tio.c_iflag &= ~static_cast<tcflag_t>(IXON | IXOFF | IXANY);
+    if (config.m_flowControl == FlowControl::Hardware) {
+        tio.c_cflag |= CRTSCTS;
+    }
+    else if (config.m_flowControl == FlowControl::Software) {
+        tio.c_iflag |= (IXON | IXOFF);
+    }
+
+    tio.c_cc[VMIN] = static_cast<cc_t>(std::min(config.m_vmin, 255U));
+    tio.c_cc[VTIME] = static_cast<cc_t>(std::min(config.m_vtime, 255U));
+
+    if (::tcsetattr(fd, TCSANOW, &tio) != 0) {
+        error = errnoStr("Failed to set serial port attributes");
+        ::close(fd);
+        return false;
+    }
+
+    if (config.m_lowLatency) {
+        requestLowLatency(fd);
+    }
+
+    if (::pipe(m_wakePipe) != 0) {
+        error = errnoStr("Failed to create wake up pipe");
+        m_wakePipe[0] = -1;
+        m_wakePipe[1] = -1;
+        ::close(fd);
+        return false;
+    }
+
+    // Waking up the reader mustn't block the writing thread, while the
+    // reader drains all the pending wake ups at once.
+    for (auto pipeFd : m_wakePipe) {
+        ::fcntl(pipeFd, F_SETFL, ::fcntl(pipeFd, F_GETFL) | O_NONBLOCK);
+    }
+
+    ::tcflush(fd, TCIFLUSH);
+    m_fd = fd;
+    m_readSize = std::max(config.m_readSize, 1U);
+    m_maxWriteQueue = config.m_maxWriteQueue;
+    return true;
+}
+
+void NativeSerialReader::start(DataCallback&& dataCb, ErrorCallback&& errorCb)
+{
+    assert(isOpen());
+    assert(!m_thread.joinable());
+    m_dataCb = std::move(dataCb);
+    m_errorCb = std::move(errorCb);
+    m_stopRequested = false;
+    m_thread = std::thread(
+        [this]()
+        {
+            readLoop();
+        });
+}
+
+void NativeSerialReader::close()
+{
+    if (m_thread.joinable()) {
+        m_stopRequested = true;
+        wakeUp();
+        m_thread.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_writeLock);
+        m_writeQueue.clear();
+    }
+
+    for (auto& fd : m_wakePipe) {
+        if (0 <= fd) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    if (0 <= m_fd) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+bool NativeSerialReader::write(const std::uint8_t* buf, std::size_t len)
+{
+    std::lock_guard<std::mutex> guard(m_writeLock);
+    if (m_writeQueue.empty() && (!writeAvailable(buf, len))) {
+        return false;
+    }
+
+    if (len == 0U) {
+        return true;
+    }
+
+    if (m_maxWriteQueue < (m_writeQueue.size() + len)) {
+        return false;
+    }
+
+    auto wasEmpty = m_writeQueue.empty();
+    m_writeQueue.insert(m_writeQueue.end(), buf, buf + len);
+    if (wasEmpty) {
+        // Let the reader thread start polling for POLLOUT
+        wakeUp();
+    }
+    return true;
+}
+
+bool NativeSerialReader::writeAvailable(const std::uint8_t*& buf, std::size_t& len)
+{
+    while (0U < len) {
+        auto result = ::write(m_fd, buf, len);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return (errno == EAGAIN) || (errno == EWOULDBLOCK);
+        }
+
+        buf += result;
+        len -= static_cast<std::size_t>(result);
+    }
+    return true;
+}
+
+bool NativeSerialReader::flushWriteQueue()
+{
+    std::lock_guard<std::mutex> guard(m_writeLock);
+    if (m_writeQueue.empty()) {
+        return true;
+    }
+
+    const std::uint8_t* buf = &m_writeQueue[0];
+    std::size_t len = m_writeQueue.size();
+    auto result = writeAvailable(buf, len);
+    m_writeQueue.erase(
+        m_writeQueue.begin(),
+        m_writeQueue.begin() + static_cast<std::ptrdiff_t>(m_writeQueue.size() - len));
+    return result;
+}
+
+void NativeSerialReader::wakeUp()
+{
+    char wake = 0;
+    auto result = ::write(m_wakePipe[1], &wake, 1);
+    static_cast<void>(result);
+}
+
+void NativeSerialReader::readLoop()
+{
+    std::vector<std::uint8_t> buf(m_readSize);
+    struct pollfd fds[2];
+    fds[0].fd = m_fd;
+    fds[0].events = POLLIN;
+    fds[1].fd = m_wakePipe[0];
+    fds[1].events = POLLIN;
+
+    while (!m_stopRequested) {
+        fds[0].events = POLLIN;
+        {
+            std::lock_guard<std::mutex> guard(m_writeLock);
+            if (!m_writeQueue.empty()) {
+                fds[0].events |= POLLOUT;
+            }
+        }
+
+        fds[0].revents = 0;
+        fds[1].revents = 0;
+        auto pollResult = ::poll(fds, 2, -1);
+        if (pollResult < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if (m_errorCb) {
+                m_errorCb(errnoStr("Serial port poll failed"));
+            }
+            break;
+        }
+
+        if (fds[1].revents != 0) {
+            char wake[64];
+            while (0 < ::read(m_wakePipe[0], wake, sizeof(wake))) {}
+        }
+
+        if (m_stopRequested) {
+            break;
+        }
+
+        if ((fds[0].revents & (POLLERR | POLLHUP | POLLNVAL)) != 0) {
+            if (m_errorCb) {
+                m_errorCb("Serial port has been closed");
+            }
+            break;
+        }
+
+        if (((fds[0].revents & POLLOUT) != 0) && (!flushWriteQueue())) {
+            if (m_errorCb) {
+                m_errorCb(errnoStr("Serial port write failed"));
+            }
+            break;
+        }
+
+        if (((fds[0].revents & POLLIN) != 0) && (!drain(buf))) {
+            break;
+        }
+    }
+}
+
+bool NativeSerialReader::drain(std::vector<std::uint8_t>& buf)
+{
+    while (!m_stopRequested) {
+        auto len = ::read(m_fd, &buf[0], buf.size());
+        auto timestamp = Clock::now();
+        if (len < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                return true;
+            }
+
+            if (m_errorCb) {
+                m_errorCb(errnoStr("Serial port read failed"));
+            }
+            return false;
+        }
+
+        if (len == 0) {
+            return true;
+        }
+
+        if (m_dataCb) {
+            m_dataCb(&buf[0], static_cast<std::size_t>(len), timestamp);
+        }
+    }
+    return true;
+}
+
+}  // namespace serial_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
+
+#else // #ifdef CC_SERIAL_SOCKET_NATIVE_READER
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace serial_socket
+{
+
+NativeSerialReader::NativeSerialReader()
+  : m_stopRequested(false)
+{
+    m_wakePipe[0] = -1;
+    m_wakePipe[1] = -1;
+}
+
+NativeSerialReader::~NativeSerialReader() noexcept = default;
+
+bool NativeSerialReader::open(const Config& config, std::string& error)
+{
+    static_cast<void>(config);
+    error = "Native serial reader is not supported on this platform";
+    return false;
+}
+
+void NativeSerialReader::start(DataCallback&& dataCb, ErrorCallback&& errorCb)
+{
+    static_cast<void>(dataCb);
+    static_cast<void>(errorCb);
+}
+
+void NativeSerialReader::close()
+{
+}
+
+bool NativeSerialReader::write(const std::uint8_t* buf, std::size_t len)
+{
+    static_cast<void>(buf);
+    static_cast<void>(len);
+    return false;
+}
+
+void NativeSerialReader::readLoop()
+{
+}
+
+}  // namespace serial_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
+
+#endif // #ifdef CC_SERIAL_SOCKET_NATIVE_READER
@@ -0,0 +1,151 @@
+//
+// Copyright 2015 - 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <functional>
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace serial_socket
+{
+
+/// @brief Serial port reader based on native termios API.
+/// @details Waits for the data with @b poll() on dedicated thread, drains
+///     the non-blocking descriptor and timestamps every chunk right after
+///     @b read() returns, bypassing Qt event loop and QSerialPort buffering.
+///     The configured VMIN and VTIME values influence only the wake up of
+///     @b poll() (with VTIME being 0 it waits for VMIN bytes), the reads
+///     never block, so the reader can always be stopped by @ref close().
+///     The written data that can't be accepted by the driver immediately
+///     (for example when the peer holds the flow control) is queued and
+///     written by the same thread when the device becomes writable, so
+///     @ref write() never blocks the caller.
+class NativeSerialReader
+{
+public:
+    using Clock = std::chrono::high_resolution_clock;
+    using Timestamp = std::chrono::time_point<Clock>;
+
+    enum class Parity
+    {
+        None,
+        Even,
+        Odd,
+        Space,
+        Mark
+    };
+
+    enum class StopBits
+    {
+        One,
+        Two
+    };
+
+    enum class FlowControl
+    {
+        None,
+        Hardware,
+        Software
+    };
+
+    struct Config
+    {
+        std::string m_dev;
+        unsigned m_baud = 115200;
+        unsigned m_dataBits = 8;
+        Parity m_parity = Parity::None;
+        StopBits m_stopBits = StopBits::One;
+        FlowControl m_flowControl = FlowControl::None;
+        unsigned m_readSize = 4096; ///< Max number of bytes per read() call
+        unsigned m_vmin = 1; ///< termios VMIN, number of bytes to wake up on
+        unsigned m_vtime = 0; ///< termios VTIME (in 1/10 of second), with non-zero
+                              ///< value the reader wakes up on the first byte
+        bool m_lowLatency = true; ///< Request ASYNC_LOW_LATENCY from the driver
+        std::size_t m_maxWriteQueue = 1024 * 1024; ///< Max number of bytes waiting to be written
+    };
+
+    /// @brief Callback invoked on reader thread for every read chunk.
+    using DataCallback =
+        std::function<void (const std::uint8_t* buf, std::size_t len, const Timestamp& timestamp)>;
+
+    /// @brief Callback invoked on reader thread when read or write error occurs.
+    using ErrorCallback = std::function<void (const std::string& msg)>;
+
+    NativeSerialReader();
+    ~NativeSerialReader() noexcept;
+
+    /// @brief Open and configure the device.
+    /// @param[in] config Configuration
+    /// @param[out] error Error description in case of failure
+    bool open(const Config& config, std::string& error);
+
+    /// @brief Start reader thread.
+    void start(DataCallback&& dataCb, ErrorCallback&& errorCb);
+
+    /// @brief Stop reader thread and close the device.
+    void close();
+
+    /// @brief Check the device is open.
+    bool isOpen() const
+    {
+        return 0 <= m_fd;
+    }
+
+    /// @brief Write data to the device.
+    /// @details Writes as much as the driver accepts without blocking,
+    ///     the rest is queued to be written by the reader thread.
+    /// @return false in case of write error or when the data doesn't fit
+    ///     into the write queue (see @ref Config::m_maxWriteQueue).
+    bool write(const std::uint8_t* buf, std::size_t len);
+
+private:
+    void readLoop();
+    bool drain(std::vector<std::uint8_t>& buf);
+    bool writeAvailable(const std::uint8_t*& buf, std::size_t& len);
+    bool flushWriteQueue();
+    void wakeUp();
+
+    int m_fd = -1;
+    int m_wakePipe[2];
+    std::size_t m_readSize = 4096;
+    std::thread m_thread;
+    std::atomic<bool> m_stopRequested;
+    std::mutex m_writeLock;
+    std::vector<std::uint8_t> m_writeQueue;
+    std::size_t m_maxWriteQueue = 0U;
+    DataCallback m_dataCb;
+    ErrorCallback m_errorCb;
+};
+
+}  // namespace serial_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
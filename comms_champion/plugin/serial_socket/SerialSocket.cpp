@@ -22,8 +22,11 @@
 
 CC_DISABLE_WARNINGS()
 #include <QtSerialPort/QSerialPortInfo>
+#include <QtCore/QMetaObject>
 CC_ENABLE_WARNINGS()
 
+#include "NativeSerialReader.h"
+
 #include <algorithm>
 
 namespace comms_champion
@@ -58,10 +61,26 @@ SerialSocket::SerialSocket()
         this, SLOT(performRead()));
 }
 
-SerialSocket::~SerialSocket() noexcept = default;
+SerialSocket::~SerialSocket() noexcept
+{
+    nativeDisconnect();
+}
+
+bool SerialSocket::isLowLatencySupported()
+{
+#ifdef CC_SERIAL_SOCKET_NATIVE_READER
+    return true;
+#else
+    return false;
+#endif
+}
 
 bool SerialSocket::socketConnectImpl()
 {
+    if (m_lowLatency && isLowLatencySupported()) {
+        return nativeConnect();
+    }
+
     m_serial.setPortName(m_name);
     if (!m_serial.open(QSerialPort::ReadWrite)) {
         static const QString FailedToOpenError(
@@ -81,6 +100,11 @@ bool SerialSocket::socketConnectImpl()
 
 void SerialSocket::socketDisconnectImpl()
 {
+    if (m_native) {
+        nativeDisconnect();
+        return;
+    }
+
     if (!m_serial.isOpen()) {
         return;
     }
@@ -91,6 +115,15 @@ void SerialSocket::socketDisconnectImpl()
 void SerialSocket::sendDataImpl(DataInfoPtr dataPtr)
 {
     assert(dataPtr);
+    if (m_native) {
+        if (!m_native->write(&dataPtr->m_data[0], dataPtr->m_data.size())) {
+            static const QString WriteError(
+                tr("Failed to write to serial port."));
+            reportError(WriteError);
+        }
+        return;
+    }
+
     m_serial.write(
         reinterpret_cast<const char*>(&dataPtr->m_data[0]),
         dataPtr->m_data.size());
@@ -128,6 +161,127 @@ void SerialSocket::errorOccurred(QSerialPort::SerialPortError err)
     }
 }
 
+void SerialSocket::reportNativePending()
+{
+    DataInfosList pending;
+    QString error;
+    {
+        std::lock_guard<std::mutex> guard(m_nativeLock);
+        pending.swap(m_nativePending);
+        error.swap(m_nativeError);
+        m_nativeReportScheduled = false;
+    }
+
+    for (auto& dataPtr : pending) {
+        reportDataReceived(std::move(dataPtr));
+    }
+
+    if (error.isEmpty() || (!m_native)) {
+        return;
+    }
+
+    reportError(error);
+    nativeDisconnect();
+    reportDisconnected();
+}
+
+bool SerialSocket::nativeConnect()
+{
+#ifdef CC_SERIAL_SOCKET_NATIVE_READER
+    auto config = NativeSerialReader::Config();
+    config.m_dev = m_name.toStdString();
+    config.m_baud = static_cast<unsigned>(m_baud);
+    config.m_dataBits = static_cast<unsigned>(m_dataBits);
+    config.m_readSize = m_readSize;
+    config.m_vmin = m_vmin;
+    config.m_vtime = m_vtime;
+
+    switch (m_parity) {
+    case QSerialPort::EvenParity:
+        config.m_parity = NativeSerialReader::Parity::Even;
+        break;
+    case QSerialPort::OddParity:
+        config.m_parity = NativeSerialReader::Parity::Odd;
+        break;
+    case QSerialPort::SpaceParity:
+        config.m_parity = NativeSerialReader::Parity::Space;
+        break;
+    case QSerialPort::MarkParity:
+        config.m_parity = NativeSerialReader::Parity::Mark;
+        break;
+    default:
+        break;
+    }
+
+    if (m_stopBits != QSerialPort::OneStop) {
+        config.m_stopBits = NativeSerialReader::StopBits::Two;
+    }
+
+    if (m_flowControl == QSerialPort::HardwareControl) {
+        config.m_flowControl = NativeSerialReader::FlowControl::Hardware;
+    }
+    else if (m_flowControl == QSerialPort::SoftwareControl) {
+        config.m_flowControl = NativeSerialReader::FlowControl::Software;
+    }
+
+    std::unique_ptr<NativeSerialReader> native(new NativeSerialReader());
+    std::string error;
+    if (!native->open(config, error)) {
+        reportError(QString::fromStdString(error));
+        return false;
+    }
+
+    auto scheduleReportFunc =
+        [this]()
+        {
+            // Expected to be invoked with m_nativeLock locked
+            if (m_nativeReportScheduled) {
+                return;
+            }
+
+            m_nativeReportScheduled = true;
+            QMetaObject::invokeMethod(this, "reportNativePending", Qt::QueuedConnection);
+        };
+
+    native->start(
+        [this, scheduleReportFunc](const std::uint8_t* buf, std::size_t len, const NativeSerialReader::Timestamp& timestamp)
+        {
+            auto dataPtr = makeDataInfo();
+            dataPtr->m_timestamp = timestamp;
+            dataPtr->m_data.assign(buf, buf + len);
+
+            std::lock_guard<std::mutex> guard(m_nativeLock);
+            m_nativePending.push_back(std::move(dataPtr));
+            scheduleReportFunc();
+        },
+        [this, scheduleReportFunc](const std::string& msg)
+        {
+            std::lock_guard<std::mutex> guard(m_nativeLock);
+            m_nativeError = QString::fromStdString(msg);
+            scheduleReportFunc();
+        });
+
+    m_native = std::move(native);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void SerialSocket::nativeDisconnect()
+{
+    if (!m_native) {
+        return;
+    }
+
+    m_native->close();
+    m_native.reset();
+
+    std::lock_guard<std::mutex> guard(m_nativeLock);
+    m_nativePending.clear();
+    m_nativeError.clear();
+}
+
 }  // namespace serial_socket
 
 } // namespace plugin
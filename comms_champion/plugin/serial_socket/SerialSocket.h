@@ -18,6 +18,8 @@
 #pragma once
 
 #include <list>
+#include <memory>
+#include <mutex>
 
 #include "comms/CompileControl.h"
 
@@ -38,6 +40,8 @@ namespace plugin
 namespace serial_socket
 {
 
+class NativeSerialReader;
+
 class SerialSocket : public QObject,
                      public comms_champion::Socket
 {
@@ -85,6 +89,28 @@ public:
         return m_flowControl;
     }
 
+    bool& lowLatency()
+    {
+        return m_lowLatency;
+    }
+
+    unsigned& readSize()
+    {
+        return m_readSize;
+    }
+
+    unsigned& vmin()
+    {
+        return m_vmin;
+    }
+
+    unsigned& vtime()
+    {
+        return m_vtime;
+    }
+
+    static bool isLowLatencySupported();
+
 protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
@@ -93,8 +119,14 @@ protected:
 private slots:
     void performRead();
     void errorOccurred(QSerialPort::SerialPortError err);
+    void reportNativePending();
 
 private:
+    using DataInfosList = std::list<DataInfoPtr>;
+
+    bool nativeConnect();
+    void nativeDisconnect();
+
     QSerialPort m_serial;
     QString m_name;
     Baud m_baud = 115200;
@@ -102,6 +134,16 @@ private:
     Parity m_parity = Parity::NoParity;
     StopBits m_stopBits = StopBits::OneStop;
     FlowControl m_flowControl = FlowControl::NoFlowControl;
+    bool m_lowLatency = false;
+    unsigned m_readSize = 4096U;
+    unsigned m_vmin = 1U;
+    unsigned m_vtime = 0U;
+
+    std::unique_ptr<NativeSerialReader> m_native;
+    std::mutex m_nativeLock;
+    DataInfosList m_nativePending;
+    QString m_nativeError;
+    bool m_nativeReportScheduled = false;
 };
 
 }  // namespace serial_socket
@@ -121,6 +121,11 @@ SerialSocketConfigWidget::SerialSocketConfigWidget(
     m_ui.m_parityComboBox->setCurrentIndex(mapParityToIdx(m_socket.parity()));
     m_ui.m_stopBitsComboBox->setCurrentIndex(mapStopBitToIdx(m_socket.stopBits()));
     m_ui.m_flowComboBox->setCurrentIndex(mapFlowControlToIdx(m_socket.flowControl()));
+    m_ui.m_lowLatencyCheckBox->setChecked(m_socket.lowLatency());
+    m_ui.m_lowLatencyCheckBox->setEnabled(SerialSocket::isLowLatencySupported());
+    m_ui.m_readSizeSpinBox->setValue(static_cast<int>(m_socket.readSize()));
+    m_ui.m_vminSpinBox->setValue(static_cast<int>(m_socket.vmin()));
+    m_ui.m_vtimeSpinBox->setValue(static_cast<int>(m_socket.vtime()));
 
     connect(
         m_ui.m_deviceLineEdit, SIGNAL(textEdited(const QString&)),
@@ -145,6 +150,22 @@ SerialSocketConfigWidget::SerialSocketConfigWidget(
     connect(
         m_ui.m_flowComboBox, SIGNAL(currentIndexChanged(int)),
         this, SLOT(flowControlChanged(int)));
+
+    connect(
+        m_ui.m_lowLatencyCheckBox, SIGNAL(stateChanged(int)),
+        this, SLOT(lowLatencyChanged(int)));
+
+    connect(
+        m_ui.m_readSizeSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(readSizeChanged(int)));
+
+    connect(
+        m_ui.m_vminSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(vminChanged(int)));
+
+    connect(
+        m_ui.m_vtimeSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(vtimeChanged(int)));
 }
 
 SerialSocketConfigWidget::~SerialSocketConfigWidget() noexcept = default;
@@ -179,6 +200,26 @@ void SerialSocketConfigWidget::flowControlChanged(int value)
     m_socket.flowControl() = mapFlowControlFromIdx(value);
 }
 
+void SerialSocketConfigWidget::lowLatencyChanged(int value)
+{
+    m_socket.lowLatency() = (value != Qt::Unchecked);
+}
+
+void SerialSocketConfigWidget::readSizeChanged(int value)
+{
+    m_socket.readSize() = static_cast<unsigned>(value);
+}
+
+void SerialSocketConfigWidget::vminChanged(int value)
+{
+    m_socket.vmin() = static_cast<unsigned>(value);
+}
+
+void SerialSocketConfigWidget::vtimeChanged(int value)
+{
+    m_socket.vtime() = static_cast<unsigned>(value);
+}
+
 }  // namespace serial_socket
 
 }  // namespace plugin
@@ -54,6 +54,10 @@ private slots:
     void parityChanged(int value);
     void stopBitsChanged(int value);
     void flowControlChanged(int value);
+    void lowLatencyChanged(int value);
+    void readSizeChanged(int value);
+    void vminChanged(int value);
+    void vtimeChanged(int value);
 
 private:
     SerialSocket& m_socket;
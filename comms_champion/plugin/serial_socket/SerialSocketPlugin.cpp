@@ -42,6 +42,10 @@ const QString DataBitsSubKey("data_bits");
 const QString ParitySubKey("parity");
 const QString StopBitsSubKey("stop_bits");
 const QString FlowControlSubKey("flow");
+const QString LowLatencySubKey("low_latency");
+const QString ReadSizeSubKey("read_size");
+const QString VminSubKey("vmin");
+const QString VtimeSubKey("vtime");
 
 }  // namespace
 
@@ -75,6 +79,10 @@ void SerialSocketPlugin::getCurrentConfigImpl(QVariantMap& config)
     subConfig.insert(ParitySubKey, static_cast<int>(m_socket->parity()));
     subConfig.insert(StopBitsSubKey, static_cast<int>(m_socket->stopBits()));
     subConfig.insert(FlowControlSubKey, static_cast<int>(m_socket->flowControl()));
+    subConfig.insert(LowLatencySubKey, m_socket->lowLatency());
+    subConfig.insert(ReadSizeSubKey, m_socket->readSize());
+    subConfig.insert(VminSubKey, m_socket->vmin());
+    subConfig.insert(VtimeSubKey, m_socket->vtime());
     config.insert(MainConfigKey, QVariant::fromValue(subConfig));
 }
 
@@ -134,6 +142,35 @@ void SerialSocketPlugin::reconfigureImpl(const QVariantMap& config)
             m_socket->flowControl() = flow;
         }
     }
+
+    auto lowLatencyVar = subConfig.value(LowLatencySubKey);
+    if (lowLatencyVar.isValid() && lowLatencyVar.canConvert<bool>()) {
+        m_socket->lowLatency() = lowLatencyVar.toBool();
+    }
+
+    auto readSizeVar = subConfig.value(ReadSizeSubKey);
+    if (readSizeVar.isValid() && readSizeVar.canConvert<unsigned>()) {
+        auto readSize = readSizeVar.value<unsigned>();
+        if (0U < readSize) {
+            m_socket->readSize() = readSize;
+        }
+    }
+
+    auto vminVar = subConfig.value(VminSubKey);
+    if (vminVar.isValid() && vminVar.canConvert<unsigned>()) {
+        auto vmin = vminVar.value<unsigned>();
+        if (vmin <= 255U) {
+            m_socket->vmin() = vmin;
+        }
+    }
+
+    auto vtimeVar = subConfig.value(VtimeSubKey);
+    if (vtimeVar.isValid() && vtimeVar.canConvert<unsigned>()) {
+        auto vtime = vtimeVar.value<unsigned>();
+        if (vtime <= 255U) {
+            m_socket->vtime() = vtime;
+        }
+    }
 }
 
 void SerialSocketPlugin::createSocketIfNeeded()
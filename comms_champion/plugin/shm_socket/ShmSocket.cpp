@@ -0,0 +1,209 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "ShmSocket.h"
+
+#include <cassert>
+#include <algorithm>
+#include <chrono>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QMetaObject>
+CC_ENABLE_WARNINGS()
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace shm_socket
+{
+
+namespace
+{
+
+const unsigned WaitTimeoutMs = 100U;
+const std::size_t MaxPendingChunks = 1024U;
+
+}  // namespace
+
+ShmSocket::ShmSocket()
+  : m_name("/cc_shm_ring"),
+    m_stopRequested(false)
+{
+}
+
+ShmSocket::~ShmSocket() noexcept
+{
+    socketDisconnectImpl();
+}
+
+bool ShmSocket::socketConnectImpl()
+{
+    if (m_header != nullptr) {
+        assert(!"Already connected.");
+        return false;
+    }
+
+    auto nameStr = m_name.toStdString();
+    auto fd = ::shm_open(nameStr.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        static const QString FailedToOpenError(
+            tr("Failed to open shared memory object, make sure producer has created it."));
+        reportError(FailedToOpenError);
+        return false;
+    }
+
+    struct stat info;
+    if ((::fstat(fd, &info) != 0) ||
+        (static_cast<std::size_t>(info.st_size) < sizeof(cc_shm_socket::ShmRingHeader))) {
+        ::close(fd);
+        static const QString InvalidSizeError(
+            tr("Invalid size of the shared memory object."));
+        reportError(InvalidSizeError);
+        return false;
+    }
+
+    auto size = static_cast<std::size_t>(info.st_size);
+    auto* mem = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED) {
+        static const QString FailedToMapError(
+            tr("Failed to map shared memory object."));
+        reportError(FailedToMapError);
+        return false;
+    }
+
+    m_header = reinterpret_cast<cc_shm_socket::ShmRingHeader*>(mem);
+    m_mappedSize = size;
+    if (!cc_shm_socket::shmRingIsValid(*m_header, m_mappedSize)) {
+        unmap();
+        static const QString InvalidHeaderError(
+            tr("Shared memory object doesn't contain valid ring."));
+        reportError(InvalidHeaderError);
+        return false;
+    }
+
+    m_stopRequested = false;
+    m_thread = std::thread(
+        [this]()
+        {
+            readLoop();
+        });
+    return true;
+}
+
+void ShmSocket::socketDisconnectImpl()
+{
+    if (m_thread.joinable()) {
+        m_stopRequested = true;
+        m_thread.join();
+    }
+
+    unmap();
+
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_pending.clear();
+}
+
+void ShmSocket::sendDataImpl(DataInfoPtr dataPtr)
+{
+    // The ring is unidirectional, outgoing data is dropped.
+    static_cast<void>(dataPtr);
+}
+
+void ShmSocket::reportPending()
+{
+    DataInfosList pending;
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        pending.swap(m_pending);
+        m_reportScheduled = false;
+    }
+
+    for (auto& dataPtr : pending) {
+        reportDataReceived(std::move(dataPtr));
+    }
+}
+
+void ShmSocket::readLoop()
+{
+    assert(m_header != nullptr);
+    auto& header = *m_header;
+    auto batchSize = static_cast<std::size_t>(std::max(m_batchSize, 1U));
+    while (!m_stopRequested) {
+        auto available = cc_shm_socket::shmRingAvailable(header);
+        if (available == 0U) {
+            cc_shm_socket::shmRingWait(header, WaitTimeoutMs);
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if (MaxPendingChunks <= m_pending.size()) {
+                // Let the ring fill up and slow down the producer
+                // rather than accumulating data in memory.
+                available = 0U;
+            }
+        }
+
+        if (available == 0U) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        auto dataPtr = makeDataInfo();
+        dataPtr->m_data.resize(std::min(available, batchSize));
+        auto len = cc_shm_socket::shmRingRead(header, &dataPtr->m_data[0], dataPtr->m_data.size());
+        dataPtr->m_data.resize(len);
+        dataPtr->m_timestamp = DataInfo::TimestampClock::now();
+
+        bool scheduleReport = false;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_pending.push_back(std::move(dataPtr));
+            scheduleReport = !m_reportScheduled;
+            m_reportScheduled = true;
+        }
+
+        if (scheduleReport) {
+            QMetaObject::invokeMethod(this, "reportPending", Qt::QueuedConnection);
+        }
+    }
+}
+
+void ShmSocket::unmap()
+{
+    if (m_header == nullptr) {
+        return;
+    }
+
+    ::munmap(m_header, m_mappedSize);
+    m_header = nullptr;
+    m_mappedSize = 0U;
+}
+
+}  // namespace shm_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
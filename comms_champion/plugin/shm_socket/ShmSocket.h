@@ -0,0 +1,92 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <list>
+
+#include "comms/CompileControl.h"
+CC_DISABLE_WARNINGS()
+#include <QtCore/QObject>
+#include <QtCore/QString>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Socket.h"
+#include "cc_shm_socket/ShmRing.h"
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace shm_socket
+{
+
+class ShmSocket : public QObject,
+                  public comms_champion::Socket
+{
+    Q_OBJECT
+    using Base = comms_champion::Socket;
+
+public:
+    ShmSocket();
+    ~ShmSocket() noexcept;
+
+    QString& name()
+    {
+        return m_name;
+    }
+
+    unsigned& batchSize()
+    {
+        return m_batchSize;
+    }
+
+protected:
+    virtual bool socketConnectImpl() override;
+    virtual void socketDisconnectImpl() override;
+    virtual void sendDataImpl(DataInfoPtr dataPtr) override;
+
+private slots:
+    void reportPending();
+
+private:
+    using DataInfosList = std::list<DataInfoPtr>;
+
+    void readLoop();
+    void unmap();
+
+    QString m_name;
+    unsigned m_batchSize = 64U * 1024U;
+    cc_shm_socket::ShmRingHeader* m_header = nullptr;
+    std::size_t m_mappedSize = 0U;
+    std::thread m_thread;
+    std::atomic<bool> m_stopRequested;
+    std::mutex m_lock;
+    DataInfosList m_pending;
+    bool m_reportScheduled = false;
+};
+
+}  // namespace shm_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
@@ -0,0 +1,101 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "ShmSocketPlugin.h"
+
+#include <memory>
+#include <cassert>
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace shm_socket
+{
+
+namespace
+{
+
+const QString MainConfigKey("cc_shm_socket");
+const QString NameSubKey("name");
+const QString BatchSizeSubKey("batch_size");
+
+}  // namespace
+
+ShmSocketPlugin::ShmSocketPlugin()
+{
+    pluginProperties()
+        .setSocketCreateFunc(
+            [this]()
+            {
+                createSocketIfNeeded();
+                return m_socket;
+            });
+}
+
+ShmSocketPlugin::~ShmSocketPlugin() noexcept = default;
+
+void ShmSocketPlugin::getCurrentConfigImpl(QVariantMap& config)
+{
+    createSocketIfNeeded();
+
+    QVariantMap subConfig;
+    subConfig.insert(NameSubKey, m_socket->name());
+    subConfig.insert(BatchSizeSubKey, m_socket->batchSize());
+    config.insert(MainConfigKey, QVariant::fromValue(subConfig));
+}
+
+void ShmSocketPlugin::reconfigureImpl(const QVariantMap& config)
+{
+    auto subConfigVar = config.value(MainConfigKey);
+    if ((!subConfigVar.isValid()) || (!subConfigVar.canConvert<QVariantMap>())) {
+        return;
+    }
+
+    createSocketIfNeeded();
+
+    auto subConfig = subConfigVar.value<QVariantMap>();
+    auto nameVar = subConfig.value(NameSubKey);
+    if (nameVar.isValid() && nameVar.canConvert<QString>()) {
+        m_socket->name() = nameVar.toString();
+    }
+
+    auto batchSizeVar = subConfig.value(BatchSizeSubKey);
+    if (batchSizeVar.isValid() && batchSizeVar.canConvert<unsigned>()) {
+        auto batchSize = batchSizeVar.value<unsigned>();
+        if (0U < batchSize) {
+            m_socket->batchSize() = batchSize;
+        }
+    }
+}
+
+void ShmSocketPlugin::createSocketIfNeeded()
+{
+    if (!m_socket) {
+        m_socket.reset(new ShmSocket());
+    }
+}
+
+}  // namespace shm_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
+
+
@@ -0,0 +1,191 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Loopback throughput comparison between the shared memory ring and
+// TCP/IP connection (the transport used by "tcp_client_socket" plugin).
+// Usage: shm_socket_bench [frame_size] [frames_count]
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include "cc_shm_socket/ShmRingProducer.h"
+
+namespace
+{
+
+typedef std::chrono::high_resolution_clock Clock;
+const std::size_t ReadBufSize = 64 * 1024;
+
+double mbPerSec(std::size_t bytes, Clock::duration duration)
+{
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    if (us <= 0) {
+        return 0.0;
+    }
+    return (static_cast<double>(bytes) / (1024.0 * 1024.0)) / (static_cast<double>(us) / 1000000.0);
+}
+
+void report(const char* name, std::size_t frameSize, std::size_t count, Clock::duration duration)
+{
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    std::cout << name << ": " << count << " frames of " << frameSize << " bytes in "
+              << us << " us, " << mbPerSec(frameSize * count, duration) << " MB/s, "
+              << (static_cast<double>(count) * 1000000.0) / static_cast<double>(std::max<long long>(us, 1))
+              << " frames/s" << std::endl;
+}
+
+Clock::duration benchShm(const std::vector<std::uint8_t>& frame, std::size_t count)
+{
+    static const std::string Name("/cc_shm_socket_bench");
+    cc_shm_socket::ShmRingProducer producer;
+    if (!producer.create(Name, 1U << 20)) {
+        std::cerr << "ERROR: Failed to create shared memory" << std::endl;
+        std::exit(1);
+    }
+
+    auto fd = ::shm_open(Name.c_str(), O_RDWR, 0);
+    auto size = cc_shm_socket::shmRingTotalSize(1U << 20);
+    auto* mem = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED) {
+        std::cerr << "ERROR: Failed to map shared memory" << std::endl;
+        std::exit(1);
+    }
+    auto& header = *reinterpret_cast<cc_shm_socket::ShmRingHeader*>(mem);
+
+    auto total = frame.size() * count;
+    auto start = Clock::now();
+    std::thread consumer(
+        [&header, total]()
+        {
+            std::vector<std::uint8_t> buf(ReadBufSize);
+            std::size_t received = 0U;
+            while (received < total) {
+                auto len = cc_shm_socket::shmRingRead(header, &buf[0], buf.size());
+                if (len == 0U) {
+                    cc_shm_socket::shmRingWait(header, 100);
+                    continue;
+                }
+                received += len;
+            }
+        });
+
+    for (auto idx = 0U; idx < count; ++idx) {
+        producer.write(&frame[0], frame.size());
+    }
+
+    consumer.join();
+    auto duration = Clock::now() - start;
+    ::munmap(mem, size);
+    return duration;
+}
+
+Clock::duration benchTcp(const std::vector<std::uint8_t>& frame, std::size_t count)
+{
+    auto listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr = sockaddr_in();
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    socklen_t addrLen = sizeof(addr);
+    if ((::bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) ||
+        (::listen(listenFd, 1) != 0) ||
+        (::getsockname(listenFd, reinterpret_cast<sockaddr*>(&addr), &addrLen) != 0)) {
+        std::cerr << "ERROR: Failed to listen on loopback" << std::endl;
+        std::exit(1);
+    }
+
+    auto total = frame.size() * count;
+    auto start = Clock::now();
+    std::thread consumer(
+        [listenFd, total]()
+        {
+            auto fd = ::accept(listenFd, nullptr, nullptr);
+            std::vector<std::uint8_t> buf(ReadBufSize);
+            std::size_t received = 0U;
+            while (received < total) {
+                auto len = ::read(fd, &buf[0], buf.size());
+                if (len <= 0) {
+                    break;
+                }
+                received += static_cast<std::size_t>(len);
+            }
+            ::close(fd);
+        });
+
+    auto fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    int noDelay = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        std::cerr << "ERROR: Failed to connect on loopback" << std::endl;
+        std::exit(1);
+    }
+
+    for (auto idx = 0U; idx < count; ++idx) {
+        std::size_t written = 0U;
+        while (written < frame.size()) {
+            auto len = ::write(fd, &frame[written], frame.size() - written);
+            if (len <= 0) {
+                std::exit(1);
+            }
+            written += static_cast<std::size_t>(len);
+        }
+    }
+
+    consumer.join();
+    auto duration = Clock::now() - start;
+    ::close(fd);
+    ::close(listenFd);
+    return duration;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t frameSize = 64;
+    std::size_t count = 1000000;
+    if (1 < argc) {
+        frameSize = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    if (2 < argc) {
+        count = static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+
+    if ((frameSize == 0U) || (count == 0U)) {
+        std::cerr << "Usage: " << argv[0] << " [frame_size] [frames_count]" << std::endl;
+        return -1;
+    }
+
+    std::vector<std::uint8_t> frame(frameSize);
+    for (auto idx = 0U; idx < frameSize; ++idx) {
+        frame[idx] = static_cast<std::uint8_t>(idx);
+    }
+
+    report("shm", frameSize, count, benchShm(frame, count));
+    report("tcp", frameSize, count, benchTcp(frame, count));
+    return 0;
+}
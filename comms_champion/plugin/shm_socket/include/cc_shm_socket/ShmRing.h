@@ -0,0 +1,194 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Layout of the shared memory single producer / single consumer
+///     byte ring used by the "Shared Memory Socket" plugin.
+/// @details The shared memory object consists of @ref cc_shm_socket::ShmRingHeader
+///     immediately followed by the data area of @b m_capacity bytes
+///     (power of 2). The ring transfers a plain byte stream, the framing
+///     is the responsibility of the protocol plugin, just like with any other
+///     stream socket.
+///
+///     @b m_writePos and @b m_readPos are monotonically increasing total
+///     byte counters, the offset in the data area is the counter modulo
+///     capacity. Only the producer updates @b m_writePos (release
+///     semantics after the data is copied) and only the consumer updates
+///     @b m_readPos. When the consumer finds the ring empty it sets
+///     @b m_consumerWaiting and sleeps on the @b m_wakeSeq futex word. The
+///     producer increments @b m_wakeSeq and wakes the consumer up only when
+///     the latter is waiting, so no system call is performed per message
+///     while the data is flowing.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <time.h>
+
+namespace cc_shm_socket
+{
+
+/// @brief Magic value at the beginning of the shared memory object ("CCSR").
+static const std::uint32_t ShmRingMagic = 0x52534343;
+
+/// @brief Version of the layout.
+static const std::uint32_t ShmRingVersion = 1U;
+
+/// @brief Header of the shared memory ring.
+struct ShmRingHeader
+{
+    std::uint32_t m_magic; ///< Must be equal to @ref ShmRingMagic
+    std::uint32_t m_version; ///< Must be equal to @ref ShmRingVersion
+    std::uint64_t m_capacity; ///< Size of the data area, power of 2
+
+    alignas(64) std::atomic<std::uint64_t> m_writePos; ///< Total bytes written by producer
+    std::atomic<std::uint32_t> m_wakeSeq; ///< Futex word used for wake ups
+    std::atomic<std::uint32_t> m_consumerWaiting; ///< Consumer sleeps on @b m_wakeSeq
+
+    alignas(64) std::atomic<std::uint64_t> m_readPos; ///< Total bytes consumed by consumer
+};
+
+static_assert(sizeof(ShmRingHeader) % 64 == 0, "Data area must be cache line aligned");
+
+/// @brief Total size of shared memory object required for the provided capacity.
+inline std::size_t shmRingTotalSize(std::uint64_t capacity)
+{
+    return sizeof(ShmRingHeader) + static_cast<std::size_t>(capacity);
+}
+
+/// @brief Access the data area that follows the header.
+inline std::uint8_t* shmRingData(ShmRingHeader& header)
+{
+    return reinterpret_cast<std::uint8_t*>(&header + 1);
+}
+
+/// @brief Check the header is valid and matches the mapped size.
+inline bool shmRingIsValid(const ShmRingHeader& header, std::size_t mappedSize)
+{
+    return
+        (header.m_magic == ShmRingMagic) &&
+        (header.m_version == ShmRingVersion) &&
+        (header.m_capacity != 0U) &&
+        ((header.m_capacity & (header.m_capacity - 1)) == 0U) &&
+        (shmRingTotalSize(header.m_capacity) <= mappedSize);
+}
+
+/// @brief Initialise header of newly created ring.
+inline void shmRingInit(ShmRingHeader& header, std::uint64_t capacity)
+{
+    header.m_capacity = capacity;
+    header.m_writePos.store(0U, std::memory_order_relaxed);
+    header.m_wakeSeq.store(0U, std::memory_order_relaxed);
+    header.m_consumerWaiting.store(0U, std::memory_order_relaxed);
+    header.m_readPos.store(0U, std::memory_order_relaxed);
+    header.m_version = ShmRingVersion;
+    std::atomic_thread_fence(std::memory_order_release);
+    header.m_magic = ShmRingMagic;
+}
+
+/// @brief Producer side: copy as much data as fits.
+/// @return Number of bytes written.
+inline std::size_t shmRingWrite(ShmRingHeader& header, const std::uint8_t* buf, std::size_t len)
+{
+    auto writePos = header.m_writePos.load(std::memory_order_relaxed);
+    auto readPos = header.m_readPos.load(std::memory_order_acquire);
+    auto freeSpace = static_cast<std::size_t>(header.m_capacity - (writePos - readPos));
+    auto count = std::min(len, freeSpace);
+    if (count == 0U) {
+        return 0U;
+    }
+
+    auto mask = header.m_capacity - 1;
+    auto offset = static_cast<std::size_t>(writePos & mask);
+    auto firstPart = std::min(count, static_cast<std::size_t>(header.m_capacity) - offset);
+    auto* data = shmRingData(header);
+    std::memcpy(data + offset, buf, firstPart);
+    std::memcpy(data, buf + firstPart, count - firstPart);
+    header.m_writePos.store(writePos + count, std::memory_order_release);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (header.m_consumerWaiting.load(std::memory_order_relaxed) != 0U) {
+        header.m_wakeSeq.fetch_add(1U, std::memory_order_release);
+        ::syscall(SYS_futex, &header.m_wakeSeq, FUTEX_WAKE, 1, nullptr, nullptr, 0);
+    }
+    return count;
+}
+
+/// @brief Consumer side: number of bytes available for reading.
+inline std::size_t shmRingAvailable(const ShmRingHeader& header)
+{
+    auto writePos = header.m_writePos.load(std::memory_order_acquire);
+    auto readPos = header.m_readPos.load(std::memory_order_relaxed);
+    return static_cast<std::size_t>(writePos - readPos);
+}
+
+/// @brief Consumer side: copy up to @b len available bytes and release
+///     the space to the producer.
+/// @return Number of bytes read.
+inline std::size_t shmRingRead(ShmRingHeader& header, std::uint8_t* buf, std::size_t len)
+{
+    auto count = std::min(len, shmRingAvailable(header));
+    if (count == 0U) {
+        return 0U;
+    }
+
+    auto readPos = header.m_readPos.load(std::memory_order_relaxed);
+    auto mask = header.m_capacity - 1;
+    auto offset = static_cast<std::size_t>(readPos & mask);
+    auto firstPart = std::min(count, static_cast<std::size_t>(header.m_capacity) - offset);
+    auto* data = shmRingData(header);
+    std::memcpy(buf, data + offset, firstPart);
+    std::memcpy(buf + firstPart, data, count - firstPart);
+    header.m_readPos.store(readPos + count, std::memory_order_release);
+    return count;
+}
+
+/// @brief Consumer side: sleep until new data is available or timeout expires.
+/// @details Spins for a short while before going to sleep to avoid
+///     system calls on both sides when the data keeps flowing.
+/// @return true if there is data available.
+inline bool shmRingWait(ShmRingHeader& header, unsigned timeoutMs)
+{
+    static const unsigned SpinCount = 4096U;
+    for (auto idx = 0U; idx < SpinCount; ++idx) {
+        if (shmRingAvailable(header) != 0U) {
+            return true;
+        }
+    }
+
+    auto seq = header.m_wakeSeq.load(std::memory_order_acquire);
+    header.m_consumerWaiting.store(1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (shmRingAvailable(header) == 0U) {
+        struct timespec timeout;
+        timeout.tv_sec = static_cast<time_t>(timeoutMs / 1000U);
+        timeout.tv_nsec = static_cast<long>((timeoutMs % 1000U) * 1000000L);
+        ::syscall(SYS_futex, &header.m_wakeSeq, FUTEX_WAIT, seq, &timeout, nullptr, 0);
+    }
+    header.m_consumerWaiting.store(0U, std::memory_order_relaxed);
+    return shmRingAvailable(header) != 0U;
+}
+
+}  // namespace cc_shm_socket
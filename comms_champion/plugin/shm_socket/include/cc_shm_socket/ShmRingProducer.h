@@ -0,0 +1,138 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Helper class to be used by the producer process to push framed
+///     data to the "Shared Memory Socket" plugin.
+
+#pragma once
+
+#include <string>
+#include <thread>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+#include "ShmRing.h"
+
+namespace cc_shm_socket
+{
+
+/// @brief Producer side of the shared memory ring.
+/// @details Usage:
+/// @code
+/// cc_shm_socket::ShmRingProducer producer;
+/// if (!producer.create("/my_ring", 1U << 20)) {
+///     ... // error
+/// }
+/// producer.write(buf, len); // buf contains complete framed messages
+/// @endcode
+class ShmRingProducer
+{
+public:
+    ShmRingProducer() = default;
+    ShmRingProducer(const ShmRingProducer&) = delete;
+    ShmRingProducer& operator=(const ShmRingProducer&) = delete;
+
+    ~ShmRingProducer() noexcept
+    {
+        close();
+    }
+
+    /// @brief Create (or recreate) shared memory object and initialise the ring.
+    /// @param[in] name Name of the POSIX shared memory object, starts with '/'.
+    /// @param[in] capacity Size of the data area, must be power of 2.
+    /// @return true on success.
+    bool create(const std::string& name, std::uint64_t capacity)
+    {
+        close();
+        if ((capacity == 0U) || ((capacity & (capacity - 1)) != 0U)) {
+            return false;
+        }
+
+        auto fd = ::shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+        if (fd < 0) {
+            return false;
+        }
+
+        auto size = shmRingTotalSize(capacity);
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            return false;
+        }
+
+        auto* mem = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mem == MAP_FAILED) {
+            return false;
+        }
+
+        m_header = new (mem) ShmRingHeader;
+        m_size = size;
+        m_name = name;
+        shmRingInit(*m_header, capacity);
+        return true;
+    }
+
+    /// @brief Unmap and remove the shared memory object.
+    void close()
+    {
+        if (m_header == nullptr) {
+            return;
+        }
+
+        ::munmap(m_header, m_size);
+        ::shm_unlink(m_name.c_str());
+        m_header = nullptr;
+        m_size = 0U;
+        m_name.clear();
+    }
+
+    /// @brief Write the data, waiting for the consumer to free the space
+    ///     if the ring is full.
+    void write(const std::uint8_t* buf, std::size_t len)
+    {
+        while ((m_header != nullptr) && (0U < len)) {
+            auto written = shmRingWrite(*m_header, buf, len);
+            if (written == 0U) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            buf += written;
+            len -= written;
+        }
+    }
+
+    /// @brief Write as much data as fits without waiting.
+    /// @return Number of bytes written.
+    std::size_t tryWrite(const std::uint8_t* buf, std::size_t len)
+    {
+        if (m_header == nullptr) {
+            return 0U;
+        }
+        return shmRingWrite(*m_header, buf, len);
+    }
+
+private:
+    ShmRingHeader* m_header = nullptr;
+    std::size_t m_size = 0U;
+    std::string m_name;
+};
+
+}  // namespace cc_shm_socket
@@ -168,6 +168,10 @@ void Socket::newConnection()
         m_remoteHost = QHostAddress(QHostAddress::LocalHost).toString();
     }
 
+    // Data streams in both directions are framed independently
+    assignConnectionId(newConnSocket);
+    assignConnectionId(connectionSocket.get());
+
     connectionSocket->connectToHost(m_remoteHost, m_remotePort);
     m_sockets.emplace_back(newConnSocket, std::move(connectionSocket));
 }
@@ -189,6 +193,8 @@ void Socket::clientConnectionTerminated()
     socket->blockSignals(true);
     iter->second->blockSignals(true);
     iter->second->flush();
+    releaseConnectionId(socket);
+    releaseConnectionId(iter->second.get());
     m_sockets.erase(iter);
     socket->deleteLater();
 }
@@ -265,6 +271,8 @@ void Socket::connectionSocketDisconnected()
     }
 
     assert(iter->first);
+    releaseConnectionId(iter->first);
+    releaseConnectionId(socket);
     iter->first->blockSignals(true);
     iter->first->flush();
     delete iter->first;
@@ -319,6 +327,8 @@ void Socket::removeConnection(SocketsList::iterator iter)
     assert(!iter->second);
 
     m_sockets.erase(iter);
+    releaseConnectionId(clientSocket, false);
+    releaseConnectionId(connectionSocket.get(), false);
 
     clientSocket->blockSignals(true);
     connectionSocket->blockSignals(true);
@@ -335,6 +345,29 @@ void Socket::removeConnection(SocketsList::iterator iter)
     }
 }
 
+void Socket::assignConnectionId(QTcpSocket* socket)
+{
+    ++m_nextConnectionId;
+    if (m_nextConnectionId == DataInfo::DefaultConnectionId) {
+        ++m_nextConnectionId;
+    }
+    m_connectionIds.insert(std::make_pair(socket, m_nextConnectionId));
+}
+
+void Socket::releaseConnectionId(QTcpSocket* socket, bool report)
+{
+    auto iter = m_connectionIds.find(socket);
+    if (iter == m_connectionIds.end()) {
+        return;
+    }
+
+    auto connectionId = iter->second;
+    m_connectionIds.erase(iter);
+    if (report) {
+        reportConnectionClosed(connectionId);
+    }
+}
+
 void Socket::performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSocket)
 {
     if (readFromSocket.bytesAvailable() == 0) {
@@ -344,6 +377,11 @@ void Socket::performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSoc
     auto dataPtr = makeDataInfo();
     dataPtr->m_timestamp = DataInfo::TimestampClock::now();
 
+    auto idIter = m_connectionIds.find(&readFromSocket);
+    if (idIter != m_connectionIds.end()) {
+        dataPtr->m_connectionId = idIter->second;
+    }
+
     auto dataSize = readFromSocket.bytesAvailable();
     dataPtr->m_data.resize(dataSize);
     auto result =
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <list>
+#include <map>
 
 #include "comms/CompileControl.h"
 
@@ -104,10 +105,13 @@ private:
     typedef std::unique_ptr<QTcpSocket> ConnectionSocketPtr;
     typedef std::pair<ClientSocketPtr, ConnectionSocketPtr> ConnectedPair;
     typedef std::list<ConnectedPair> SocketsList;
+    typedef std::map<QTcpSocket*, DataInfo::ConnectionId> ConnectionIdsMap;
 
     SocketsList::iterator findByClient(QTcpSocket* socket);
     SocketsList::iterator findByConnection(QTcpSocket* socket);
     void removeConnection(SocketsList::iterator iter);
+    void assignConnectionId(QTcpSocket* socket);
+    void releaseConnectionId(QTcpSocket* socket, bool report = true);
     void performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSocket);
 
     static const PortType DefaultPort = 20000;
@@ -117,6 +121,8 @@ private:
 
     QTcpServer m_server;
     SocketsList m_sockets;
+    ConnectionIdsMap m_connectionIds;
+    DataInfo::ConnectionId m_nextConnectionId = DataInfo::DefaultConnectionId;
 };
 
 }  // namespace proxy
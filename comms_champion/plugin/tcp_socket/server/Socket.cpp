@@ -58,8 +58,8 @@ Socket::Socket()
 
 Socket::~Socket() noexcept
 {
-    for (auto* socket : m_sockets) {
-        socket->flush();
+    for (auto& socketInfo : m_sockets) {
+        socketInfo.first->flush();
     }
 }
 
@@ -95,8 +95,8 @@ void Socket::sendDataImpl(DataInfoPtr dataPtr)
 
     QVariantList toList;
 
-    for (auto* socketTmp : m_sockets) {
-        auto* socket = qobject_cast<QTcpSocket*>(socketTmp);
+    for (auto& socketInfo : m_sockets) {
+        auto* socket = socketInfo.first;
         assert(socket != nullptr);
         socket->write(
             reinterpret_cast<const char*>(&dataPtr->m_data[0]),
@@ -124,7 +124,14 @@ unsigned Socket::connectionPropertiesImpl() const
 void Socket::newConnection()
 {
     auto *newConnSocket = m_server.nextPendingConnection();
-    m_sockets.push_back(newConnSocket);
+
+    // Every peer gets its own connection ID to allow independent
+    // framing of its data stream.
+    ++m_nextConnectionId;
+    if (m_nextConnectionId == DataInfo::DefaultConnectionId) {
+        ++m_nextConnectionId;
+    }
+    m_sockets.insert(std::make_pair(newConnSocket, m_nextConnectionId));
     connect(
         newConnSocket, SIGNAL(disconnected()),
         newConnSocket, SLOT(deleteLater()));
@@ -141,14 +148,16 @@ void Socket::newConnection()
 
 void Socket::connectionTerminated()
 {
-    auto* socket = sender();
-    auto iter = std::find(m_sockets.begin(), m_sockets.end(), socket);
+    auto* socket = qobject_cast<QTcpSocket*>(sender());
+    auto iter = m_sockets.find(socket);
     if (iter == m_sockets.end()) {
         assert(!"Must have found socket");
         return;
     }
 
+    auto connectionId = iter->second;
     m_sockets.erase(iter);
+    reportConnectionClosed(connectionId);
 }
 
 void Socket::readFromSocket()
@@ -156,8 +165,15 @@ void Socket::readFromSocket()
     auto* socket = qobject_cast<QTcpSocket*>(sender());
     assert(socket != nullptr);
 
+    auto iter = m_sockets.find(socket);
+    if (iter == m_sockets.end()) {
+        assert(!"Must have found socket");
+        return;
+    }
+
     auto dataPtr = makeDataInfo();
     dataPtr->m_timestamp = DataInfo::TimestampClock::now();
+    dataPtr->m_connectionId = iter->second;
 
     auto dataSize = socket->bytesAvailable();
     dataPtr->m_data.resize(dataSize);
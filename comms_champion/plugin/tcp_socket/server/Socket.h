@@ -17,7 +17,7 @@
 
 #pragma once
 
-#include <list>
+#include <map>
 
 #include "comms/CompileControl.h"
 
@@ -77,9 +77,12 @@ private slots:
     void acceptErrorOccurred(QAbstractSocket::SocketError err);
 
 private:
+    typedef std::map<QTcpSocket*, DataInfo::ConnectionId> SocketsMap;
+
     static const PortType DefaultPort = 20000;
     PortType m_port = DefaultPort;
-    std::list<QTcpSocket*> m_sockets;
+    SocketsMap m_sockets;
+    DataInfo::ConnectionId m_nextConnectionId = DataInfo::DefaultConnectionId;
     QTcpServer m_server;
 };
 